@@ -20,7 +20,7 @@
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/utility/literals.hpp"
-#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_grouped_gemm.hpp"
 #include "ck/utility/data_type.hpp"
 #include "ck/utility/tuple.hpp"
 #include "ck/utility/sequence.hpp"
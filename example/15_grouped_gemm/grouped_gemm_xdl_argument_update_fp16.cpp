@@ -0,0 +1,190 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+// Host-only microbenchmark of DeviceGroupedGemm_Xdl argument construction. Compares building a
+// fresh argument for every call against the incremental update API (pointers only, or a few
+// changed groups) with thousands of groups. No kernel is launched, and the capability check runs
+// against a pinned arch, so no GPU is needed.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/host_utility/device_prop.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/device/gemm_specialization.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_grouped_gemm_xdl.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+template <ck::index_t... Is>
+using S = ck::Sequence<Is...>;
+
+using F16 = ck::half_t;
+using F32 = float;
+
+using Row = ck::tensor_layout::gemm::RowMajor;
+using Col = ck::tensor_layout::gemm::ColumnMajor;
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+using ADataType        = F16;
+using BDataType        = F16;
+using AccDataType      = F32;
+using CShuffleDataType = F16;
+using DsDataType       = ck::Tuple<>;
+using EDataType        = F16;
+
+using ALayout  = Row;
+using BLayout  = Col;
+using DsLayout = ck::Tuple<>;
+using ELayout  = Row;
+
+using AElementOp   = PassThrough;
+using BElementOp   = PassThrough;
+using CDEElementOp = PassThrough;
+
+static constexpr auto GemmMNKPadding = ck::tensor_operation::device::GemmSpecialization::MNKPadding;
+
+using DeviceGemmInstance = ck::tensor_operation::device::DeviceGroupedGemm_Xdl
+    // clang-format off
+//######| ALayout| BLayout| DsLayout| ELayout|     AData|     BData|     AccData|         CShuffle|     DsData|     EData|           A|           B|          CDE|           GEMM| NumGemmK| Block|  MPer|  NPer|  KPer| AK1| BK1| MPer| NPer| MXdl| NXdl|  ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockLds|  BBlockTransfer| BBlockTransfer| BBlockTransfer| BlockTransfer| BBlockTransfer| BBlockTransfer| BBlockLds|    CShuffle|    CShuffle| CBlockTransferClusterLengths|  CBlockTransfer|
+//######|        |        |         |        |      Type|      Type|        Type|         DataType|       Type|      Type| Elementwise| Elementwise|  Elementwise| Spacialization| Prefetch|  Size| Block| Block| Block|    |    |  XDL|  XDL|  Per|  Per|   ThreadCluster|  ThreadCluster| SrcAccessOrder|   SrcVectorDim|      SrcScalar|      DstScalar| AddExtraM|   ThreadCluster|  ThreadCluster| SrcAccessOrder|  SrcVectorDim|      SrcScalar|      DstScalar| AddExtraN| MXdlPerWave| NXdlPerWave|         _MBlock_MWaveMPerXdl| ScalarPerVector|
+//######|        |        |         |        |          |          |            |                 |           |          |   Operation|   Operation|    Operation|               |    Stage|      |      |      |      |    |    |     |     | Wave| Wave| Lengths_K0_M_K1|   ArrangeOrder|               |               |      PerVector|   PerVector_K1|          | Lengths_K0_N_K1|   ArrangeOrder|               |              |      PerVector|   PerVector_K1|          |  PerShuffle|  PerShuffle|         _NBlock_NWaveNPerXdl|   _NWaveNPerXdl|
+//######|        |        |         |        |          |          |            |                 |           |          |            |            |             |               |         |      |      |      |      |    |    |     |     |     |     |                |               |               |               |               |               |          |                |               |               |              |               |               |          |            |            |                             |                |
+        < ALayout, BLayout, DsLayout, ELayout, ADataType, BDataType, AccDataType, CShuffleDataType, DsDataType, EDataType,  AElementOp,  BElementOp, CDEElementOp, GemmMNKPadding,        1,   256,   256,   128,    32,   8,   8,   32,   32,    4,    2,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         1,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,             2,              8,              8,         1,           1,           1,               S<1, 32, 1, 8>,               8>;
+// clang-format on
+
+template <typename F>
+double time_host_us(F&& f, int nrepeat)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    for(int i = 0; i < nrepeat; ++i)
+    {
+        f(i);
+    }
+
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::micro>(end - start).count() / nrepeat;
+}
+
+int main(int argc, char* argv[])
+{
+    int group_count   = 4096;
+    int num_shapes    = 64;
+    int changed_ratio = 100; // one in changed_ratio groups gets a new shape per step
+    int nrepeat       = 20;
+
+    if(argc == 1)
+    {
+        // use default case
+    }
+    else if(argc == 5)
+    {
+        group_count   = std::stoi(argv[1]);
+        num_shapes    = std::stoi(argv[2]);
+        changed_ratio = std::stoi(argv[3]);
+        nrepeat       = std::stoi(argv[4]);
+    }
+    else
+    {
+        printf("arg1: group count (default 4096)\n");
+        printf("arg2: number of distinct M per group (default 64)\n");
+        printf("arg3: one in arg3 groups changes shape per step (default 100)\n");
+        printf("arg4: repeat count (default 20)\n");
+        exit(0);
+    }
+
+    constexpr ck::index_t N = 4096;
+    constexpr ck::index_t K = 1024;
+
+    std::mt19937 gen(11939);
+    std::uniform_int_distribution<int> m_dis(1, num_shapes);
+
+    std::vector<ck::tensor_operation::device::GemmDesc> gemm_descs;
+    std::vector<const void*> p_a, p_b;
+    std::vector<std::array<const void*, 0>> p_ds;
+    std::vector<void*> p_c;
+
+    // pointers are never dereferenced on the host, any distinct values will do
+    auto fake_ptr = [](std::uintptr_t step, int i) {
+        return reinterpret_cast<void*>((step << 32) + (static_cast<std::uintptr_t>(i) << 8));
+    };
+
+    for(int i = 0; i < group_count; ++i)
+    {
+        const ck::index_t M = 16 * m_dis(gen);
+
+        gemm_descs.push_back({M, N, K, K, K, N, {}});
+
+        p_a.push_back(fake_ptr(1, i));
+        p_b.push_back(fake_ptr(2, i));
+        p_c.push_back(fake_ptr(3, i));
+    }
+
+    auto gemm = DeviceGemmInstance{};
+
+    auto make_argument = [&]() {
+        return gemm.MakeArgument(
+            p_a, p_b, p_ds, p_c, gemm_descs, AElementOp{}, BElementOp{}, CDEElementOp{});
+    };
+
+    // the first construction fills the shape cache
+    const double t_cold = time_host_us([&](int) { make_argument(); }, 1);
+
+    const double t_warm = time_host_us([&](int) { make_argument(); }, nrepeat);
+
+    auto argument = make_argument();
+
+    // IsSupportedArgument() queries the device name, answer it for an XDL arch instead
+    ck::set_device_name_override("gfx90a");
+
+    if(!gemm.IsSupportedArgument(argument))
+    {
+        std::cout << "wrong! " << gemm.GetTypeString() << " does not support this problem"
+                  << std::endl;
+
+        return 1;
+    }
+
+    const double t_update_ptr = time_host_us(
+        [&](int step) {
+            for(int i = 0; i < group_count; ++i)
+            {
+                p_a[i] = fake_ptr(4 + 3 * step, i);
+                p_b[i] = fake_ptr(5 + 3 * step, i);
+                p_c[i] = fake_ptr(6 + 3 * step, i);
+            }
+
+            argument.UpdatePointers(p_a, p_b, p_ds, p_c);
+        },
+        nrepeat);
+
+    const double t_update_group = time_host_us(
+        [&](int) {
+            for(int i = 0; i < group_count; i += changed_ratio)
+            {
+                auto desc = gemm_descs[i];
+
+                desc.M_ = 16 * m_dis(gen);
+
+                argument.UpdateGroup(i, desc, p_a[i], p_b[i], {}, p_c[i]);
+            }
+        },
+        nrepeat);
+
+    std::cout << "group count: " << group_count << ", distinct shapes: " << num_shapes
+              << std::endl;
+    std::cout << "MakeArgument (cold shape cache): " << t_cold << " us" << std::endl;
+    std::cout << "MakeArgument (warm shape cache): " << t_warm << " us" << std::endl;
+    std::cout << "UpdatePointers: " << t_update_ptr << " us" << std::endl;
+    std::cout << "UpdateGroup (1/" << changed_ratio << " of groups): " << t_update_group << " us"
+              << std::endl;
+
+    return 0;
+}
@@ -18,6 +18,7 @@
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/utility/host_common_util.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_multiple_reduce.hpp"
 
 static struct option long_options[] = {{"inLengths", required_argument, nullptr, 'D'},
                                        {"verify", required_argument, nullptr, 'v'},
@@ -115,63 +116,6 @@ class SimpleAppArgs
     };
 };
 
-template <typename InDataType, typename OutDataType1, typename OutDataType2, typename AccDataType>
-static void mean_meansquare_host(const Tensor<InDataType>& in,
-                                 Tensor<OutDataType1>& mean_ref,
-                                 Tensor<OutDataType2>& meansquare_ref,
-                                 size_t n,
-                                 size_t h,
-                                 size_t w,
-                                 size_t c)
-
-{
-    auto thread_reduce_func = [&](auto iN) {
-        AccDataType mean       = ck::type_convert<AccDataType>(0.0f);
-        AccDataType meansquare = ck::type_convert<AccDataType>(0.0f);
-
-        // compute mean, meanquare, variance, invVariance
-        for(std::size_t iH = 0; iH < h; iH++)
-        {
-            for(std::size_t iW = 0; iW < w; iW++)
-            {
-                for(std::size_t iC = 0; iC < c; iC++)
-                {
-                    AccDataType curr_value = ck::type_convert<AccDataType>(in(iN, iH, iW, iC));
-
-                    mean += curr_value;
-                    meansquare += curr_value * curr_value;
-                };
-            }
-        };
-
-        mean       = mean / (h * w * c);
-        meansquare = meansquare / (h * w * c);
-
-        mean_ref(iN)       = ck::type_convert<OutDataType1>(mean);
-        meansquare_ref(iN) = ck::type_convert<OutDataType2>(meansquare);
-    };
-
-    std::size_t num_thread      = std::thread::hardware_concurrency();
-    std::size_t work_per_thread = (n + num_thread - 1) / num_thread;
-
-    std::vector<joinable_thread> threads(num_thread);
-
-    for(std::size_t it = 0; it < num_thread; it++)
-    {
-        std::size_t iN_begin = it * work_per_thread;
-        std::size_t iN_end   = std::min(static_cast<size_t>((it + 1) * work_per_thread), n);
-
-        auto f = [=] {
-            for(std::size_t iN = iN_begin; iN < iN_end; iN++)
-            {
-                thread_reduce_func(iN);
-            }
-        };
-
-        threads[it] = joinable_thread(f);
-    }
-};
-
 using ReduceOperation = ck::reduce::Add;
 
 using InElementwiseOperation_Mean  = ck::tensor_operation::element_wise::PassThrough;
@@ -240,12 +184,6 @@ int mean_meansquare_dual_reduce_test(size_t n,
 
     in_dev.ToDevice(in.mData.data());
 
-    if(do_verification)
-    {
-        mean_meansquare_host<InDataType, OutDataType, OutDataType, AccDataType>(
-            in, mean_ref, meansquare_ref, n, h, w, c);
-    };
-
     constexpr ck::index_t NumInputDim  = Rank;
     constexpr ck::index_t NumOutputDim = (Rank - NumReduceDim > 1) ? Rank - NumReduceDim : 1;
 
@@ -259,6 +197,45 @@ int mean_meansquare_dual_reduce_test(size_t n,
     ck::ranges::copy(outLengths, i_outLengths.begin());
     ck::ranges::copy(outStrides, i_outStrides.begin());
 
+    const auto in_elementwise_op_tuple =
+        ck::make_tuple(InElementwiseOperation_Mean{}, InElementwiseOperation_Meansquare{});
+    const auto acc_elementwise_op_tuple = ck::make_tuple(
+        AccElementwiseOperation_Mean{static_cast<int32_t>(reduce_total_length)},
+        AccElementwiseOperation_Meansquare{static_cast<int32_t>(reduce_total_length)});
+
+    if(do_verification)
+    {
+        using ReferenceReduceInstance = ck::tensor_operation::host::ReferenceMultipleReduce<
+            InDataType,
+            AccDataType,
+            ck::Tuple<OutDataType, OutDataType>,
+            Rank,
+            NumReduceDim,
+            ck::Tuple<ReduceOperation, ReduceOperation>,
+            InElementwiseOperationTuple,
+            AccElementwiseOperationTuple,
+            false,
+            false>;
+
+        auto reduce_ref   = ReferenceReduceInstance{};
+        auto invoker_ref  = reduce_ref.MakeInvoker();
+        auto argument_ref = reduce_ref.MakeArgument(
+            i_inLengths,
+            i_inStrides,
+            i_outLengths,
+            {i_outStrides, i_outStrides},
+            reduceDims,
+            {alpha, alpha},
+            {beta, beta},
+            in.mData.data(),
+            {mean_ref.mData.data(), meansquare_ref.mData.data()},
+            {nullptr, nullptr},
+            in_elementwise_op_tuple,
+            acc_elementwise_op_tuple);
+
+        invoker_ref.Run(argument_ref);
+    };
+
     auto dual_reduce_op = DeviceDualReduce{};
 
     auto argument_ptr = dual_reduce_op.MakeArgumentPointer(
@@ -271,10 +248,8 @@ int mean_meansquare_dual_reduce_test(size_t n,
         {beta, beta},
         in_dev.GetDeviceBuffer(),
         {mean_dev.GetDeviceBuffer(), meansquare_dev.GetDeviceBuffer()},
-        ck::make_tuple(InElementwiseOperation_Mean{}, InElementwiseOperation_Meansquare{}),
-        ck::make_tuple(
-            AccElementwiseOperation_Mean{static_cast<int32_t>(reduce_total_length)},
-            AccElementwiseOperation_Meansquare{static_cast<int32_t>(reduce_total_length)}));
+        in_elementwise_op_tuple,
+        acc_elementwise_op_tuple);
 
     if(!dual_reduce_op.IsSupportedArgument(argument_ptr.get()))
     {
@@ -10,6 +10,7 @@
 
 #include "ck/library/utility/check_err.hpp"
 #include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/host_permute.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 
@@ -33,17 +34,10 @@ using DeviceElementwisePermuteInstance =
 template <typename HostTensorA, typename HostTensorB, typename Functor>
 void host_elementwise4D(HostTensorB& B_nhwc,
                         const HostTensorA& A_nchw,
-                        const std::vector<std::size_t>& shape_nchw,
+                        const std::vector<std::size_t>& /* shape_nchw */,
                         Functor functor)
 {
-    for(std::size_t n = 0; n < shape_nchw[0]; ++n)
-        for(std::size_t c = 0; c < shape_nchw[1]; ++c)
-            for(std::size_t h = 0; h < shape_nchw[2]; ++h)
-                for(std::size_t w = 0; w < shape_nchw[3]; ++w)
-                {
-                    auto a_val = A_nchw(n, c, h, w);
-                    functor(B_nhwc(n, h, w, c), a_val);
-                }
+    ck::utils::permute_host_tensor(A_nchw, {0, 2, 3, 1}, B_nhwc, functor);
 }
 
 int main()
@@ -9,8 +9,24 @@
 
 namespace ck {
 
+// Device name reported by get_device_name() instead of querying the runtime. Used to stub the
+// capability query, e.g. to evaluate IsSupportedArgument() for an arch on a machine without it.
+inline std::string& device_name_override()
+{
+    static std::string name;
+    return name;
+}
+
+// An empty name restores the runtime query
+inline void set_device_name_override(const std::string& name) { device_name_override() = name; }
+
 inline std::string get_device_name()
 {
+    if(!device_name_override().empty())
+    {
+        return device_name_override();
+    }
+
     hipDeviceProp_t props{};
     int device;
     auto status = hipGetDevice(&device);
@@ -0,0 +1,394 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Opt-in tracing of device operation invocations.
+//
+// With tracing on, make_traced_argument_pointer() and run_traced() (see
+// ck/tensor_operation/gpu/device/device_base_trace.hpp) record which instance is created for which
+// problem with how much workspace, and how long each run takes. A record is a fixed size struct
+// that the calling thread copies into its own single producer ring buffer, without locks or
+// allocation; a background thread drains the rings into the trace file every
+// InvocationTraceFlushPeriodMs. Records that find their ring full are dropped and counted rather
+// than blocking the caller. With tracing off, the only cost is one relaxed atomic load.
+//
+// Only invocations that go through these two wrappers are traced. Tracing starts with
+// InvocationTracer::Start() or, without calling it, when the environment variable
+// CK_INVOCATION_TRACE names the trace file. "ckProfiler trace_decode" turns a trace into the list
+// of ckProfiler commands of the problems it contains.
+
+namespace ck {
+
+inline constexpr std::size_t InvocationTraceMaxOperationName = 24;
+inline constexpr std::size_t InvocationTraceMaxProblemValue  = 16;
+inline constexpr std::size_t InvocationTraceRingCapacity     = 1024;
+inline constexpr int InvocationTraceFlushPeriodMs            = 10;
+inline constexpr char InvocationTraceMagic[]                 = "CKTRACE1";
+
+enum struct InvocationTraceEvent : uint32_t
+{
+    MakeArgument = 0,
+    Run          = 1,
+};
+
+// The problem of an invocation in the terms of a ckProfiler operation: its name, its data type
+// and layout codes (-1 if it has none) and the remaining problem arguments, e.g. M, N, K and the
+// strides for "gemm"
+struct InvocationProblem
+{
+    InvocationProblem() = default;
+
+    InvocationProblem(const char* operation,
+                      int32_t data_type,
+                      int32_t layout,
+                      std::initializer_list<int64_t> values)
+        : data_type_{data_type}, layout_{layout}
+    {
+        std::strncpy(operation_, operation, InvocationTraceMaxOperationName - 1);
+
+        num_value_ = static_cast<uint32_t>(std::min(values.size(), InvocationTraceMaxProblemValue));
+
+        std::copy_n(values.begin(), num_value_, values_);
+    }
+
+    char operation_[InvocationTraceMaxOperationName] = {};
+    int32_t data_type_                               = -1;
+    int32_t layout_                                  = -1;
+    uint32_t num_value_                              = 0;
+    int64_t values_[InvocationTraceMaxProblemValue]  = {};
+};
+
+struct InvocationTraceRecord
+{
+    uint64_t timestamp_ns_    = 0;
+    uint64_t instance_hash_   = 0; // typeid(op).hash_code(), as in GetTypeIdHashCode()
+    uint64_t argument_id_     = 0; // address of the argument, joins a run to its problem
+    uint64_t workspace_bytes_ = 0;
+    uint32_t event_           = 0;
+    uint32_t thread_id_       = 0;
+    float time_ms_            = 0; // kernel time if the run was timed, host time otherwise
+    InvocationProblem problem_;    // MakeArgument only
+};
+
+static_assert(std::is_trivially_copyable_v<InvocationTraceRecord>);
+
+// Single producer, single consumer ring of records
+class InvocationTraceRing
+{
+    public:
+    InvocationTraceRing() : records_(InvocationTraceRingCapacity) {}
+
+    // producer only, false if the ring is full
+    bool Push(const InvocationTraceRecord& record)
+    {
+        const uint64_t head = head_.load(std::memory_order_relaxed);
+
+        if(head - tail_.load(std::memory_order_acquire) == InvocationTraceRingCapacity)
+        {
+            return false;
+        }
+
+        records_[head % InvocationTraceRingCapacity] = record;
+        head_.store(head + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    // consumer only, f(record) for every record pushed so far
+    template <typename F>
+    void Drain(F&& f)
+    {
+        const uint64_t tail = tail_.load(std::memory_order_relaxed);
+        const uint64_t head = head_.load(std::memory_order_acquire);
+
+        for(uint64_t i = tail; i != head; ++i)
+        {
+            f(records_[i % InvocationTraceRingCapacity]);
+        }
+
+        tail_.store(head, std::memory_order_release);
+    }
+
+    // producer only, called when its thread exits; no record is pushed afterwards
+    void MarkDead() { dead_.store(true, std::memory_order_release); }
+
+    bool IsDead() const { return dead_.load(std::memory_order_acquire); }
+
+    private:
+    std::vector<InvocationTraceRecord> records_;
+
+    alignas(64) std::atomic<uint64_t> head_{0};
+    alignas(64) std::atomic<uint64_t> tail_{0};
+    std::atomic<bool> dead_{false};
+};
+
+class InvocationTracer
+{
+    public:
+    static InvocationTracer& GetInstance()
+    {
+        static InvocationTracer tracer;
+
+        return tracer;
+    }
+
+    static bool IsEnabled()
+    {
+        return GetInstance().enabled_.load(std::memory_order_relaxed);
+    }
+
+    InvocationTracer(const InvocationTracer&) = delete;
+    InvocationTracer& operator=(const InvocationTracer&) = delete;
+
+    ~InvocationTracer() { Stop(); }
+
+    // starts writing records to path, returns false if the file can not be opened
+    bool Start(const std::string& path)
+    {
+        std::lock_guard<std::mutex> control_lock(control_mutex_);
+
+        StopTrace();
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        p_file_ = std::fopen(path.c_str(), "wb");
+
+        if(p_file_ == nullptr)
+        {
+            return false;
+        }
+
+        const uint32_t record_bytes = sizeof(InvocationTraceRecord);
+
+        std::fwrite(InvocationTraceMagic, 1, sizeof(InvocationTraceMagic) - 1, p_file_);
+        std::fwrite(&record_bytes, sizeof(record_bytes), 1, p_file_);
+
+        // records that raced with the last Stop() belong to the previous trace
+        DrainRings([](const InvocationTraceRecord&) {});
+
+        stop_    = false;
+        flusher_ = std::thread([this, p_file = p_file_] { FlushLoop(p_file); });
+
+        enabled_.store(true, std::memory_order_relaxed);
+
+        return true;
+    }
+
+    // writes the records buffered so far and closes the trace file
+    void Stop()
+    {
+        std::lock_guard<std::mutex> control_lock(control_mutex_);
+
+        StopTrace();
+    }
+
+    void Record(InvocationTraceRecord& record)
+    {
+        auto& thread_ring = GetThreadRing();
+
+        record.timestamp_ns_ = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch())
+                .count());
+        record.thread_id_ = thread_ring.id_;
+
+        if(!thread_ring.ring_->Push(record))
+        {
+            num_dropped_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    uint64_t GetNumDropped() const { return num_dropped_.load(std::memory_order_relaxed); }
+
+    // number of rings the flusher still drains, one per thread that recorded and has not exited
+    std::size_t GetNumRings()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        return rings_.size();
+    }
+
+    private:
+    struct ThreadRing
+    {
+        ThreadRing() = default;
+        ThreadRing(const ThreadRing&) = delete;
+        ThreadRing& operator=(const ThreadRing&) = delete;
+
+        // the ring outlives the thread until the flusher has written its last records
+        ~ThreadRing()
+        {
+            if(ring_)
+            {
+                ring_->MarkDead();
+            }
+        }
+
+        std::shared_ptr<InvocationTraceRing> ring_;
+        uint32_t id_ = 0;
+    };
+
+    InvocationTracer()
+    {
+        if(const char* path = std::getenv("CK_INVOCATION_TRACE"); path != nullptr && *path != 0)
+        {
+            Start(path);
+        }
+    }
+
+    // the ring of the calling thread, registered with the flusher on first use; the ring of an
+    // exited thread is released once its last records are written, see DrainRings()
+    ThreadRing& GetThreadRing()
+    {
+        thread_local ThreadRing thread_ring;
+
+        if(!thread_ring.ring_)
+        {
+            thread_ring.ring_ = std::make_shared<InvocationTraceRing>();
+
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            rings_.push_back(thread_ring.ring_);
+            thread_ring.id_ = ++num_thread_;
+        }
+
+        return thread_ring;
+    }
+
+    // caller holds control_mutex_; the file and the flusher are taken over under mutex_, then the
+    // flusher is joined and the file closed without holding it
+    void StopTrace()
+    {
+        std::FILE* p_file = nullptr;
+        std::thread flusher;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            if(p_file_ == nullptr)
+            {
+                return;
+            }
+
+            enabled_.store(false, std::memory_order_relaxed);
+            stop_ = true;
+
+            std::swap(p_file, p_file_);
+            std::swap(flusher, flusher_);
+        }
+
+        wake_.notify_all();
+        flusher.join();
+
+        std::fclose(p_file);
+    }
+
+    // writes to p_file, which the flusher owns until StopTrace() has joined it
+    void FlushLoop(std::FILE* p_file)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        // drains once more after Stop(), even if it came before the first period
+        for(bool stop = false; !stop;)
+        {
+            const auto period = std::chrono::milliseconds(InvocationTraceFlushPeriodMs);
+
+            wake_.wait_for(lock, period, [&] { return stop_; });
+
+            stop = stop_;
+
+            DrainRings([&](const InvocationTraceRecord& record) {
+                std::fwrite(&record, sizeof(record), 1, p_file);
+            });
+
+            std::fflush(p_file);
+        }
+    }
+
+    // f(record) for every buffered record, then drops the rings of exited threads; the caller
+    // holds mutex_ and is the only consumer
+    template <typename F>
+    void DrainRings(F&& f)
+    {
+        rings_.erase(std::remove_if(rings_.begin(),
+                                    rings_.end(),
+                                    [&](const auto& ring) {
+                                        // dead before draining, so nothing is pushed after
+                                        const bool dead = ring->IsDead();
+
+                                        ring->Drain(f);
+
+                                        return dead;
+                                    }),
+                     rings_.end());
+    }
+
+    std::atomic<bool> enabled_{false};
+    std::atomic<uint64_t> num_dropped_{0};
+
+    std::mutex control_mutex_; // serializes Start() and Stop()
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    bool stop_ = false;
+    std::thread flusher_;
+    std::FILE* p_file_ = nullptr;
+    std::vector<std::shared_ptr<InvocationTraceRing>> rings_;
+    uint32_t num_thread_ = 0;
+};
+
+// All records of a trace file, ordered by time
+inline std::vector<InvocationTraceRecord> read_invocation_trace(const std::string& path)
+{
+    std::unique_ptr<std::FILE, int (*)(std::FILE*)> p_file(std::fopen(path.c_str(), "rb"),
+                                                           &std::fclose);
+
+    if(!p_file)
+    {
+        throw std::runtime_error("wrong! can not open invocation trace " + path);
+    }
+
+    char magic[sizeof(InvocationTraceMagic) - 1];
+    uint32_t record_bytes = 0;
+
+    if(std::fread(magic, 1, sizeof(magic), p_file.get()) != sizeof(magic) ||
+       std::memcmp(magic, InvocationTraceMagic, sizeof(magic)) != 0 ||
+       std::fread(&record_bytes, sizeof(record_bytes), 1, p_file.get()) != 1 ||
+       record_bytes != sizeof(InvocationTraceRecord))
+    {
+        throw std::runtime_error("wrong! not an invocation trace of this version: " + path);
+    }
+
+    std::vector<InvocationTraceRecord> records;
+    InvocationTraceRecord record;
+
+    while(std::fread(&record, sizeof(record), 1, p_file.get()) == 1)
+    {
+        records.push_back(record);
+    }
+
+    std::stable_sort(records.begin(), records.end(), [](const auto& a, const auto& b) {
+        return a.timestamp_ns_ < b.timestamp_ns_;
+    });
+
+    return records;
+}
+
+} // namespace ck
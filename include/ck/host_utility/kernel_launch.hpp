@@ -8,6 +8,7 @@
 #include "ck/ck.hpp"
 #include "ck/stream_config.hpp"
 #include "ck/host_utility/hip_check_error.hpp"
+#include "ck/host_utility/kernel_timer.hpp"
 
 template <typename... Args, typename F>
 float launch_and_time_kernel(const StreamConfig& stream_config,
@@ -32,39 +33,13 @@ float launch_and_time_kernel(const StreamConfig& stream_config,
 
         printf("Warm up %d times\n", stream_config.cold_niters_);
 #endif
-        // warm up
-        for(int i = 0; i < stream_config.cold_niters_; ++i)
-        {
-            kernel<<<grid_dim, block_dim, lds_byte, stream_config.stream_id_>>>(args...);
-            hip_check_error(hipGetLastError());
-        }
-
-        const int nrepeat = stream_config.nrepeat_;
-#if DEBUG_LOG
-        printf("Start running %d times...\n", nrepeat);
-#endif
-        hipEvent_t start, stop;
-
-        hip_check_error(hipEventCreate(&start));
-        hip_check_error(hipEventCreate(&stop));
-
-        hip_check_error(hipDeviceSynchronize());
-        hip_check_error(hipEventRecord(start, stream_config.stream_id_));
-
-        for(int i = 0; i < nrepeat; ++i)
-        {
-            kernel<<<grid_dim, block_dim, lds_byte, stream_config.stream_id_>>>(args...);
-            hip_check_error(hipGetLastError());
-        }
-
-        hip_check_error(hipEventRecord(stop, stream_config.stream_id_));
-        hip_check_error(hipEventSynchronize(stop));
-
-        float total_time = 0;
-
-        hip_check_error(hipEventElapsedTime(&total_time, start, stop));
-
-        return total_time / nrepeat;
+        return ck::time_kernel_runs(
+            stream_config,
+            [&] {
+                kernel<<<grid_dim, block_dim, lds_byte, stream_config.stream_id_>>>(args...);
+                hip_check_error(hipGetLastError());
+            },
+            [] {});
     }
     else
     {
@@ -105,41 +80,13 @@ float launch_and_time_kernel_with_preprocess(const StreamConfig& stream_config,
 
         printf("Warm up %d times\n", stream_config.cold_niters_);
 #endif
-        // warm up
-        preprocess();
-        for(int i = 0; i < stream_config.cold_niters_; ++i)
-        {
-            kernel<<<grid_dim, block_dim, lds_byte, stream_config.stream_id_>>>(args...);
-            hip_check_error(hipGetLastError());
-        }
-
-        const int nrepeat = stream_config.nrepeat_;
-#if DEBUG_LOG
-        printf("Start running %d times...\n", nrepeat);
-#endif
-        hipEvent_t start, stop;
-
-        hip_check_error(hipEventCreate(&start));
-        hip_check_error(hipEventCreate(&stop));
-
-        hip_check_error(hipDeviceSynchronize());
-        hip_check_error(hipEventRecord(start, stream_config.stream_id_));
-
-        for(int i = 0; i < nrepeat; ++i)
-        {
-            preprocess();
-            kernel<<<grid_dim, block_dim, lds_byte, stream_config.stream_id_>>>(args...);
-            hip_check_error(hipGetLastError());
-        }
-
-        hip_check_error(hipEventRecord(stop, stream_config.stream_id_));
-        hip_check_error(hipEventSynchronize(stop));
-
-        float total_time = 0;
-
-        hip_check_error(hipEventElapsedTime(&total_time, start, stop));
-
-        return total_time / nrepeat;
+        return ck::time_kernel_runs(
+            stream_config,
+            [&] {
+                kernel<<<grid_dim, block_dim, lds_byte, stream_config.stream_id_>>>(args...);
+                hip_check_error(hipGetLastError());
+            },
+            preprocess);
     }
     else
     {
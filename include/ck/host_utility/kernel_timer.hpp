@@ -0,0 +1,402 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <ostream>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+
+#include "ck/stream_config.hpp"
+#include "ck/host_utility/hip_check_error.hpp"
+
+namespace ck {
+
+// Interface of the clock used by launch_and_time_kernel. A timer records num_samples independent
+// start/stop pairs; the elapsed times are only read back after all of them have been recorded, so
+// that GPU timers do not have to synchronize between iterations.
+struct KernelTimer
+{
+    virtual ~KernelTimer() = default;
+
+    // prepare for num_samples start/stop pairs
+    virtual void Reset(int num_samples) = 0;
+
+    virtual void Start(hipStream_t stream, int sample) = 0;
+
+    virtual void Stop(hipStream_t stream, int sample) = 0;
+
+    // wait for outstanding work before timing starts
+    virtual void Synchronize(hipStream_t stream) = 0;
+
+    // elapsed time in ms of a recorded sample, waits for the sample to complete
+    virtual float GetElapsedTime(int sample) = 0;
+};
+
+// hipEvent based timer, the default
+struct GpuEventTimer : public KernelTimer
+{
+    GpuEventTimer() = default;
+
+    GpuEventTimer(const GpuEventTimer&) = delete;
+    GpuEventTimer& operator=(const GpuEventTimer&) = delete;
+
+    ~GpuEventTimer() override { DestroyEvents(); }
+
+    void Reset(int num_samples) override
+    {
+        DestroyEvents();
+
+        start_.resize(num_samples);
+        stop_.resize(num_samples);
+
+        for(int i = 0; i < num_samples; ++i)
+        {
+            hip_check_error(hipEventCreate(&start_[i]));
+            hip_check_error(hipEventCreate(&stop_[i]));
+        }
+    }
+
+    void Start(hipStream_t stream, int sample) override
+    {
+        hip_check_error(hipEventRecord(start_[sample], stream));
+    }
+
+    void Stop(hipStream_t stream, int sample) override
+    {
+        hip_check_error(hipEventRecord(stop_[sample], stream));
+    }
+
+    void Synchronize(hipStream_t) override { hip_check_error(hipDeviceSynchronize()); }
+
+    float GetElapsedTime(int sample) override
+    {
+        float time = 0;
+
+        hip_check_error(hipEventSynchronize(stop_[sample]));
+        hip_check_error(hipEventElapsedTime(&time, start_[sample], stop_[sample]));
+
+        return time;
+    }
+
+    private:
+    void DestroyEvents()
+    {
+        for(auto& event : start_)
+        {
+            (void)hipEventDestroy(event);
+        }
+
+        for(auto& event : stop_)
+        {
+            (void)hipEventDestroy(event);
+        }
+
+        start_.clear();
+        stop_.clear();
+    }
+
+    std::vector<hipEvent_t> start_;
+    std::vector<hipEvent_t> stop_;
+};
+
+// std::chrono::steady_clock based timer, for host backends and tests. With sync_stream the stream
+// is synchronized at every start and stop, so it also measures asynchronous launches (including
+// launch overhead).
+struct HostTimer : public KernelTimer
+{
+    using Clock = std::chrono::steady_clock;
+
+    explicit HostTimer(bool sync_stream = false) : sync_stream_{sync_stream} {}
+
+    void Reset(int num_samples) override
+    {
+        start_.assign(num_samples, Clock::time_point{});
+        stop_.assign(num_samples, Clock::time_point{});
+    }
+
+    void Start(hipStream_t stream, int sample) override
+    {
+        Synchronize(stream);
+        start_[sample] = Clock::now();
+    }
+
+    void Stop(hipStream_t stream, int sample) override
+    {
+        Synchronize(stream);
+        stop_[sample] = Clock::now();
+    }
+
+    void Synchronize(hipStream_t stream) override
+    {
+        if(sync_stream_)
+        {
+            hip_check_error(hipStreamSynchronize(stream));
+        }
+    }
+
+    float GetElapsedTime(int sample) override
+    {
+        return std::chrono::duration<float, std::milli>(stop_[sample] - start_[sample]).count();
+    }
+
+    private:
+    bool sync_stream_;
+    std::vector<Clock::time_point> start_;
+    std::vector<Clock::time_point> stop_;
+};
+
+// statistics over per-iteration kernel times, all times in ms
+struct TimingStats
+{
+    // samples in the order they were taken, before outlier rejection
+    std::vector<float> samples_;
+
+    int num_warmup_   = 0;
+    int num_rejected_ = 0;
+
+    float mean_   = 0;
+    float min_    = 0;
+    float max_    = 0;
+    float median_ = 0;
+    float p90_    = 0;
+    float p99_    = 0;
+    float stddev_ = 0;
+
+    bool Empty() const { return samples_.empty(); }
+};
+
+// percentile p in [0, 1] of sorted samples, linear interpolation between closest ranks
+inline float get_percentile(const std::vector<float>& sorted, float p)
+{
+    if(sorted.empty())
+    {
+        return 0;
+    }
+
+    const float rank = p * (sorted.size() - 1);
+    const auto lo    = static_cast<std::size_t>(std::floor(rank));
+    const auto hi    = std::min(lo + 1, sorted.size() - 1);
+
+    return sorted[lo] + (rank - lo) * (sorted[hi] - sorted[lo]);
+}
+
+// Outliers are samples outside Tukey's fences [q1 - 1.5 * iqr, q3 + 1.5 * iqr]; they are kept in
+// samples_ but excluded from all statistics.
+inline TimingStats compute_timing_stats(const std::vector<float>& samples,
+                                        bool reject_outliers = false)
+{
+    TimingStats stats;
+
+    stats.samples_ = samples;
+
+    std::vector<float> sorted = samples;
+
+    std::sort(sorted.begin(), sorted.end());
+
+    if(reject_outliers && sorted.size() >= 4)
+    {
+        const float q1  = get_percentile(sorted, 0.25f);
+        const float q3  = get_percentile(sorted, 0.75f);
+        const float iqr = q3 - q1;
+
+        const auto first = std::lower_bound(sorted.begin(), sorted.end(), q1 - 1.5f * iqr);
+        const auto last  = std::upper_bound(sorted.begin(), sorted.end(), q3 + 1.5f * iqr);
+
+        stats.num_rejected_ = static_cast<int>(sorted.size() - (last - first));
+
+        sorted = std::vector<float>(first, last);
+    }
+
+    if(sorted.empty())
+    {
+        return stats;
+    }
+
+    const double sum = std::accumulate(sorted.begin(), sorted.end(), 0.0);
+    const double mean = sum / sorted.size();
+
+    double sq_sum = 0;
+
+    for(float x : sorted)
+    {
+        sq_sum += (x - mean) * (x - mean);
+    }
+
+    stats.mean_   = static_cast<float>(mean);
+    stats.min_    = sorted.front();
+    stats.max_    = sorted.back();
+    stats.median_ = get_percentile(sorted, 0.5f);
+    stats.p90_    = get_percentile(sorted, 0.9f);
+    stats.p99_    = get_percentile(sorted, 0.99f);
+    stats.stddev_ =
+        sorted.size() > 1 ? static_cast<float>(std::sqrt(sq_sum / (sorted.size() - 1))) : 0.f;
+
+    return stats;
+}
+
+inline std::ostream& operator<<(std::ostream& os, const TimingStats& stats)
+{
+    os << "mean " << stats.mean_ << " ms, min " << stats.min_ << ", median " << stats.median_
+       << ", p90 " << stats.p90_ << ", p99 " << stats.p99_ << ", max " << stats.max_
+       << ", stddev " << stats.stddev_ << ", samples " << stats.samples_.size();
+
+    if(stats.num_rejected_ > 0)
+    {
+        os << ", outliers " << stats.num_rejected_;
+    }
+
+    if(stats.num_warmup_ > 0)
+    {
+        os << ", warmup " << stats.num_warmup_;
+    }
+
+    return os;
+}
+
+// whether stream_config asks for more than the mean over one timed batch of launches
+inline bool is_per_iteration_timing(const StreamConfig& stream_config)
+{
+    return stream_config.stats_ != nullptr || stream_config.flush_cache_bytes_ > 0 ||
+           stream_config.reject_outliers_ || stream_config.warmup_until_stable_;
+}
+
+// Time run() as configured by stream_config and return the mean time per run in ms. preprocess()
+// is called once before warm up and before every timed run, and is included in the timed region.
+//
+// By default all nrepeat_ runs are timed as one batch. Per-iteration samples are taken if
+// statistics, cache flushing, outlier rejection or warmup until stable are requested:
+//   - flush_cache_bytes_: a scratch buffer of this size is overwritten before every run, outside
+//     the timed region, to evict the operands from the caches
+//   - warmup_until_stable_: after cold_niters_, keep warming up until the spread of the last
+//     5 runs is within stable_tolerance_ of their median, or max_warmup_iters_ is reached
+template <typename Run, typename PreProcess>
+float time_kernel_runs(const StreamConfig& stream_config, Run run, PreProcess preprocess)
+{
+    GpuEventTimer gpu_timer;
+
+    KernelTimer& timer = stream_config.timer_ != nullptr ? *stream_config.timer_ : gpu_timer;
+
+    const hipStream_t stream = stream_config.stream_id_;
+
+    // warm up
+    preprocess();
+    for(int i = 0; i < stream_config.cold_niters_; ++i)
+    {
+        run();
+    }
+
+    int num_warmup = stream_config.cold_niters_;
+
+    if(stream_config.warmup_until_stable_)
+    {
+        constexpr int window = 5;
+
+        std::vector<float> recent;
+
+        timer.Reset(1);
+
+        while(num_warmup < stream_config.max_warmup_iters_)
+        {
+            timer.Synchronize(stream);
+            timer.Start(stream, 0);
+            preprocess();
+            run();
+            timer.Stop(stream, 0);
+
+            recent.push_back(timer.GetElapsedTime(0));
+            ++num_warmup;
+
+            if(recent.size() >= window)
+            {
+                std::vector<float> last(recent.end() - window, recent.end());
+
+                std::sort(last.begin(), last.end());
+
+                if(last.back() - last.front() <= stream_config.stable_tolerance_ * last[window / 2])
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    const int nrepeat = stream_config.nrepeat_;
+
+    if(nrepeat <= 0)
+    {
+        return 0;
+    }
+
+    if(!is_per_iteration_timing(stream_config))
+    {
+        timer.Reset(1);
+        timer.Synchronize(stream);
+        timer.Start(stream, 0);
+
+        for(int i = 0; i < nrepeat; ++i)
+        {
+            preprocess();
+            run();
+        }
+
+        timer.Stop(stream, 0);
+
+        return timer.GetElapsedTime(0) / nrepeat;
+    }
+
+    void* p_flush = nullptr;
+
+    if(stream_config.flush_cache_bytes_ > 0)
+    {
+        hip_check_error(hipMalloc(&p_flush, stream_config.flush_cache_bytes_));
+    }
+
+    timer.Reset(nrepeat);
+    timer.Synchronize(stream);
+
+    for(int i = 0; i < nrepeat; ++i)
+    {
+        if(p_flush != nullptr)
+        {
+            hip_check_error(
+                hipMemsetAsync(p_flush, i & 0xff, stream_config.flush_cache_bytes_, stream));
+        }
+
+        timer.Start(stream, i);
+        preprocess();
+        run();
+        timer.Stop(stream, i);
+    }
+
+    std::vector<float> samples(nrepeat);
+
+    for(int i = 0; i < nrepeat; ++i)
+    {
+        samples[i] = timer.GetElapsedTime(i);
+    }
+
+    if(p_flush != nullptr)
+    {
+        hip_check_error(hipFree(p_flush));
+    }
+
+    auto stats = compute_timing_stats(samples, stream_config.reject_outliers_);
+
+    stats.num_warmup_ = num_warmup;
+
+    if(stream_config.stats_ != nullptr)
+    {
+        *stream_config.stats_ = stats;
+    }
+
+    return stats.mean_;
+}
+
+} // namespace ck
@@ -3,9 +3,16 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include <hip/hip_runtime.h>
 #include <hip/hip_fp16.h>
 
+namespace ck {
+struct KernelTimer;
+struct TimingStats;
+} // namespace ck
+
 struct StreamConfig
 {
     hipStream_t stream_id_ = nullptr;
@@ -13,4 +20,13 @@ struct StreamConfig
     int log_level_         = 0;
     int cold_niters_       = 5;
     int nrepeat_           = 50;
+
+    // optional timing controls, see ck/host_utility/kernel_timer.hpp
+    ck::KernelTimer* timer_        = nullptr; // nullptr: hipEvent timer
+    ck::TimingStats* stats_        = nullptr; // if set, receives per-iteration statistics
+    std::size_t flush_cache_bytes_ = 0;       // scratch buffer overwritten before every iteration
+    bool reject_outliers_          = false;
+    bool warmup_until_stable_      = false;
+    int max_warmup_iters_          = 100;
+    float stable_tolerance_        = 0.02f;
 };
@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <typeinfo>
+#include <utility>
+
+#include "ck/stream_config.hpp"
+#include "ck/host_utility/invocation_trace.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// op.MakeArgumentPointer(args...), recording the instance, the problem and the workspace size when
+// invocation tracing is on, see ck/host_utility/invocation_trace.hpp
+template <typename DeviceOp, typename... Args>
+auto make_traced_argument_pointer(DeviceOp& op, const InvocationProblem& problem, Args&&... args)
+{
+    auto argument_ptr = op.MakeArgumentPointer(std::forward<Args>(args)...);
+
+    if(InvocationTracer::IsEnabled())
+    {
+        InvocationTraceRecord record;
+
+        record.event_           = static_cast<uint32_t>(InvocationTraceEvent::MakeArgument);
+        record.instance_hash_   = typeid(op).hash_code();
+        record.argument_id_     = reinterpret_cast<std::uintptr_t>(argument_ptr.get());
+        record.workspace_bytes_ = op.GetWorkSpaceSize(argument_ptr.get());
+        record.problem_         = problem;
+
+        InvocationTracer::GetInstance().Record(record);
+    }
+
+    return argument_ptr;
+}
+
+// invoker.Run(p_arg, stream_config), recording the time of the run when invocation tracing is on
+inline float run_traced(const BaseOperator& op,
+                        BaseInvoker& invoker,
+                        const BaseArgument* p_arg,
+                        const StreamConfig& stream_config = StreamConfig{})
+{
+    if(!InvocationTracer::IsEnabled())
+    {
+        return invoker.Run(p_arg, stream_config);
+    }
+
+    const auto time_begin = std::chrono::steady_clock::now();
+    const float time      = invoker.Run(p_arg, stream_config);
+    const auto time_end   = std::chrono::steady_clock::now();
+
+    InvocationTraceRecord record;
+
+    record.event_         = static_cast<uint32_t>(InvocationTraceEvent::Run);
+    record.instance_hash_ = typeid(op).hash_code();
+    record.argument_id_   = reinterpret_cast<std::uintptr_t>(p_arg);
+    record.time_ms_       = stream_config.time_kernel_
+                                ? time
+                                : std::chrono::duration<float, std::milli>(time_end - time_begin)
+                                      .count();
+
+    InvocationTracer::GetInstance().Record(record);
+
+    return time;
+}
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -3,7 +3,10 @@
 
 #pragma once
 
+#include <optional>
+
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/tensor_operation/gpu/device/gemm_specialization.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -35,6 +38,12 @@ struct DeviceGemm : public BaseOperator
                         CElementwiseOperation c_element_op) = 0;
 
     virtual std::unique_ptr<BaseInvoker> MakeInvokerPointer() = 0;
+
+    // padding of the instance, nullopt if the implementation does not report it
+    virtual std::optional<GemmSpecialization> GetGemmSpecialization() const
+    {
+        return std::nullopt;
+    }
 };
 
 } // namespace device
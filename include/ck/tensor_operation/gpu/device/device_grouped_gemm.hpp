@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <array>
 #include <iostream>
+#include <stdexcept>
 #include <vector>
 
 #include "device_base.hpp"
@@ -48,6 +50,30 @@ struct DeviceGroupedGemm : public BaseOperator
                         CElementwiseOperation c_element_op) = 0;
 
     virtual std::unique_ptr<BaseInvoker> MakeInvokerPointer() = 0;
+
+    // Incremental argument update: reuse the descriptors of an existing argument and only replace
+    // pointers, or shape and pointers of a single group. Not every implementation supports it.
+    virtual bool IsArgumentUpdateSupported() const { return false; }
+
+    virtual void UpdateArgumentPointers(BaseArgument*,
+                                        std::vector<const void*>&,
+                                        std::vector<const void*>&,
+                                        std::vector<std::array<const void*, NumDTensor>>&,
+                                        std::vector<void*>&) const
+    {
+        throw std::runtime_error("wrong! argument update is not supported by this instance");
+    }
+
+    virtual void UpdateArgumentGroup(BaseArgument*,
+                                     index_t,
+                                     const GemmDesc&,
+                                     const void*,
+                                     const void*,
+                                     const std::array<const void*, NumDTensor>&,
+                                     void*) const
+    {
+        throw std::runtime_error("wrong! argument update is not supported by this instance");
+    }
 };
 
 } // namespace device
@@ -620,6 +620,8 @@ struct DeviceGemmDl : public DeviceGemm<ALayout,
     }
 
     // polymorphic
+    std::optional<GemmSpecialization> GetGemmSpecialization() const override { return GemmSpec; }
+
     virtual std::string GetTypeString() const override
     {
         auto str = std::stringstream();
@@ -232,6 +232,8 @@ struct DeviceGemmDpp : public DeviceGemm<ALayout,
     }
 
     // polymorphic
+    std::optional<GemmSpecialization> GetGemmSpecialization() const override { return GemmSpec; }
+
     std::string GetTypeString() const override
     {
         auto str = std::stringstream();
@@ -566,6 +566,8 @@ struct DeviceGemmWmma_CShuffle : public DeviceGemm<ALayout,
     }
 
     // polymorphic
+    std::optional<GemmSpecialization> GetGemmSpecialization() const override { return GemmSpec; }
+
     std::string GetTypeString() const override
     {
         auto str = std::stringstream();
@@ -262,6 +262,8 @@ struct DeviceGemmXdl : public DeviceGemm<ALayout,
     }
 
     // polymorphic
+    std::optional<GemmSpecialization> GetGemmSpecialization() const override { return GemmSpec; }
+
     std::string GetTypeString() const override
     {
         auto str = std::stringstream();
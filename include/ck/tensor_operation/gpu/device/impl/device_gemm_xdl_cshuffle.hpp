@@ -265,6 +265,8 @@ struct DeviceGemm_Xdl_CShuffle : public DeviceGemm<ALayout,
     }
 
     // polymorphic
+    std::optional<GemmSpecialization> GetGemmSpecialization() const override { return GemmSpec; }
+
     std::string GetTypeString() const override
     {
         auto str = std::stringstream();
@@ -348,6 +348,8 @@ struct DeviceGemm_Xdl_CShuffle_LdsDirectLoad : public DeviceGemm<ALayout,
         return std::make_unique<Invoker>(Invoker{});
     }
 
+    std::optional<GemmSpecialization> GetGemmSpecialization() const override { return GemmSpec; }
+
     std::string GetTypeString() const override
     {
         auto str = std::stringstream();
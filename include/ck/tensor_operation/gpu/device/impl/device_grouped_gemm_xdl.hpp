@@ -4,8 +4,13 @@
 
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <iostream>
+#include <map>
+#include <mutex>
 #include <sstream>
+#include <tuple>
 
 #include "ck/utility/common_header.hpp"
 #include "ck/tensor_description/tensor_descriptor.hpp"
@@ -88,6 +93,63 @@ __global__ void
 #endif
 }
 
+// Token of the last kernel argument upload to every workspace, shared by all DeviceGroupedGemm_Xdl
+// instances. An argument only uploads the kernel arguments changed since its last run if the
+// workspace still holds that upload, any other upload to the workspace in between bumps its token.
+struct GroupedGemmXdlWorkspaceUploads
+{
+    static constexpr std::size_t MaxTrackedWorkspaces = 4096;
+
+    // Token of a new upload to p_workspace
+    static std::uint64_t Record(const void* p_workspace)
+    {
+        std::lock_guard<std::mutex> lock(GetMutex());
+
+        auto& tokens = GetTokens();
+
+        // forgetting a workspace only costs a full upload on its next run
+        if(tokens.size() >= MaxTrackedWorkspaces && tokens.count(p_workspace) == 0)
+        {
+            tokens.clear();
+        }
+
+        return tokens[p_workspace] = ++GetLastToken();
+    }
+
+    // Whether the last upload to p_workspace is the one with this token
+    static bool IsLast(const void* p_workspace, std::uint64_t token)
+    {
+        std::lock_guard<std::mutex> lock(GetMutex());
+
+        const auto& tokens = GetTokens();
+        const auto it      = tokens.find(p_workspace);
+
+        return it != tokens.end() && it->second == token;
+    }
+
+    private:
+    static std::mutex& GetMutex()
+    {
+        static std::mutex mutex;
+
+        return mutex;
+    }
+
+    static std::map<const void*, std::uint64_t>& GetTokens()
+    {
+        static std::map<const void*, std::uint64_t> tokens;
+
+        return tokens;
+    }
+
+    static std::uint64_t& GetLastToken()
+    {
+        static std::uint64_t last_token = 0;
+
+        return last_token;
+    }
+};
+
 template <typename ALayout,
           typename BLayout,
           typename DsLayout,
@@ -356,6 +418,167 @@ struct DeviceGroupedGemm_Xdl : public DeviceGroupedGemm<ALayout,
         ck::index_t BlockStart_, BlockEnd_;
     };
 
+    // Kernel argument of one group with everything that only depends on the problem shape
+    // (descriptors, padding, block-to-e-tile map) already built. Pointers are left null and the
+    // block range starts at 0, they are patched in when the group is placed into an Argument.
+    struct GemmKernelArgCacheEntry
+    {
+        GemmBiasTransKernelArg karg_;
+        index_t grid_size_;
+        bool valid_;
+    };
+
+    struct GemmShapeKey
+    {
+        index_t M_, N_, K_;
+        index_t stride_A_, stride_B_, stride_C_;
+        std::array<index_t, NumDTensor> stride_Ds_;
+
+        bool operator<(const GemmShapeKey& rhs) const
+        {
+            return std::tie(M_, N_, K_, stride_A_, stride_B_, stride_C_, stride_Ds_) <
+                   std::tie(rhs.M_,
+                            rhs.N_,
+                            rhs.K_,
+                            rhs.stride_A_,
+                            rhs.stride_B_,
+                            rhs.stride_C_,
+                            rhs.stride_Ds_);
+        }
+
+        bool operator==(const GemmShapeKey& rhs) const
+        {
+            return !(*this < rhs) && !(rhs < *this);
+        }
+    };
+
+    // upper bound on the number of distinct shapes kept by the host-side descriptor cache
+    static constexpr std::size_t MaxCachedGemmShapes = 4096;
+
+    static GemmShapeKey MakeGemmShapeKey(const GemmDesc& gemm_desc)
+    {
+        GemmShapeKey key{gemm_desc.M_,
+                         gemm_desc.N_,
+                         gemm_desc.K_,
+                         gemm_desc.stride_A_,
+                         gemm_desc.stride_B_,
+                         gemm_desc.stride_C_,
+                         {}};
+
+        static_for<0, NumDTensor, 1>{}(
+            [&](auto j) { key.stride_Ds_[j] = gemm_desc.stride_Ds_[j]; });
+
+        return key;
+    }
+
+    static GemmKernelArgCacheEntry MakeGemmKernelArgCacheEntry(const GemmShapeKey& key)
+    {
+        const index_t M = key.M_;
+        const index_t N = key.N_;
+        const index_t K = key.K_;
+
+        // tensor descriptors for problem definiton
+        const auto a_grid_desc_m_k = DeviceOp::MakeAGridDescriptor_M_K(M, K, key.stride_A_);
+        const auto b_grid_desc_n_k = DeviceOp::MakeBGridDescriptor_N_K(K, N, key.stride_B_);
+
+        DsGridDesc_M_N ds_grid_desc_m_n;
+
+        static_for<0, NumDTensor, 1>{}([&](auto j) {
+            using DLayout = remove_cvref_t<tuple_element_t<j.value, DsLayout>>;
+
+            ds_grid_desc_m_n(j) =
+                DeviceOp::MakeEGridDescriptor_M_N<DLayout>(M, N, key.stride_Ds_[j]);
+        });
+
+        const auto e_grid_desc_m_n =
+            DeviceOp::MakeEGridDescriptor_M_N<ELayout>(M, N, key.stride_C_);
+
+        // tensor descriptors for block/thread-wise copy
+        const auto a_grid_desc_ak0_m_ak1 =
+            GridwiseGemm::MakeDefaultAGridDescriptor_AK0_M_AK1(a_grid_desc_m_k);
+
+        const auto b_grid_desc_bk0_n_bk1 =
+            GridwiseGemm::MakeDefaultBGridDescriptor_BK0_N_BK1(b_grid_desc_n_k);
+
+        // block-to-e-tile map
+        const auto block_2_etile_map = GroupedGemmBlock2ETileMap(e_grid_desc_m_n, 0);
+
+        const index_t grid_size_grp =
+            block_2_etile_map.block_2_etile_map_.CalculateGridSize(e_grid_desc_m_n);
+
+        GemmKernelArgCacheEntry entry{};
+
+        entry.grid_size_ = grid_size_grp;
+        entry.valid_     = GridwiseGemm::CheckValidity(
+            a_grid_desc_m_k, b_grid_desc_n_k, ds_grid_desc_m_n, e_grid_desc_m_n, block_2_etile_map);
+
+        if(entry.valid_)
+        {
+            DsGridDesc_MBlock_MPerBlock_NBlock_NPerBlock
+                ds_grid_desc_mblock_mperblock_nblock_nperblock;
+
+            static_for<0, NumDTensor, 1>{}([&](auto j) {
+                ds_grid_desc_mblock_mperblock_nblock_nperblock(j) =
+                    GridwiseGemm::MakeEGridDescriptor_MBlock_MPerBlock_NBlock_NPerBlock(
+                        ds_grid_desc_m_n[j]);
+            });
+
+            const auto e_grid_desc_mblock_mperblock_nblock_nperblock =
+                GridwiseGemm::MakeEGridDescriptor_MBlock_MPerBlock_NBlock_NPerBlock(
+                    e_grid_desc_m_n);
+
+            entry.karg_ = GemmBiasTransKernelArg{nullptr,
+                                                 nullptr,
+                                                 typename GridwiseGemm::DsGridPointer{},
+                                                 nullptr,
+                                                 a_grid_desc_m_k,
+                                                 b_grid_desc_n_k,
+                                                 ds_grid_desc_m_n,
+                                                 e_grid_desc_m_n,
+                                                 a_grid_desc_ak0_m_ak1,
+                                                 b_grid_desc_bk0_n_bk1,
+                                                 ds_grid_desc_mblock_mperblock_nblock_nperblock,
+                                                 e_grid_desc_mblock_mperblock_nblock_nperblock,
+                                                 block_2_etile_map,
+                                                 0,
+                                                 grid_size_grp};
+        }
+
+        return entry;
+    }
+
+    // Shapes repeat across calls (e.g. MoE serving issues the same expert shapes every step), so
+    // descriptor construction is cached per DeviceOp keyed on the problem shape.
+    static GemmKernelArgCacheEntry GetGemmKernelArgCacheEntry(const GemmShapeKey& key)
+    {
+        static std::mutex cache_mutex;
+        static std::map<GemmShapeKey, GemmKernelArgCacheEntry> cache;
+
+        {
+            std::lock_guard<std::mutex> lock(cache_mutex);
+
+            const auto it = cache.find(key);
+
+            if(it != cache.end())
+            {
+                return it->second;
+            }
+        }
+
+        const auto entry = MakeGemmKernelArgCacheEntry(key);
+
+        std::lock_guard<std::mutex> lock(cache_mutex);
+
+        if(cache.size() >= MaxCachedGemmShapes)
+        {
+            cache.clear();
+        }
+
+        cache.emplace(key, entry);
+
+        return entry;
+    }
+
     // Argument
     struct Argument : public BaseArgument
     {
@@ -369,8 +592,6 @@ struct DeviceGroupedGemm_Xdl : public DeviceGroupedGemm<ALayout,
                  CDEElementwiseOperation c_element_op)
             : a_element_op_{a_element_op}, b_element_op_{b_element_op}, c_element_op_{c_element_op}
         {
-            grid_size_ = 0;
-
             group_count_ = ck::type_convert<ck::index_t>(gemm_descs.size());
 
             if(!(group_count_ == ck::type_convert<ck::index_t>(p_As.size()) &&
@@ -380,115 +601,279 @@ struct DeviceGroupedGemm_Xdl : public DeviceGroupedGemm<ALayout,
                 throw std::runtime_error("wrong! group_count_ != p_As/b/c.size");
             }
 
-            gemm_desc_kernel_arg_.reserve(group_count_);
+            if(NumDTensor > 0 && group_count_ != ck::type_convert<ck::index_t>(p_Ds.size()))
+            {
+                throw std::runtime_error("wrong! group_count_ != p_Ds.size");
+            }
+
+            p_As_ = p_As;
+            p_Bs_ = p_Bs;
+            p_Ds_ = p_Ds;
+            p_Es_ = p_Es;
+
+            shape_keys_.reserve(group_count_);
 
+            for(const auto& gemm_desc : gemm_descs)
+            {
+                shape_keys_.push_back(DeviceOp::MakeGemmShapeKey(gemm_desc));
+            }
+
+            BuildKernelArgs();
+        }
+
+        // Replace the tensor pointers of all groups while keeping the problem shapes. No
+        // descriptor is rebuilt, only the groups whose pointers changed are uploaded again on the
+        // next Invoker::Run.
+        void UpdatePointers(const std::vector<const void*>& p_As,
+                            const std::vector<const void*>& p_Bs,
+                            const std::vector<std::array<const void*, NumDTensor>>& p_Ds,
+                            const std::vector<void*>& p_Es)
+        {
+            if(!(group_count_ == ck::type_convert<ck::index_t>(p_As.size()) &&
+                 group_count_ == ck::type_convert<ck::index_t>(p_Bs.size()) &&
+                 group_count_ == ck::type_convert<ck::index_t>(p_Es.size())))
+            {
+                throw std::runtime_error("wrong! group_count_ != p_As/b/c.size");
+            }
+
+            if(NumDTensor > 0 && group_count_ != ck::type_convert<ck::index_t>(p_Ds.size()))
+            {
+                throw std::runtime_error("wrong! group_count_ != p_Ds.size");
+            }
+
+            for(index_t i = 0; i < group_count_; ++i)
+            {
+                const std::array<const void*, NumDTensor> p_ds =
+                    NumDTensor > 0 ? p_Ds[i] : std::array<const void*, NumDTensor>{};
+
+                SetGroupPointers(i, p_As[i], p_Bs[i], p_ds, p_Es[i]);
+            }
+        }
+
+        // Replace shape and pointers of a single group. Groups with an unchanged shape only get
+        // their pointers patched, otherwise the descriptors of this group are taken from the
+        // shape cache and the block ranges of the following groups are shifted.
+        void UpdateGroup(index_t group_id,
+                         const GemmDesc& gemm_desc,
+                         const void* p_a,
+                         const void* p_b,
+                         const std::array<const void*, NumDTensor>& p_ds,
+                         void* p_e)
+        {
+            if(group_id < 0 || group_id >= group_count_)
+            {
+                throw std::runtime_error("wrong! group_id out of range");
+            }
+
+            const auto key = DeviceOp::MakeGemmShapeKey(gemm_desc);
+
+            if(key == shape_keys_[group_id])
+            {
+                SetGroupPointers(group_id, p_a, p_b, p_ds, p_e);
+
+                return;
+            }
+
+            shape_keys_[group_id] = key;
+            p_As_[group_id]       = p_a;
+            p_Bs_[group_id]       = p_b;
+            p_Es_[group_id]       = p_e;
+
+            if constexpr(NumDTensor > 0)
+            {
+                p_Ds_[group_id] = p_ds;
+            }
+
+            a_mtx_mraw_kraw_[group_id] = Tuple<index_t, index_t>(key.M_, key.K_);
+            b_mtx_nraw_kraw_[group_id] = Tuple<index_t, index_t>(key.N_, key.K_);
+
+            const index_t karg_id = group_karg_id_[group_id];
+
+            const auto entry = key.M_ == 0 ? GemmKernelArgCacheEntry{}
+                                           : DeviceOp::GetGemmKernelArgCacheEntry(key);
+
+            // the set of groups present in gemm_desc_kernel_arg_ changes, repack everything
+            if(karg_id < 0 || !entry.valid_)
+            {
+                BuildKernelArgs();
+
+                return;
+            }
+
+            auto& karg = gemm_desc_kernel_arg_[karg_id];
+
+            karg = entry.karg_;
+
+            SetKernelArgPointers(karg, group_id);
+
+            // shift the block ranges of this and all following groups
+            index_t block_start = karg_id == 0 ? 0 : gemm_desc_kernel_arg_[karg_id - 1].BlockEnd_;
+
+            for(std::size_t k = karg_id; k < gemm_desc_kernel_arg_.size(); ++k)
+            {
+                auto& karg_k = gemm_desc_kernel_arg_[k];
+
+                const index_t grid_size_grp = karg_k.BlockEnd_ - karg_k.BlockStart_;
+
+                SetKernelArgBlockRange(karg_k, block_start, grid_size_grp);
+
+                block_start += grid_size_grp;
+            }
+
+            grid_size_ = block_start;
+
+            UpdateHasMainKBlockLoop();
+            MarkKernelArgsDirty(karg_id, gemm_desc_kernel_arg_.size());
+        }
+
+        // Range [begin, end) of gemm_desc_kernel_arg_ that is not yet in the workspace
+        std::pair<std::size_t, std::size_t> GetDirtyKernelArgRange() const
+        {
+            if(upload_token_ == 0 ||
+               !GroupedGemmXdlWorkspaceUploads::IsLast(p_workspace_, upload_token_))
+            {
+                return {0, gemm_desc_kernel_arg_.size()};
+            }
+
+            return {dirty_karg_begin_, dirty_karg_end_};
+        }
+
+        void MarkKernelArgsSynced() const
+        {
+            upload_token_     = GroupedGemmXdlWorkspaceUploads::Record(p_workspace_);
+            dirty_karg_begin_ = 0;
+            dirty_karg_end_   = 0;
+        }
+
+        //  private:
+        void BuildKernelArgs()
+        {
+            grid_size_           = 0;
             skipped_group_count_ = 0;
 
-            for(std::size_t i = 0; i < gemm_descs.size(); i++)
+            gemm_desc_kernel_arg_.clear();
+            a_mtx_mraw_kraw_.clear();
+            b_mtx_nraw_kraw_.clear();
+
+            gemm_desc_kernel_arg_.reserve(group_count_);
+            a_mtx_mraw_kraw_.reserve(group_count_);
+            b_mtx_nraw_kraw_.reserve(group_count_);
+
+            group_karg_id_.assign(group_count_, -1);
+
+            for(index_t i = 0; i < group_count_; i++)
             {
-                const index_t M = gemm_descs[i].M_;
-                const index_t N = gemm_descs[i].N_;
-                const index_t K = gemm_descs[i].K_;
+                const auto& key = shape_keys_[i];
 
-                a_mtx_mraw_kraw_.emplace_back(M, K);
-                b_mtx_nraw_kraw_.emplace_back(N, K);
+                a_mtx_mraw_kraw_.emplace_back(key.M_, key.K_);
+                b_mtx_nraw_kraw_.emplace_back(key.N_, key.K_);
 
-                if(M == 0)
+                if(key.M_ == 0)
                 {
                     skipped_group_count_++;
                     continue;
                 }
 
-                const index_t StrideA = gemm_descs[i].stride_A_;
-                const index_t StrideB = gemm_descs[i].stride_B_;
-                const index_t StrideC = gemm_descs[i].stride_C_;
+                const auto entry = DeviceOp::GetGemmKernelArgCacheEntry(key);
+
+                if(entry.valid_)
+                {
+                    auto karg = entry.karg_;
+
+                    SetKernelArgPointers(karg, i);
+                    SetKernelArgBlockRange(karg, grid_size_, entry.grid_size_);
+
+                    group_karg_id_[i] = ck::type_convert<index_t>(gemm_desc_kernel_arg_.size());
+
+                    gemm_desc_kernel_arg_.push_back(karg);
 
-                // pointer
-                typename GridwiseGemm::DsGridPointer p_ds_grid{};
+                    grid_size_ += entry.grid_size_;
+                }
+            }
 
-                static_for<0, NumDTensor, 1>{}([&](auto j) {
-                    using DDataType = remove_cvref_t<tuple_element_t<j.value, DsDataType>>;
+            UpdateHasMainKBlockLoop();
+            MarkKernelArgsDirty(0, gemm_desc_kernel_arg_.size());
+        }
 
-                    p_ds_grid(j) = static_cast<const DDataType*>(p_Ds[i][j]);
-                });
+        void SetGroupPointers(index_t group_id,
+                              const void* p_a,
+                              const void* p_b,
+                              const std::array<const void*, NumDTensor>& p_ds,
+                              void* p_e)
+        {
+            bool changed =
+                p_As_[group_id] != p_a || p_Bs_[group_id] != p_b || p_Es_[group_id] != p_e;
 
-                // tensor descriptors for problem definiton
-                const auto a_grid_desc_m_k = DeviceOp::MakeAGridDescriptor_M_K(M, K, StrideA);
-                const auto b_grid_desc_n_k = DeviceOp::MakeBGridDescriptor_N_K(K, N, StrideB);
+            p_As_[group_id] = p_a;
+            p_Bs_[group_id] = p_b;
+            p_Es_[group_id] = p_e;
 
-                DsGridDesc_M_N ds_grid_desc_m_n;
+            if constexpr(NumDTensor > 0)
+            {
+                changed = changed || p_Ds_[group_id] != p_ds;
 
-                static_for<0, NumDTensor, 1>{}([&](auto j) {
-                    using DLayout = remove_cvref_t<tuple_element_t<j.value, DsLayout>>;
+                p_Ds_[group_id] = p_ds;
+            }
 
-                    ds_grid_desc_m_n(j) = DeviceOp::MakeEGridDescriptor_M_N<DLayout>(
-                        M, N, gemm_descs[i].stride_Ds_[j]);
-                });
+            const index_t karg_id = group_karg_id_[group_id];
 
-                const auto e_grid_desc_m_n =
-                    DeviceOp::MakeEGridDescriptor_M_N<ELayout>(M, N, StrideC);
+            if(changed && karg_id >= 0)
+            {
+                SetKernelArgPointers(gemm_desc_kernel_arg_[karg_id], group_id);
+                MarkKernelArgsDirty(karg_id, karg_id + 1);
+            }
+        }
 
-                // tensor descriptors for block/thread-wise copy
-                const auto a_grid_desc_ak0_m_ak1 =
-                    GridwiseGemm::MakeDefaultAGridDescriptor_AK0_M_AK1(a_grid_desc_m_k);
+        void SetKernelArgPointers(GemmBiasTransKernelArg& karg, index_t group_id) const
+        {
+            karg.a_ptr_ = static_cast<const ADataType*>(p_As_[group_id]);
+            karg.b_ptr_ = static_cast<const BDataType*>(p_Bs_[group_id]);
+            karg.e_ptr_ = static_cast<EDataType*>(p_Es_[group_id]);
 
-                const auto b_grid_desc_bk0_n_bk1 =
-                    GridwiseGemm::MakeDefaultBGridDescriptor_BK0_N_BK1(b_grid_desc_n_k);
+            static_for<0, NumDTensor, 1>{}([&](auto j) {
+                using DDataType = remove_cvref_t<tuple_element_t<j.value, DsDataType>>;
 
-                const index_t grid_size_grp =
-                    GroupedGemmBlock2ETileMap(e_grid_desc_m_n, 0)
-                        .block_2_etile_map_.CalculateGridSize(e_grid_desc_m_n);
+                karg.ds_ptr_(j) = static_cast<const DDataType*>(p_Ds_[group_id][j]);
+            });
+        }
 
-                const index_t BlockStart = grid_size_;
-                const index_t BlockEnd   = grid_size_ + grid_size_grp;
+        static void SetKernelArgBlockRange(GemmBiasTransKernelArg& karg,
+                                           index_t block_start,
+                                           index_t grid_size_grp)
+        {
+            karg.block_2_etile_map_.BlockStart_ = block_start;
+            karg.BlockStart_                    = block_start;
+            karg.BlockEnd_                      = block_start + grid_size_grp;
+        }
 
-                grid_size_ += grid_size_grp;
+        void UpdateHasMainKBlockLoop()
+        {
+            all_has_main_k_block_loop_ = true;
 
-                // block-to-e-tile map
-                const auto block_2_etile_map =
-                    GroupedGemmBlock2ETileMap(e_grid_desc_m_n, BlockStart);
+            for(const auto& karg : gemm_desc_kernel_arg_)
+            {
+                const auto K = karg.a_grid_desc_ak0_m_ak1_.GetLength(I0) *
+                               karg.a_grid_desc_ak0_m_ak1_.GetLength(I2);
 
-                if(GridwiseGemm::CheckValidity(a_grid_desc_m_k,
-                                               b_grid_desc_n_k,
-                                               ds_grid_desc_m_n,
-                                               e_grid_desc_m_n,
-                                               block_2_etile_map))
-                {
-                    // tensor descriptors for block/thread-wise copy
-                    DsGridDesc_MBlock_MPerBlock_NBlock_NPerBlock
-                        ds_grid_desc_mblock_mperblock_nblock_nperblock;
-
-                    static_for<0, NumDTensor, 1>{}([&](auto j) {
-                        ds_grid_desc_mblock_mperblock_nblock_nperblock(j) =
-                            GridwiseGemm::MakeEGridDescriptor_MBlock_MPerBlock_NBlock_NPerBlock(
-                                ds_grid_desc_m_n[j]);
-                    });
-
-                    const auto e_grid_desc_mblock_mperblock_nblock_nperblock =
-                        GridwiseGemm::MakeEGridDescriptor_MBlock_MPerBlock_NBlock_NPerBlock(
-                            e_grid_desc_m_n);
-
-                    gemm_desc_kernel_arg_.push_back(
-                        GemmBiasTransKernelArg{static_cast<const ADataType*>(p_As[i]),
-                                               static_cast<const BDataType*>(p_Bs[i]),
-                                               p_ds_grid,
-                                               static_cast<EDataType*>(p_Es[i]),
-                                               a_grid_desc_m_k,
-                                               b_grid_desc_n_k,
-                                               ds_grid_desc_m_n,
-                                               e_grid_desc_m_n,
-                                               a_grid_desc_ak0_m_ak1,
-                                               b_grid_desc_bk0_n_bk1,
-                                               ds_grid_desc_mblock_mperblock_nblock_nperblock,
-                                               e_grid_desc_mblock_mperblock_nblock_nperblock,
-                                               block_2_etile_map,
-                                               BlockStart,
-                                               BlockEnd});
-                }
+                all_has_main_k_block_loop_ =
+                    all_has_main_k_block_loop_ && GridwiseGemm::CalculateHasMainKBlockLoop(K);
+            }
+        }
+
+        void MarkKernelArgsDirty(std::size_t begin, std::size_t end)
+        {
+            if(dirty_karg_begin_ == dirty_karg_end_)
+            {
+                dirty_karg_begin_ = begin;
+                dirty_karg_end_   = end;
+            }
+            else
+            {
+                dirty_karg_begin_ = std::min(dirty_karg_begin_, begin);
+                dirty_karg_end_   = std::max(dirty_karg_end_, end);
             }
         }
 
-        //  private:
         index_t group_count_;
         index_t skipped_group_count_;
 
@@ -500,7 +885,25 @@ struct DeviceGroupedGemm_Xdl : public DeviceGroupedGemm<ALayout,
         std::vector<Tuple<index_t, index_t>> a_mtx_mraw_kraw_;
         std::vector<Tuple<index_t, index_t>> b_mtx_nraw_kraw_;
 
+        // per-group problem state kept for incremental updates
+        std::vector<GemmShapeKey> shape_keys_;
+        std::vector<const void*> p_As_;
+        std::vector<const void*> p_Bs_;
+        std::vector<std::array<const void*, NumDTensor>> p_Ds_;
+        std::vector<void*> p_Es_;
+
+        // index into gemm_desc_kernel_arg_ of each group, -1 for skipped/invalid groups
+        std::vector<index_t> group_karg_id_;
+
         index_t grid_size_;
+
+        bool all_has_main_k_block_loop_;
+
+        // token of the last upload of the kernel arguments, 0 if there was none; the arguments
+        // outside the dirty range do not have to be copied again while the workspace holds it
+        mutable std::uint64_t upload_token_   = 0;
+        mutable std::size_t dirty_karg_begin_ = 0;
+        mutable std::size_t dirty_karg_end_   = 0;
     };
 
     // Invoker
@@ -510,11 +913,13 @@ struct DeviceGroupedGemm_Xdl : public DeviceGroupedGemm<ALayout,
 
         float Run(const Argument& arg, const StreamConfig& stream_config = StreamConfig{})
         {
-            bool has_main_k_block_loop = true;
+            // descriptors are validated when the argument is built or updated, there is nothing
+            // left to check per group here
+            const bool has_main_k_block_loop = true;
 
+#if DEBUG_LOG
             for(std::size_t i = 0; i < arg.gemm_desc_kernel_arg_.size(); i++)
             {
-#if DEBUG_LOG
                 std::cout << "group: " << i << " arg.a_grid_desc_ak0_m_ak1_{"
                           << arg.gemm_desc_kernel_arg_[i].a_grid_desc_ak0_m_ak1_.GetLength(I0)
                           << ", "
@@ -535,33 +940,28 @@ struct DeviceGroupedGemm_Xdl : public DeviceGroupedGemm<ALayout,
                           << arg.gemm_desc_kernel_arg_[i].e_grid_desc_m_n_.GetLength(I0) << ", "
                           << arg.gemm_desc_kernel_arg_[i].e_grid_desc_m_n_.GetLength(I1) << "}"
                           << std::endl;
+            }
 #endif
 
-                if(!GridwiseGemm::CheckValidity(arg.gemm_desc_kernel_arg_[i].a_grid_desc_m_k_,
-                                                arg.gemm_desc_kernel_arg_[i].b_grid_desc_n_k_,
-                                                arg.gemm_desc_kernel_arg_[i].ds_grid_desc_m_n_,
-                                                arg.gemm_desc_kernel_arg_[i].e_grid_desc_m_n_,
-                                                arg.gemm_desc_kernel_arg_[i].block_2_etile_map_))
-                {
-                    throw std::runtime_error(
-                        "wrong! GridwiseGemm_k0mk1_k0nk1_mn_xdlops_v2r3 has invalid setting");
-                }
+            if(!arg.all_has_main_k_block_loop_)
+            {
+                throw std::runtime_error("wrong! not all gemm has_main_k_block_loop");
+            }
 
-                const auto K = arg.gemm_desc_kernel_arg_[i].a_grid_desc_ak0_m_ak1_.GetLength(I0) *
-                               arg.gemm_desc_kernel_arg_[i].a_grid_desc_ak0_m_ak1_.GetLength(I2);
+            // only upload the kernel arguments that changed since the last run on this workspace
+            const auto dirty_range = arg.GetDirtyKernelArgRange();
 
-                if(GridwiseGemm::CalculateHasMainKBlockLoop(K) != has_main_k_block_loop)
-                {
-                    throw std::runtime_error("wrong! not all gemm has_main_k_block_loop");
-                }
+            if(dirty_range.first < dirty_range.second)
+            {
+                hipGetErrorString(hipMemcpyWithStream(
+                    static_cast<GemmBiasTransKernelArg*>(arg.p_workspace_) + dirty_range.first,
+                    arg.gemm_desc_kernel_arg_.data() + dirty_range.first,
+                    (dirty_range.second - dirty_range.first) * sizeof(GemmBiasTransKernelArg),
+                    hipMemcpyHostToDevice,
+                    stream_config.stream_id_));
             }
 
-            hipGetErrorString(hipMemcpyWithStream(arg.p_workspace_,
-                                                  arg.gemm_desc_kernel_arg_.data(),
-                                                  arg.gemm_desc_kernel_arg_.size() *
-                                                      sizeof(GemmBiasTransKernelArg),
-                                                  hipMemcpyHostToDevice,
-                                                  stream_config.stream_id_));
+            arg.MarkKernelArgsSynced();
 
             float ave_time = 0;
 
@@ -664,6 +1064,31 @@ struct DeviceGroupedGemm_Xdl : public DeviceGroupedGemm<ALayout,
 
     static auto MakeInvoker() { return Invoker{}; }
 
+    // polymorphic
+    bool IsArgumentUpdateSupported() const override { return true; }
+
+    // polymorphic
+    void UpdateArgumentPointers(BaseArgument* p_arg,
+                                std::vector<const void*>& p_As,
+                                std::vector<const void*>& p_Bs,
+                                std::vector<std::array<const void*, NumDTensor>>& p_Ds,
+                                std::vector<void*>& p_Es) const override
+    {
+        dynamic_cast<Argument*>(p_arg)->UpdatePointers(p_As, p_Bs, p_Ds, p_Es);
+    }
+
+    // polymorphic
+    void UpdateArgumentGroup(BaseArgument* p_arg,
+                             index_t group_id,
+                             const GemmDesc& gemm_desc,
+                             const void* p_a,
+                             const void* p_b,
+                             const std::array<const void*, NumDTensor>& p_ds,
+                             void* p_e) const override
+    {
+        dynamic_cast<Argument*>(p_arg)->UpdateGroup(group_id, gemm_desc, p_a, p_b, p_ds, p_e);
+    }
+
     // polymorphic
     std::unique_ptr<BaseArgument>
     MakeArgumentPointer(std::vector<const void*>& p_As,
@@ -718,6 +1143,17 @@ struct DeviceGroupedGemm_Xdl : public DeviceGroupedGemm<ALayout,
     {
         return dynamic_cast<const Argument*>(p_arg)->group_count_ * sizeof(GemmBiasTransKernelArg);
     }
+
+    void SetWorkSpacePointer(BaseArgument* p_arg,
+                             void* p_workspace,
+                             const StreamConfig& = StreamConfig{}) const override
+    {
+        auto p_arg_ = dynamic_cast<Argument*>(p_arg);
+
+        // the workspace may have been written by anything since, upload everything on next run
+        p_arg_->p_workspace_  = p_workspace;
+        p_arg_->upload_token_ = 0;
+    }
 };
 
 } // namespace device
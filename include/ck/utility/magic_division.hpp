@@ -13,15 +13,15 @@ namespace ck {
 
 // magic number division
 // Caution:
-//   1. For uint32_t as dividend: magic number division implementation being used would produce
-//   correct result if the dividend is uint32_t and its value is within 31-bit value range.
-//   2. For int32_t as dividendd: magic number division for int32_t dividened has not been
-//   implemented, the int32_t dividend would be bit-wise interpreted as uint32_t and magic number
-//   division implementation for uint32_t is then used. Therefore, dividend value need to be
-//   non-negative.
-// TODO:
-//   1. Implement magic number divison for int32_t
-//   2. Implement magic number divison for unit32_t with 32-bit value range
+//   1. For uint32_t as dividend: DoMagicDivision would produce correct result if the dividend is
+//   uint32_t and its value is within 31-bit value range. Use DoMagicDivisionFullRange together with
+//   CalculateMagicNumbersFullRange for the full 32-bit value range of dividend and divisor.
+//   2. For int32_t as dividendd: DoMagicDivision bit-wise interprets the int32_t dividend as
+//   uint32_t and uses the magic number division implementation for uint32_t. Therefore, dividend
+//   value need to be non-negative. DoMagicDivisionFullRange(int32_t, ...) handles negative
+//   dividends, rounding toward zero like operator/.
+//   3. For 64-bit dividend (e.g. long_index_t offset): use CalculateMagicNumbers64 and
+//   DoMagicDivision64.
 struct MagicDivision
 {
     // uint32_t
@@ -155,6 +155,103 @@ struct MagicDivision
         uint32_t tmp          = static_cast<uint64_t>(dividend_u32) * multiplier >> 32;
         return (tmp + dividend_u32) >> shift;
     }
+    // full range magic division for uint32_t
+    // divisor in [1, UINT32_MAX], the multiplier is the low 32 bits of a 33-bit multiplier
+    __host__ __device__ static constexpr auto CalculateMagicNumbersFullRange(uint32_t divisor)
+    {
+        if(divisor >= 1)
+        {
+            uint32_t shift = 0;
+            while(shift < 32 && (uint64_t{1} << shift) < divisor)
+            {
+                ++shift;
+            }
+
+            uint64_t one        = 1;
+            uint64_t multiplier = ((one << 32) * ((one << shift) - divisor)) / divisor + 1;
+
+            return make_tuple(uint32_t(multiplier), shift);
+        }
+        else
+        {
+            return make_tuple(uint32_t(0), uint32_t(0));
+        }
+    }
+
+    __device__ static constexpr uint32_t
+    DoMagicDivisionFullRange(uint32_t dividend, uint32_t multiplier, uint32_t shift)
+    {
+        uint32_t tmp = __umulhi(dividend, multiplier);
+        return shift == 0 ? dividend : (tmp + ((dividend - tmp) >> 1)) >> (shift - 1);
+    }
+
+    __host__ static constexpr uint32_t
+    DoMagicDivisionFullRange(uint32_t dividend, uint32_t multiplier, uint32_t shift)
+    {
+        uint32_t tmp = static_cast<uint64_t>(dividend) * multiplier >> 32;
+        return shift == 0 ? dividend : (tmp + ((dividend - tmp) >> 1)) >> (shift - 1);
+    }
+
+    // magic number of a positive divisor, quotient rounds toward zero
+    __host__ __device__ static constexpr int32_t
+    DoMagicDivisionFullRange(int32_t dividend_i32, uint32_t multiplier, uint32_t shift)
+    {
+        // branchless |dividend| and sign restore, sign is 0 or all ones
+        uint32_t sign         = static_cast<uint32_t>(dividend_i32 >> 31);
+        uint32_t dividend_u32 = (static_cast<uint32_t>(dividend_i32) ^ sign) - sign;
+        uint32_t quotient_u32 = DoMagicDivisionFullRange(dividend_u32, multiplier, shift);
+
+        return static_cast<int32_t>((quotient_u32 ^ sign) - sign);
+    }
+
+    // magic division for uint64_t
+    // divisor in [1, UINT64_MAX], the multiplier is the low 64 bits of a 65-bit multiplier
+    __host__ __device__ static constexpr auto CalculateMagicNumbers64(uint64_t divisor)
+    {
+        if(divisor >= 1)
+        {
+            uint32_t shift = 0;
+            while(shift < 64 && (static_cast<unsigned __int128>(1) << shift) < divisor)
+            {
+                ++shift;
+            }
+
+            unsigned __int128 one = 1;
+            unsigned __int128 multiplier =
+                ((one << 64) * ((one << shift) - divisor)) / divisor + 1;
+
+            return make_tuple(uint64_t(multiplier), shift);
+        }
+        else
+        {
+            return make_tuple(uint64_t(0), uint32_t(0));
+        }
+    }
+
+    __device__ static constexpr uint64_t
+    DoMagicDivision64(uint64_t dividend, uint64_t multiplier, uint32_t shift)
+    {
+        uint64_t tmp = __umul64hi(dividend, multiplier);
+        return shift == 0 ? dividend : (tmp + ((dividend - tmp) >> 1)) >> (shift - 1);
+    }
+
+    __host__ static constexpr uint64_t
+    DoMagicDivision64(uint64_t dividend, uint64_t multiplier, uint32_t shift)
+    {
+        uint64_t tmp = static_cast<unsigned __int128>(dividend) * multiplier >> 64;
+        return shift == 0 ? dividend : (tmp + ((dividend - tmp) >> 1)) >> (shift - 1);
+    }
+
+    // magic number of a positive divisor, quotient rounds toward zero
+    __host__ __device__ static constexpr int64_t
+    DoMagicDivision64(int64_t dividend_i64, uint64_t multiplier, uint32_t shift)
+    {
+        uint64_t sign         = static_cast<uint64_t>(dividend_i64 >> 63);
+        uint64_t dividend_u64 = (static_cast<uint64_t>(dividend_i64) ^ sign) - sign;
+        uint64_t quotient_u64 = DoMagicDivision64(dividend_u64, multiplier, shift);
+
+        return static_cast<int64_t>((quotient_u64 ^ sign) - sign);
+    }
 };
 
 struct MDiv
@@ -229,4 +326,115 @@ struct MDiv2
     }
 };
 
+// full 32-bit range of dividend and divisor
+struct MDivFullRange
+{
+    uint32_t divisor;
+    uint32_t multiplier;
+    uint32_t shift;
+
+    // prefer construct on host
+    __host__ __device__ MDivFullRange(uint32_t divisor_) : divisor(divisor_)
+    {
+        auto tmp = MagicDivision::CalculateMagicNumbersFullRange(divisor_);
+
+        multiplier = tmp[Number<0>{}];
+        shift      = tmp[Number<1>{}];
+    }
+
+    __host__ __device__ MDivFullRange() : divisor(0), multiplier(0), shift(0) {}
+
+    __host__ __device__ uint32_t div(uint32_t dividend_) const
+    {
+        return MagicDivision::DoMagicDivisionFullRange(dividend_, multiplier, shift);
+    }
+
+    __host__ __device__ void
+    divmod(uint32_t dividend_, uint32_t& quotient_, uint32_t& remainder_) const
+    {
+        quotient_  = div(dividend_);
+        remainder_ = dividend_ - (quotient_ * divisor);
+    }
+
+    __host__ __device__ uint32_t get() const { return divisor; }
+};
+
+// signed 32-bit dividend and divisor, same result as operator/ and operator%
+struct MDivSigned
+{
+    int32_t divisor;
+    uint32_t multiplier;
+    uint32_t shift;
+
+    // prefer construct on host
+    __host__ __device__ MDivSigned(int32_t divisor_) : divisor(divisor_)
+    {
+        auto tmp = MagicDivision::CalculateMagicNumbersFullRange(
+            divisor_ < 0 ? 0U - static_cast<uint32_t>(divisor_) : static_cast<uint32_t>(divisor_));
+
+        multiplier = tmp[Number<0>{}];
+        shift      = tmp[Number<1>{}];
+    }
+
+    __host__ __device__ MDivSigned() : divisor(0), multiplier(0), shift(0) {}
+
+    __host__ __device__ int32_t div(int32_t dividend_) const
+    {
+        uint32_t sign = static_cast<uint32_t>(divisor >> 31);
+        uint32_t quotient =
+            MagicDivision::DoMagicDivisionFullRange(dividend_, multiplier, shift);
+
+        return static_cast<int32_t>((quotient ^ sign) - sign);
+    }
+
+    __host__ __device__ void divmod(int32_t dividend_, int32_t& quotient_, int32_t& remainder_) const
+    {
+        quotient_  = div(dividend_);
+        remainder_ = static_cast<int32_t>(static_cast<uint32_t>(dividend_) -
+                                          static_cast<uint32_t>(quotient_) *
+                                              static_cast<uint32_t>(divisor));
+    }
+
+    __host__ __device__ int32_t get() const { return divisor; }
+};
+
+// 64-bit signed dividend and divisor, e.g. long_index_t offsets of tensors larger than 2GB
+struct MDiv64
+{
+    int64_t divisor;
+    uint64_t multiplier;
+    uint32_t shift;
+
+    // prefer construct on host
+    __host__ __device__ MDiv64(int64_t divisor_) : divisor(divisor_)
+    {
+        auto tmp = MagicDivision::CalculateMagicNumbers64(
+            divisor_ < 0 ? uint64_t{0} - static_cast<uint64_t>(divisor_)
+                         : static_cast<uint64_t>(divisor_));
+
+        multiplier = tmp[Number<0>{}];
+        shift      = tmp[Number<1>{}];
+    }
+
+    __host__ __device__ MDiv64() : divisor(0), multiplier(0), shift(0) {}
+
+    __host__ __device__ int64_t div(int64_t dividend_) const
+    {
+        uint64_t sign     = static_cast<uint64_t>(divisor >> 63);
+        uint64_t quotient = MagicDivision::DoMagicDivision64(dividend_, multiplier, shift);
+
+        return static_cast<int64_t>((quotient ^ sign) - sign);
+    }
+
+    __host__ __device__ void divmod(int64_t dividend_, int64_t& quotient_, int64_t& remainder_) const
+    {
+        quotient_  = div(dividend_);
+        remainder_ = static_cast<int64_t>(static_cast<uint64_t>(dividend_) -
+                                          static_cast<uint64_t>(quotient_) *
+                                              static_cast<uint64_t>(divisor));
+    }
+
+    __host__ __device__ int64_t get() const { return divisor; }
+};
+
 } // namespace ck
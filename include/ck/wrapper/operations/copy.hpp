@@ -13,6 +13,130 @@
 namespace ck {
 namespace wrapper {
 
+namespace detail {
+namespace {
+
+/**
+ * \brief Host lowering of the optimized copy between two dynamic buffer
+ * tensors. Dimensions are visited in DimAccessOrder with VectorDim innermost,
+ * in runs of ScalarPerVector elements. A run is copied as a plain loop over
+ * contiguous memory, which the host compiler vectorizes, if VectorDim has unit
+ * stride in both tensors, otherwise element by element.
+ *
+ * \param src_tensor Source tensor.
+ * \param dst_tensor Destination tensor.
+ */
+template <typename DimAccessOrderTuple,
+          index_t VectorDim,
+          index_t ScalarPerVector,
+          typename SrcTensorType,
+          typename DstTensorType>
+__host__ void HostCopy(const SrcTensorType& src_tensor, DstTensorType& dst_tensor)
+{
+    using SrcShapeType         = remove_cvref_t<decltype(shape(src_tensor))>;
+    using DstElementType       = typename DstTensorType::TensorElementType;
+    constexpr index_t num_dims = SrcShapeType::Size();
+
+    index_t lengths[num_dims];
+    index_t access_order[num_dims];
+    index_t idxs[num_dims];
+
+    static_for<0, num_dims, 1>{}([&](auto i) {
+        lengths[i.value]      = size<i.value>(shape(src_tensor));
+        access_order[i.value] = DimAccessOrderTuple{}.At(i);
+        idxs[i.value]         = 0;
+    });
+
+    if(size(src_tensor) == 0)
+    {
+        return;
+    }
+
+    const auto make_idxs = [&]() {
+        return generate_tuple([&](auto i) { return idxs[i.value]; }, Number<num_dims>{});
+    };
+
+    // unit stride along VectorDim in both tensors, measured at the origin. A nested VectorDim has
+    // a stride per sub-dimension, so every index of it is checked and not only the first step.
+    bool contiguous = true;
+
+    {
+        const auto* p_src0 = &src_tensor(make_idxs());
+        auto* p_dst0       = &dst_tensor(make_idxs());
+
+        for(index_t v = 1; v < lengths[VectorDim] && contiguous; ++v)
+        {
+            idxs[VectorDim] = v;
+            contiguous      = &src_tensor(make_idxs()) == p_src0 + v &&
+                         &dst_tensor(make_idxs()) == p_dst0 + v;
+        }
+
+        idxs[VectorDim] = 0;
+    }
+
+    bool done = false;
+
+    while(!done)
+    {
+        for(idxs[VectorDim] = 0; idxs[VectorDim] < lengths[VectorDim];
+            idxs[VectorDim] += ScalarPerVector)
+        {
+            const index_t num_scalar =
+                math::min(ScalarPerVector, lengths[VectorDim] - idxs[VectorDim]);
+
+            if(contiguous)
+            {
+                const auto* p_src = &src_tensor(make_idxs());
+                auto* p_dst       = &dst_tensor(make_idxs());
+
+                for(index_t v = 0; v < num_scalar; ++v)
+                {
+                    p_dst[v] = type_convert<DstElementType>(p_src[v]);
+                }
+            }
+            else
+            {
+                const index_t vector_begin = idxs[VectorDim];
+
+                for(index_t v = 0; v < num_scalar; ++v)
+                {
+                    idxs[VectorDim] = vector_begin + v;
+                    dst_tensor(make_idxs()) =
+                        type_convert<DstElementType>(src_tensor(make_idxs()));
+                }
+
+                idxs[VectorDim] = vector_begin;
+            }
+        }
+
+        idxs[VectorDim] = 0;
+
+        // next index of the other dimensions, the last one in access order is the fastest
+        done = true;
+
+        for(index_t i = num_dims; i > 0; --i)
+        {
+            const index_t dim = access_order[i - 1];
+
+            if(dim == VectorDim)
+            {
+                continue;
+            }
+
+            if(++idxs[dim] < lengths[dim])
+            {
+                done = false;
+                break;
+            }
+
+            idxs[dim] = 0;
+        }
+    }
+}
+
+} // namespace
+} // namespace detail
+
 /**
  * \brief Perform generic copy between two tensors partitions (threadwise copy).
  *  Tensors must have the same size.
@@ -44,7 +168,9 @@ __host__ __device__ void copy(const SrcTensorType& src_tensor, DstTensorType& ds
 
 /**
  * \brief Perform optimized copy between two tensors partitions (threadwise copy).
- * Tensors must have the same size.
+ * Tensors must have the same size. In host code, copies between dynamic
+ * buffers (e.g. host tensors in Generic memory) lower to loops over
+ * ScalarPerVector contiguous elements.
  *
  * \tparam DimAccessOrderTuple Tuple with dimension access order.
  * \tparam VectorDim Dimension for vectorized read and write.
@@ -57,9 +183,20 @@ template <typename DimAccessOrderTuple,
           index_t ScalarPerVector,
           typename SrcTensorType,
           typename DstTensorType>
-__device__ void copy(const SrcTensorType& src_tensor, DstTensorType& dst_tensor)
+__host__ __device__ void copy(const SrcTensorType& src_tensor, DstTensorType& dst_tensor)
 {
     static_assert(is_detected<is_tuple, DimAccessOrderTuple>::value);
+#if !defined(__HIP_DEVICE_COMPILE__)
+    if constexpr(SrcTensorType::IsDynamicBuffer && DstTensorType::IsDynamicBuffer)
+    {
+        detail::HostCopy<DimAccessOrderTuple, VectorDim, ScalarPerVector>(src_tensor, dst_tensor);
+    }
+    else
+    {
+        // register tensors on host are plain arrays
+        copy(src_tensor, dst_tensor);
+    }
+#else
     constexpr auto I0 = Number<0>{};
     constexpr auto I1 = Number<1>{};
 
@@ -169,6 +306,7 @@ __device__ void copy(const SrcTensorType& src_tensor, DstTensorType& dst_tensor)
         // Perform copy between StaticBuffers
         copy(src_tensor, dst_tensor);
     }
+#endif
 }
 
 } // namespace wrapper
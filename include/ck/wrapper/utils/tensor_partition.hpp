@@ -69,6 +69,22 @@ CalculateOffsetMultiIdxs(const ThreadIdxs& thread_idxs,
     return thread_idxs * partition_lengths_seq + old_offset_idxs;
 }
 
+/**
+ * \brief Make the block data index uniform across the wavefront. On host,
+ * where a block is run by a single host thread, it is returned as is.
+ *
+ * \param value Block data index.
+ * \return Block data index.
+ */
+__host__ __device__ inline index_t ReadFirstLane(const index_t value)
+{
+#if defined(__HIP_DEVICE_COMPILE__)
+    return __builtin_amdgcn_readfirstlane(value);
+#else
+    return value;
+#endif
+}
+
 } // namespace
 
 /**
@@ -150,9 +166,9 @@ make_local_tile(const TensorType& tensor, const BlockShapeTuple& tile_shape, con
         const auto block_work_idx =
             block_2_tile_map.CalculateBottomIndex(make_multi_index(block_id));
         const index_t m_block_data_idx_on_grid =
-            __builtin_amdgcn_readfirstlane(block_work_idx[I0] * size<0>(tile_shape));
+            ReadFirstLane(block_work_idx[I0] * size<0>(tile_shape));
         const index_t k_block_data_idx_on_grid =
-            __builtin_amdgcn_readfirstlane(block_work_idx[I1] * size<1>(tile_shape));
+            ReadFirstLane(block_work_idx[I1] * size<1>(tile_shape));
         const auto offset_multi_idxs =
             make_tuple(m_block_data_idx_on_grid, k_block_data_idx_on_grid);
         // Create new layout and tensor
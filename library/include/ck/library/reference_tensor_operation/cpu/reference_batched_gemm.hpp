@@ -8,6 +8,7 @@
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tiled_tensor_functor.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -80,10 +81,11 @@ struct ReferenceBatchedGemm : public device::BaseOperator
                 arg.c_g_m_n_(g, m, n) = ck::type_convert<CDataType>(v_c);
             };
 
-            make_ParallelTensorFunctor(f_gmk_gkn_gmn,
-                                       arg.c_g_m_n_.mDesc.GetLengths()[0],
-                                       arg.c_g_m_n_.mDesc.GetLengths()[1],
-                                       arg.c_g_m_n_.mDesc.GetLengths()[2])(
+            // M x N tiles along a Hilbert curve keep the B columns of a tile in cache
+            make_TiledParallelTensorFunctor(f_gmk_gkn_gmn,
+                                            arg.c_g_m_n_.mDesc.GetLengths()[0],
+                                            arg.c_g_m_n_.mDesc.GetLengths()[1],
+                                            arg.c_g_m_n_.mDesc.GetLengths()[2])(
                 std::thread::hardware_concurrency());
             return 0;
         }
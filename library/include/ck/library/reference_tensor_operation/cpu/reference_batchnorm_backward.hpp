@@ -6,12 +6,13 @@
 #include <iostream>
 #include <array>
 #include <algorithm>
-#include <thread>
+#include <numeric>
+#include <vector>
 
-#include "ck/utility/math_v2.hpp"
 #include "ck/utility/ignore.hpp"
 #include "ck/library/utility/host_common_util.hpp"
 #include "ck/tensor_operation/gpu/device/device_batchnorm_backward.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_normalization_bwd.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -78,8 +79,6 @@ struct ReferenceBatchNormBwd : public device::DeviceBatchNormBwd<XDataType,
               p_dscale_(p_dscale),
               p_dbias_(p_dbias)
         {
-            using ck::host_common::get_index_set;
-
             if(std::any_of(
                    reduceDims.begin(), reduceDims.end(), [](int d) { return d < 0 || d >= Rank; }))
                 throw std::runtime_error("Invalid reduce dimensions!");
@@ -126,10 +125,7 @@ struct ReferenceBatchNormBwd : public device::DeviceBatchNormBwd<XDataType,
             reduceSize_ = std::accumulate(
                 reduce_lengths_.begin(), reduce_lengths_.end(), 1, std::multiplies<size_t>{});
 
-            invariant_index_set_ = get_index_set<NumInvariantDim>(invariant_lengths_);
-            reduce_index_set_    = get_index_set<NumBatchNormReduceDim>(reduce_lengths_);
-
-            epsilon_ = type_convert<AccDataType>(epsilon);
+            epsilon_ = epsilon;
 
             haveSavedMeanInvVar_ = (p_savedMean != nullptr && p_savedInvVar != nullptr);
         }
@@ -164,10 +160,7 @@ struct ReferenceBatchNormBwd : public device::DeviceBatchNormBwd<XDataType,
 
         bool haveSavedMeanInvVar_;
 
-        std::vector<std::array<index_t, NumInvariantDim>> invariant_index_set_;
-        std::vector<std::array<index_t, NumBatchNormReduceDim>> reduce_index_set_;
-
-        AccDataType epsilon_;
+        double epsilon_;
         size_t reduceSize_;
     };
 
@@ -175,163 +168,70 @@ struct ReferenceBatchNormBwd : public device::DeviceBatchNormBwd<XDataType,
     {
         float Run(const Argument& arg)
         {
-            using ck::host_common::get_offset_from_index;
-
-            auto thread_reduce_func = [&](auto invariant_index) {
-                size_t x_invariant_offset = get_offset_from_index<NumInvariantDim>(
-                    arg.x_invariant_strides_, invariant_index);
-                size_t dy_invariant_offset = get_offset_from_index<NumInvariantDim>(
-                    arg.dy_invariant_strides_, invariant_index);
-                size_t dx_invariant_offset = get_offset_from_index<NumInvariantDim>(
-                    arg.dx_invariant_strides_, invariant_index);
-
-                AccDataType mean     = type_convert<AccDataType>(0.0f);
-                AccDataType variance = type_convert<AccDataType>(0.0f);
-                AccDataType invVar;
-                int32_t curr_count = 0;
-
-                if(arg.haveSavedMeanInvVar_)
-                {
-                    size_t mean_invVar_invariant_offset = get_offset_from_index<NumInvariantDim>(
-                        arg.bnMeanVarStrides_, invariant_index);
-
-                    mean =
-                        type_convert<AccDataType>(arg.p_savedMean_[mean_invVar_invariant_offset]);
-                    invVar =
-                        type_convert<AccDataType>(arg.p_savedInvVar_[mean_invVar_invariant_offset]);
-                }
-                else
-                {
-                    // compute mean, variance using welford method
-                    for(const auto& reduce_index : arg.reduce_index_set_)
-                    {
-                        size_t x_reduce_offset = get_offset_from_index<NumBatchNormReduceDim>(
-                            arg.x_reduce_strides_, reduce_index);
-
-                        auto x_offset = x_invariant_offset + x_reduce_offset;
-
-                        curr_count++;
-
-                        AccDataType x = type_convert<AccDataType>(arg.p_x_[x_offset]);
-
-                        AccDataType delta = x - mean;
-
-                        mean += delta / curr_count;
-
-                        AccDataType delta2 = x - mean;
-
-                        variance += delta * delta2;
-                    };
-
-                    // actual variance
-                    variance = variance / curr_count;
-
-                    // inv-variance defined as 1/sqrt(epsilon+variance)
-                    invVar =
-                        type_convert<AccDataType>(1.0f) / ck::math::sqrt(arg.epsilon_ + variance);
-                };
-
-                AccDataType dbias =
-                    type_convert<AccDataType>(0.0f); // Sum on reduced dimensions of dy
-                AccDataType dscale =
-                    type_convert<AccDataType>(0.0f); // Sum on reduced dimensions of dy * norm_x
-
-                // 1) calculate dy * (x - mean) * inv-variance
-                // 2) calculate sum(dy) on reduced dimensions
-                // 3) calculate sum(dy * norm_x) on reduced dimensions
-                for(const auto& reduce_index : arg.reduce_index_set_)
-                {
-                    size_t x_reduce_offset = get_offset_from_index<NumBatchNormReduceDim>(
-                        arg.x_reduce_strides_, reduce_index);
-                    size_t dy_reduce_offset = get_offset_from_index<NumBatchNormReduceDim>(
-                        arg.dy_reduce_strides_, reduce_index);
-
-                    auto x_offset  = x_invariant_offset + x_reduce_offset;
-                    auto dy_offset = dy_invariant_offset + dy_reduce_offset;
-
-                    AccDataType x = type_convert<AccDataType>(arg.p_x_[x_offset]);
-
-                    AccDataType norm_x = (x - mean) * invVar;
-                    AccDataType dy     = type_convert<AccDataType>(arg.p_dy_[dy_offset]);
-
-                    arg.dy_elementwise_op_(dy, dy);
+            using Layout = NormalizationBwdLayout;
 
-                    dbias += dy;
-                    dscale += norm_x * dy;
-                };
-
-                size_t dscale_offset = get_offset_from_index<NumInvariantDim>(
-                    arg.bnDscaleDbiasStrides_, invariant_index);
-                size_t dbias_offset = get_offset_from_index<NumInvariantDim>(
-                    arg.bnDscaleDbiasStrides_, invariant_index);
-
-                arg.p_dscale_[dscale_offset] = type_convert<DscaleDbiasDataType>(dscale);
-                arg.p_dbias_[dbias_offset]   = type_convert<DscaleDbiasDataType>(dbias);
-
-                size_t scale_offset =
-                    get_offset_from_index<NumInvariantDim>(arg.bnScaleStrides_, invariant_index);
-
-                AccDataType scale = type_convert<AccDataType>(arg.p_scale_[scale_offset]);
-
-                AccDataType multiplier = type_convert<AccDataType>(1.0f) /
-                                         type_convert<AccDataType>(arg.reduceSize_) * invVar *
-                                         scale;
-
-                // 1) calculate tmp = dscale * (x - mean) * inv-variance
-                // 2) calculate dx = 1/reduceSize * inv-variance * scale * (reduceSize * dy - dbias
-                // - tmp)
-                for(const auto& reduce_index : arg.reduce_index_set_)
-                {
-                    size_t x_reduce_offset = get_offset_from_index<NumBatchNormReduceDim>(
-                        arg.x_reduce_strides_, reduce_index);
-                    size_t dy_reduce_offset = get_offset_from_index<NumBatchNormReduceDim>(
-                        arg.dy_reduce_strides_, reduce_index);
-                    size_t dx_reduce_offset = get_offset_from_index<NumBatchNormReduceDim>(
-                        arg.dx_reduce_strides_, reduce_index);
-
-                    auto x_offset  = x_invariant_offset + x_reduce_offset;
-                    auto dy_offset = dy_invariant_offset + dy_reduce_offset;
-                    auto dx_offset = dx_invariant_offset + dx_reduce_offset;
-
-                    AccDataType x = type_convert<AccDataType>(arg.p_x_[x_offset]);
-
-                    AccDataType norm_x = (x - mean) * invVar;
-                    AccDataType dy     = type_convert<AccDataType>(arg.p_dy_[dy_offset]);
-
-                    arg.dy_elementwise_op_(dy, dy);
-
-                    AccDataType tmpVal = norm_x * dscale;
-
-                    AccDataType dx = multiplier * (type_convert<AccDataType>(arg.reduceSize_) * dy -
-                                                   dbias - tmpVal);
-
-                    arg.p_dx_[dx_offset] = type_convert<DxDataType>(dx);
-                };
+            auto get_offsets = [](const auto& lengths, const auto& strides) {
+                return Layout::GetOffsets(
+                    std::vector<index_t>(lengths.begin(), lengths.end()),
+                    std::vector<std::size_t>(strides.begin(), strides.end()));
             };
 
-            std::size_t num_thread = std::thread::hardware_concurrency();
-            std::size_t work_per_thread =
-                (arg.invariant_index_set_.size() + num_thread - 1) / num_thread;
-
-            std::vector<joinable_thread> threads(num_thread);
-
-            for(std::size_t it = 0; it < num_thread; ++it)
-            {
-                std::size_t i_begin = it * work_per_thread;
-                std::size_t i_end   = std::min(static_cast<size_t>((it + 1) * work_per_thread),
-                                             arg.invariant_index_set_.size());
-
-                auto f = [=] {
-                    for(std::size_t i = i_begin; i < i_end; ++i)
-                    {
-                        thread_reduce_func(arg.invariant_index_set_[i]);
-                    }
-                };
-
-                threads[it] = joinable_thread(f);
-            }
-
-            return (0.0f);
+            const auto& invariant_lengths = arg.invariant_lengths_;
+            const auto& reduce_lengths    = arg.reduce_lengths_;
+
+            const index_t invariant_size = std::accumulate(invariant_lengths.begin(),
+                                                           invariant_lengths.end(),
+                                                           1,
+                                                           std::multiplies<index_t>{});
+            const index_t reduce_size    = static_cast<index_t>(arg.reduceSize_);
+
+            // a group and a parameter per invariant index, shared by all reduced positions
+            Layout layout;
+
+            layout.x_group_offsets_  = get_offsets(invariant_lengths, arg.x_invariant_strides_);
+            layout.dy_group_offsets_ = get_offsets(invariant_lengths, arg.dy_invariant_strides_);
+            layout.dx_group_offsets_ = get_offsets(invariant_lengths, arg.dx_invariant_strides_);
+            layout.mean_offsets_     = get_offsets(invariant_lengths, arg.bnMeanVarStrides_);
+            layout.inv_std_offsets_  = layout.mean_offsets_;
+            layout.group_params_     = Layout::GetOffsets({invariant_size}, {1});
+
+            layout.x_reduce_offsets_  = get_offsets(reduce_lengths, arg.x_reduce_strides_);
+            layout.dy_reduce_offsets_ = get_offsets(reduce_lengths, arg.dy_reduce_strides_);
+            layout.dx_reduce_offsets_ = get_offsets(reduce_lengths, arg.dx_reduce_strides_);
+            layout.reduce_params_     = Layout::GetOffsets({reduce_size}, {0});
+
+            layout.gamma_offsets_  = get_offsets(invariant_lengths, arg.bnScaleStrides_);
+            layout.dgamma_offsets_ = get_offsets(invariant_lengths, arg.bnDscaleDbiasStrides_);
+            layout.dbeta_offsets_  = layout.dgamma_offsets_;
+
+            using ReferenceInstance = ReferenceNormalizationBwd<DyDataType,
+                                                                XDataType,
+                                                                ScaleDataType,
+                                                                MeanVarDataType,
+                                                                DscaleDbiasDataType,
+                                                                DscaleDbiasDataType,
+                                                                DxDataType,
+                                                                AccDataType,
+                                                                DyElementwiseOp>;
+
+            // without saved mean and inv variance, the engine computes them with Welford's method
+            const bool have_saved = arg.haveSavedMeanInvVar_;
+
+            const MeanVarDataType* p_mean    = have_saved ? arg.p_savedMean_ : nullptr;
+            const MeanVarDataType* p_inv_var = have_saved ? arg.p_savedInvVar_ : nullptr;
+
+            return ReferenceInstance::MakeInvoker().Run(
+                ReferenceInstance::MakeArgument(std::move(layout),
+                                                arg.p_dy_,
+                                                arg.p_x_,
+                                                arg.p_scale_,
+                                                p_mean,
+                                                p_inv_var,
+                                                arg.epsilon_,
+                                                arg.dy_elementwise_op_,
+                                                arg.p_dscale_,
+                                                arg.p_dbias_,
+                                                arg.p_dx_));
         };
 
         float Run(const device::BaseArgument* p_arg,
@@ -6,6 +6,7 @@
 #include <iostream>
 #include <sstream>
 
+#include "ck/library/utility/host_complex_gemm.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
@@ -32,6 +33,7 @@ struct ReferenceCGemm : public device::BaseOperator
     // Argument
     struct Argument : public device::BaseArgument
     {
+        // planar [M, K], [K, N] and [M, N] real and imag tensors
         Argument(const Tensor<ADataType>& a_m_k_real,
                  const Tensor<ADataType>& a_m_k_imag,
                  const Tensor<BDataType>& b_k_n_real,
@@ -40,29 +42,45 @@ struct ReferenceCGemm : public device::BaseOperator
                  Tensor<CDataType>& c_m_n_imag,
                  AElementwiseOperation a_element_op,
                  BElementwiseOperation b_element_op,
-                 CElementwiseOperation c_element_op)
-            : a_m_k_real_{a_m_k_real},
-              a_m_k_imag_{a_m_k_imag},
-              b_k_n_real_{b_k_n_real},
-              b_k_n_imag_{b_k_n_imag},
-              c_m_n_real_{c_m_n_real},
-              c_m_n_imag_{c_m_n_imag},
+                 CElementwiseOperation c_element_op,
+                 CGemmAlgorithm algorithm)
+            : a_m_k_{make_planar_complex_matrix(a_m_k_real, a_m_k_imag)},
+              b_k_n_{make_planar_complex_matrix(b_k_n_real, b_k_n_imag)},
+              c_m_n_{make_planar_complex_matrix(c_m_n_real, c_m_n_imag)},
               a_element_op_{a_element_op},
               b_element_op_{b_element_op},
-              c_element_op_{c_element_op}
+              c_element_op_{c_element_op},
+              algorithm_{algorithm}
         {
         }
 
-        const Tensor<ADataType>& a_m_k_real_;
-        const Tensor<ADataType>& a_m_k_imag_;
-        const Tensor<BDataType>& b_k_n_real_;
-        const Tensor<BDataType>& b_k_n_imag_;
-        Tensor<CDataType>& c_m_n_real_;
-        Tensor<CDataType>& c_m_n_imag_;
+        // interleaved [M, K, 2], [K, N, 2] and [M, N, 2] tensors
+        Argument(const Tensor<ADataType>& a_m_k,
+                 const Tensor<BDataType>& b_k_n,
+                 Tensor<CDataType>& c_m_n,
+                 AElementwiseOperation a_element_op,
+                 BElementwiseOperation b_element_op,
+                 CElementwiseOperation c_element_op,
+                 CGemmAlgorithm algorithm)
+            : a_m_k_{make_interleaved_complex_matrix(a_m_k)},
+              b_k_n_{make_interleaved_complex_matrix(b_k_n)},
+              c_m_n_{make_interleaved_complex_matrix(c_m_n)},
+              a_element_op_{a_element_op},
+              b_element_op_{b_element_op},
+              c_element_op_{c_element_op},
+              algorithm_{algorithm}
+        {
+        }
+
+        HostComplexMatrix<const ADataType> a_m_k_;
+        HostComplexMatrix<const BDataType> b_k_n_;
+        HostComplexMatrix<CDataType> c_m_n_;
 
         AElementwiseOperation a_element_op_;
         BElementwiseOperation b_element_op_;
         CElementwiseOperation c_element_op_;
+
+        CGemmAlgorithm algorithm_;
     };
 
     // Invoker
@@ -72,53 +90,7 @@ struct ReferenceCGemm : public device::BaseOperator
 
         float Run(const Argument& arg)
         {
-            const std::size_t K = arg.a_m_k_real_.mDesc.GetLengths()[1];
-
-            if(K != arg.a_m_k_imag_.mDesc.GetLengths()[1])
-            {
-                throw std::runtime_error("wrong! Incompatible real and imag sizes in CGEMM");
-            }
-
-            auto f_mk_kn_mn_real = [&](auto m, auto n) {
-                float v_c_real = 0;
-
-                for(std::size_t k = 0; k < K; ++k)
-                {
-                    float v_a_real = ck::type_convert<float>(arg.a_m_k_real_(m, k));
-                    float v_a_imag = ck::type_convert<float>(arg.a_m_k_imag_(m, k));
-                    float v_b_real = ck::type_convert<float>(arg.b_k_n_real_(k, n));
-                    float v_b_imag = ck::type_convert<float>(arg.b_k_n_imag_(k, n));
-
-                    v_c_real += v_a_real * v_b_real - v_a_imag * v_b_imag;
-                }
-
-                arg.c_m_n_real_(m, n) = ck::type_convert<CDataType>(v_c_real);
-            };
-
-            auto f_mk_kn_mn_imag = [&](auto m, auto n) {
-                float v_c_imag = 0;
-
-                for(std::size_t k = 0; k < K; ++k)
-                {
-                    float v_a_real = ck::type_convert<float>(arg.a_m_k_real_(m, k));
-                    float v_a_imag = ck::type_convert<float>(arg.a_m_k_imag_(m, k));
-                    float v_b_real = ck::type_convert<float>(arg.b_k_n_real_(k, n));
-                    float v_b_imag = ck::type_convert<float>(arg.b_k_n_imag_(k, n));
-
-                    v_c_imag += v_a_real * v_b_imag + v_a_imag * v_b_real;
-                }
-
-                arg.c_m_n_imag_(m, n) = ck::type_convert<CDataType>(v_c_imag);
-            };
-
-            make_ParallelTensorFunctor(f_mk_kn_mn_real,
-                                       arg.c_m_n_real_.mDesc.GetLengths()[0],
-                                       arg.c_m_n_real_.mDesc.GetLengths()[1])(
-                std::thread::hardware_concurrency());
-            make_ParallelTensorFunctor(f_mk_kn_mn_imag,
-                                       arg.c_m_n_imag_.mDesc.GetLengths()[0],
-                                       arg.c_m_n_imag_.mDesc.GetLengths()[1])(
-                std::thread::hardware_concurrency());
+            complex_gemm(arg.a_m_k_, arg.b_k_n_, arg.c_m_n_, arg.algorithm_);
 
             return 0;
         }
@@ -146,7 +118,8 @@ struct ReferenceCGemm : public device::BaseOperator
                              Tensor<CDataType>& c_m_n_imag,
                              AElementwiseOperation a_element_op,
                              BElementwiseOperation b_element_op,
-                             CElementwiseOperation c_element_op)
+                             CElementwiseOperation c_element_op,
+                             CGemmAlgorithm algorithm = CGemmAlgorithm::Classic4M)
     {
         return Argument{a_m_k_real,
                         a_m_k_imag,
@@ -156,7 +129,20 @@ struct ReferenceCGemm : public device::BaseOperator
                         c_m_n_imag,
                         a_element_op,
                         b_element_op,
-                        c_element_op};
+                        c_element_op,
+                        algorithm};
+    }
+
+    static auto MakeArgument(const Tensor<ADataType>& a_m_k,
+                             const Tensor<BDataType>& b_k_n,
+                             Tensor<CDataType>& c_m_n,
+                             AElementwiseOperation a_element_op,
+                             BElementwiseOperation b_element_op,
+                             CElementwiseOperation c_element_op,
+                             CGemmAlgorithm algorithm = CGemmAlgorithm::Classic4M)
+    {
+        return Argument{
+            a_m_k, b_k_n, c_m_n, a_element_op, b_element_op, c_element_op, algorithm};
     }
 
     static auto MakeInvoker() { return Invoker{}; }
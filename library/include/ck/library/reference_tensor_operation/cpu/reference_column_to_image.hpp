@@ -3,13 +3,17 @@
 
 #pragma once
 
+#include <array>
 #include <iostream>
 #include <type_traits>
 #include <sstream>
+#include <vector>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
 #include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
+#include "ck/library/utility/numeric.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -90,6 +94,36 @@ struct ReferenceColumnToImage : public device::BaseOperator
     {
         using Argument = ReferenceColumnToImage::Argument;
 
+        // tap * dilation along every spatial dimension, for the filter taps in column order
+        static std::vector<std::array<long_index_t, NDimSpatial>>
+        GetFilterTapOffsets(const Argument& arg)
+        {
+            std::vector<std::array<long_index_t, NDimSpatial>> taps(1);
+
+            for(std::size_t d = 0; d < NDimSpatial; ++d)
+            {
+                std::vector<std::array<long_index_t, NDimSpatial>> next_taps;
+
+                for(const auto& tap : taps)
+                {
+                    for(index_t x = 0; x < arg.filter_spatial_lengths_[d]; ++x)
+                    {
+                        next_taps.push_back(tap);
+                        next_taps.back()[d] = static_cast<long_index_t>(x) * arg.conv_dilations_[d];
+                    }
+                }
+
+                taps = std::move(next_taps);
+            }
+
+            return taps;
+        }
+
+        // Gathers instead of scattering the overlapping windows: one task per (g, n, leading image
+        // indices) owns a line of Wi image pixels and sums, for each pixel, the C runs of the rows
+        // whose window covers it, so no two tasks write the same element. Visiting the taps in
+        // reverse visits the covering rows in increasing order, which is the order the rows were
+        // added in by the scatter, and every sum is rounded to OutDataType like the scatter did.
         float Run(const Argument& arg)
         {
             if(!(arg.output_.GetNumOfDimension() == NDimSpatial + 3 &&
@@ -98,175 +132,103 @@ struct ReferenceColumnToImage : public device::BaseOperator
                 throw std::runtime_error("wrong! inconsistent dimension");
             }
 
-            const index_t G = arg.output_.GetLengths()[0];
-            const index_t N = arg.output_.GetLengths()[1];
-            const index_t C = arg.output_.GetLengths()[2];
+            const auto& image_lengths  = arg.output_.GetLengths();
+            const auto& image_strides  = arg.output_.GetStrides();
+            const auto& column_strides = arg.input_.GetStrides();
 
-            if constexpr(NDimSpatial == 1)
-            {
-                const index_t Wo = arg.output_spatial_lengths_[0];
-                auto func        = [&](auto g, auto n) {
-                    for(index_t wo = 0; wo < Wo; ++wo)
-                    {
-                        index_t row    = n * Wo + wo;
-                        index_t column = 0;
+            const std::size_t G = image_lengths[0];
+            const std::size_t N = image_lengths[1];
+            const std::size_t C = image_lengths[2];
 
-                        for(index_t x = 0; x < arg.filter_spatial_lengths_[0]; ++x)
-                        {
-                            auto wi = static_cast<ck::long_index_t>(wo * arg.conv_strides_[0]) +
-                                      static_cast<ck::long_index_t>(x * arg.conv_dilations_[0]) -
-                                      static_cast<ck::long_index_t>(arg.in_left_pads_[0]);
-
-                            for(index_t c = 0; c < C; ++c)
-                            {
-                                if(wi >= 0 &&
-                                   ck::type_convert<std::size_t>(wi) < arg.output_.GetLengths()[3])
-                                {
-                                    float v_in =
-                                        ck::type_convert<float>(arg.input_(g, row, column));
-                                    float v_out = ck::type_convert<float>(arg.output_(g, n, c, wi));
-                                    arg.output_(g, n, c, wi) =
-                                        ck::type_convert<OutDataType>(v_in + v_out);
-                                }
-                                column++;
-                            }
-                        }
+            const auto taps = GetFilterTapOffsets(arg);
+
+            const std::size_t num_row_per_n = ck::accumulate_n<std::size_t>(
+                arg.output_spatial_lengths_.begin(), NDimSpatial, 1, std::multiplies<>());
+
+            const std::size_t Wi       = image_lengths[2 + NDimSpatial];
+            const std::size_t num_line = ck::accumulate_n<std::size_t>(
+                image_lengths.begin() + 3, NDimSpatial - 1, 1, std::multiplies<>());
+
+            const InDataType* p_column = arg.input_.mData.data();
+            OutDataType* p_image       = arg.output_.mData.data();
+
+            auto& pool = ck::utils::HostThreadPool::GetInstance();
+
+            pool.ParallelFor(G * N * num_line, [&](std::size_t task) {
+                const std::size_t line = task % num_line;
+                const std::size_t n    = task / num_line % N;
+                const std::size_t g    = task / num_line / N;
+
+                std::array<long_index_t, NDimSpatial> i{};
+
+                for(std::size_t d = NDimSpatial - 1, rest = line; d > 0; --d)
+                {
+                    i[d - 1] = static_cast<long_index_t>(rest % image_lengths[2 + d]);
+                    rest /= image_lengths[2 + d];
+                }
+
+                std::vector<OutDataType> acc(C);
+
+                for(std::size_t wi = 0; wi < Wi; ++wi)
+                {
+                    i[NDimSpatial - 1] = static_cast<long_index_t>(wi);
+
+                    std::size_t offset = g * image_strides[0] + n * image_strides[1];
+
+                    for(std::size_t d = 0; d < NDimSpatial; ++d)
+                    {
+                        offset += static_cast<std::size_t>(i[d]) * image_strides[3 + d];
                     }
-                };
 
-                make_ParallelTensorFunctor(func, G, N)(std::thread::hardware_concurrency());
+                    OutDataType* p_pixel = p_image + offset;
 
-                return 0;
-            }
-            else if constexpr(NDimSpatial == 2)
-            {
-                const index_t Ho = arg.output_spatial_lengths_[0];
-                const index_t Wo = arg.output_spatial_lengths_[1];
+                    for(std::size_t c = 0; c < C; ++c)
+                    {
+                        acc[c] = p_pixel[c * image_strides[2]];
+                    }
 
-                auto func = [&](auto g, auto n) {
-                    for(index_t ho = 0; ho < Ho; ++ho)
+                    for(std::size_t tap = taps.size(); tap-- > 0;)
                     {
-                        for(index_t wo = 0; wo < Wo; ++wo)
+                        std::size_t row = 0;
+                        bool covered    = true;
+
+                        for(std::size_t d = 0; d < NDimSpatial && covered; ++d)
                         {
-                            index_t row    = n * Ho * Wo + ho * Wo + wo;
-                            index_t column = 0;
-
-                            for(index_t y = 0; y < arg.filter_spatial_lengths_[0]; ++y)
-                            {
-                                auto hi =
-                                    static_cast<ck::long_index_t>(ho * arg.conv_strides_[0]) +
-                                    static_cast<ck::long_index_t>(y * arg.conv_dilations_[0]) -
-                                    static_cast<ck::long_index_t>(arg.in_left_pads_[0]);
-
-                                for(index_t x = 0; x < arg.filter_spatial_lengths_[1]; ++x)
-                                {
-                                    auto wi =
-                                        static_cast<ck::long_index_t>(wo * arg.conv_strides_[1]) +
-                                        static_cast<ck::long_index_t>(x * arg.conv_dilations_[1]) -
-                                        static_cast<ck::long_index_t>(arg.in_left_pads_[1]);
-
-                                    for(index_t c = 0; c < C; ++c)
-                                    {
-
-                                        if(hi >= 0 &&
-                                           ck::type_convert<std::size_t>(hi) <
-                                               arg.output_.GetLengths()[3] &&
-                                           wi >= 0 &&
-                                           ck::type_convert<std::size_t>(wi) <
-                                               arg.output_.GetLengths()[4])
-                                        {
-                                            float v_in =
-                                                ck::type_convert<float>(arg.input_(g, row, column));
-                                            float v_out = ck::type_convert<float>(
-                                                arg.output_(g, n, c, hi, wi));
-                                            arg.output_(g, n, c, hi, wi) =
-                                                ck::type_convert<OutDataType>(v_in + v_out);
-                                        }
-                                        column++;
-                                    }
-                                }
-                            }
+                            // o * stride = i + left pad - tap * dilation
+                            const long_index_t o_stride =
+                                i[d] + arg.in_left_pads_[d] - taps[tap][d];
+                            const long_index_t o = o_stride / arg.conv_strides_[d];
+
+                            covered = o_stride >= 0 && o_stride % arg.conv_strides_[d] == 0 &&
+                                      o < arg.output_spatial_lengths_[d];
+                            row     = row * arg.output_spatial_lengths_[d] + o;
                         }
-                    }
-                };
 
-                make_ParallelTensorFunctor(func, G, N)(std::thread::hardware_concurrency());
+                        if(!covered)
+                        {
+                            continue;
+                        }
 
-                return 0;
-            }
-            else if constexpr(NDimSpatial == 3)
-            {
-                const index_t Do = arg.output_spatial_lengths_[0];
-                const index_t Ho = arg.output_spatial_lengths_[1];
-                const index_t Wo = arg.output_spatial_lengths_[2];
+                        const InDataType* p_run = p_column + g * column_strides[0] +
+                                                  (n * num_row_per_n + row) * column_strides[1] +
+                                                  tap * C * column_strides[2];
 
-                auto func = [&](auto g, auto n) {
-                    for(index_t d_o = 0; d_o < Do; ++d_o)
-                    {
-                        for(index_t ho = 0; ho < Ho; ++ho)
+                        for(std::size_t c = 0; c < C; ++c)
                         {
-                            for(index_t wo = 0; wo < Wo; ++wo)
-                            {
-                                index_t row    = n * Do * Ho * Wo + d_o * Ho * Wo + ho * Wo + wo;
-                                index_t column = 0;
-
-                                for(index_t z = 0; z < arg.filter_spatial_lengths_[0]; ++z)
-                                {
-                                    auto di =
-                                        static_cast<ck::long_index_t>(d_o * arg.conv_strides_[0]) +
-                                        static_cast<ck::long_index_t>(z * arg.conv_dilations_[0]) -
-                                        static_cast<ck::long_index_t>(arg.in_left_pads_[0]);
-                                    for(index_t y = 0; y < arg.filter_spatial_lengths_[1]; ++y)
-                                    {
-                                        auto hi =
-                                            static_cast<ck::long_index_t>(ho *
-                                                                          arg.conv_strides_[1]) +
-                                            static_cast<ck::long_index_t>(y *
-                                                                          arg.conv_dilations_[1]) -
-                                            static_cast<ck::long_index_t>(arg.in_left_pads_[1]);
-                                        for(index_t x = 0; x < arg.filter_spatial_lengths_[2]; ++x)
-                                        {
-                                            auto wi =
-                                                static_cast<ck::long_index_t>(
-                                                    wo * arg.conv_strides_[2]) +
-                                                static_cast<ck::long_index_t>(
-                                                    x * arg.conv_dilations_[2]) -
-                                                static_cast<ck::long_index_t>(arg.in_left_pads_[2]);
-                                            for(index_t c = 0; c < C; ++c)
-                                            {
-                                                if(di >= 0 &&
-                                                   ck::type_convert<std::size_t>(di) <
-                                                       arg.output_.GetLengths()[3] &&
-                                                   hi >= 0 &&
-                                                   ck::type_convert<std::size_t>(hi) <
-                                                       arg.output_.GetLengths()[4] &&
-                                                   wi >= 0 &&
-                                                   ck::type_convert<std::size_t>(wi) <
-                                                       arg.output_.GetLengths()[5])
-                                                {
-                                                    float v_in = ck::type_convert<float>(
-                                                        arg.input_(g, row, column));
-                                                    float v_out = ck::type_convert<float>(
-                                                        arg.output_(g, n, c, di, hi, wi));
-                                                    arg.output_(g, n, c, di, hi, wi) =
-                                                        ck::type_convert<OutDataType>(v_in + v_out);
-                                                }
-                                                column++;
-                                            }
-                                        }
-                                    }
-                                }
-                            }
+                            acc[c] = ck::type_convert<OutDataType>(
+                                ck::type_convert<float>(acc[c]) +
+                                ck::type_convert<float>(p_run[c * column_strides[2]]));
                         }
                     }
-                };
 
-                make_ParallelTensorFunctor(func, G, N)(std::thread::hardware_concurrency());
+                    for(std::size_t c = 0; c < C; ++c)
+                    {
+                        p_pixel[c * image_strides[2]] = acc[c];
+                    }
+                }
+            });
 
-                return 0;
-            }
-            throw std::runtime_error("Col2Img: number of dimensions should be between 1 and 3.");
-            return 1;
+            return 0;
         }
 
         float Run(const device::BaseArgument* p_arg,
@@ -3,12 +3,15 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <iostream>
 #include <sstream>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 
 #include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -70,6 +73,40 @@ struct ReferenceConvBwdWeight : public device::BaseOperator
         OutElementwiseOperation out_element_op_;
     };
 
+    // Weights with fewer elements than SplitReductionMaxWeightSize, e.g. of depthwise and small-K
+    // grouped convolutions, give too few tasks to parallelize over the weight elements alone. Their
+    // N x output spatial reduction is split into parts of at least SplitReductionMinLength
+    // positions as well.
+    static constexpr std::size_t SplitReductionMaxWeightSize = 256;
+    static constexpr std::size_t SplitReductionMinLength     = 4096;
+    static constexpr std::size_t SplitReductionMaxSplit      = 64;
+
+    // Depends on the problem shape only, so that the result does not depend on the number of
+    // threads
+    static std::size_t GetNumReductionSplit(const Argument& arg)
+    {
+        const auto& out_lengths = arg.output_.GetLengths();
+
+        const std::size_t weight_size = arg.weight_.GetElementSize();
+
+        std::size_t reduction_length = out_lengths[1];
+
+        for(std::size_t d = 0; d < NDimSpatial; ++d)
+        {
+            reduction_length *= out_lengths[3 + d];
+        }
+
+        if(weight_size == 0 || weight_size >= SplitReductionMaxWeightSize)
+        {
+            return 1;
+        }
+
+        return std::max(std::size_t{1},
+                        std::min({SplitReductionMaxSplit,
+                                  (SplitReductionMaxWeightSize + weight_size - 1) / weight_size,
+                                  reduction_length / SplitReductionMinLength}));
+    }
+
     // Invoker
     struct Invoker : public device::BaseInvoker
     {
@@ -84,6 +121,11 @@ struct ReferenceConvBwdWeight : public device::BaseOperator
                 throw std::runtime_error("wrong! inconsistent dimension");
             }
 
+            if(const std::size_t num_split = GetNumReductionSplit(arg); num_split > 1)
+            {
+                return RunSplitReduction(arg, num_split);
+            }
+
             if constexpr(NDimSpatial == 1)
             {
                 auto f_kcx = [&](auto g, auto k, auto c, auto x) {
@@ -274,6 +316,153 @@ struct ReferenceConvBwdWeight : public device::BaseOperator
         {
             return Run(*dynamic_cast<const Argument*>(p_arg));
         }
+
+        private:
+        // Each weight element sums num_split contiguous parts of its N x output spatial positions
+        // in separate tasks. The partial sums are then added pairwise in a fixed tree order.
+        static float RunSplitReduction(const Argument& arg, std::size_t num_split)
+        {
+            const auto& in_lengths  = arg.input_.GetLengths();
+            const auto& in_strides  = arg.input_.GetStrides();
+            const auto& wei_lengths = arg.weight_.GetLengths();
+            const auto& wei_strides = arg.weight_.GetStrides();
+            const auto& out_lengths = arg.output_.GetLengths();
+            const auto& out_strides = arg.output_.GetStrides();
+
+            const std::size_t weight_size = arg.weight_.GetElementSize();
+
+            std::size_t out_spatial_size = 1;
+
+            for(std::size_t d = 0; d < NDimSpatial; ++d)
+            {
+                out_spatial_size *= out_lengths[3 + d];
+            }
+
+            const std::size_t reduction_length = out_lengths[1] * out_spatial_size;
+            const std::size_t split_length     = (reduction_length + num_split - 1) / num_split;
+
+            // [G, K, C, Z, Y, X] index of the weight element w, packed in this order
+            auto weight_index = [&](std::size_t w) {
+                std::array<std::size_t, NDimSpatial + 3> idx{};
+
+                for(std::size_t d = NDimSpatial + 3; d > 0; --d)
+                {
+                    idx[d - 1] = w % wei_lengths[d - 1];
+                    w /= wei_lengths[d - 1];
+                }
+
+                return idx;
+            };
+
+            std::vector<float> partial(weight_size * num_split);
+
+            auto accumulate = [&](std::size_t task) {
+                const auto wei_idx = weight_index(task / num_split);
+
+                const std::size_t g = wei_idx[0];
+                const std::size_t k = wei_idx[1];
+                const std::size_t c = wei_idx[2];
+
+                const std::size_t begin =
+                    std::min(reduction_length, (task % num_split) * split_length);
+                const std::size_t end = std::min(reduction_length, begin + split_length);
+
+                // [N, Do, Ho, Wo] index of the reduction position begin
+                std::size_t n = begin / out_spatial_size;
+                std::array<std::size_t, NDimSpatial> o{};
+
+                for(std::size_t d = NDimSpatial, i = begin % out_spatial_size; d > 0; --d)
+                {
+                    o[d - 1] = i % out_lengths[2 + d];
+                    i /= out_lengths[2 + d];
+                }
+
+                float v_acc = 0;
+
+                for(std::size_t r = begin; r < end; ++r)
+                {
+                    std::size_t in_offset =
+                        g * in_strides[0] + n * in_strides[1] + c * in_strides[2];
+                    std::size_t out_offset =
+                        g * out_strides[0] + n * out_strides[1] + k * out_strides[2];
+                    bool valid = true;
+
+                    for(std::size_t d = 0; d < NDimSpatial; ++d)
+                    {
+                        const auto i =
+                            static_cast<ck::long_index_t>(o[d] * arg.conv_strides_[d]) +
+                            static_cast<ck::long_index_t>(wei_idx[3 + d] * arg.conv_dilations_[d]) -
+                            static_cast<ck::long_index_t>(arg.in_left_pads_[d]);
+
+                        valid = valid && i >= 0 && static_cast<std::size_t>(i) < in_lengths[3 + d];
+                        in_offset += static_cast<std::size_t>(i) * in_strides[3 + d];
+                        out_offset += o[d] * out_strides[3 + d];
+                    }
+
+                    if(valid)
+                    {
+                        ComputeTypeA v_out;
+                        ComputeTypeB v_in;
+
+                        arg.out_element_op_(v_out,
+                                            ck::type_convert<float>(arg.output_.mData[out_offset]));
+
+                        arg.in_element_op_(v_in,
+                                           ck::type_convert<float>(arg.input_.mData[in_offset]));
+
+                        v_acc += type_convert<float>(v_out) * type_convert<float>(v_in);
+                    }
+
+                    // next reduction position
+                    std::size_t d = NDimSpatial;
+
+                    for(; d > 0 && ++o[d - 1] == out_lengths[2 + d]; --d)
+                    {
+                        o[d - 1] = 0;
+                    }
+
+                    if(d == 0)
+                    {
+                        ++n;
+                    }
+                }
+
+                partial[task] = v_acc;
+            };
+
+            auto& pool = ck::utils::HostThreadPool::GetInstance();
+
+            pool.ParallelFor(weight_size * num_split, accumulate);
+
+            pool.ParallelFor(weight_size, [&](std::size_t w) {
+                float* p_partial = partial.data() + w * num_split;
+
+                for(std::size_t stride = 1; stride < num_split; stride *= 2)
+                {
+                    for(std::size_t s = 0; s + stride < num_split; s += 2 * stride)
+                    {
+                        p_partial[s] += p_partial[s + stride];
+                    }
+                }
+
+                const auto wei_idx = weight_index(w);
+
+                std::size_t offset = 0;
+
+                for(std::size_t d = 0; d < NDimSpatial + 3; ++d)
+                {
+                    offset += wei_idx[d] * wei_strides[d];
+                }
+
+                float v_wei;
+
+                arg.wei_element_op_(v_wei, p_partial[0]);
+
+                arg.weight_.mData[offset] = ck::type_convert<WeiDataType>(v_wei);
+            });
+
+            return 0;
+        }
     };
 
     static constexpr bool IsValidCompilationParameter()
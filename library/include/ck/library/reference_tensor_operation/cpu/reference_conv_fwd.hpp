@@ -4,8 +4,12 @@
 #pragma once
 
 #include <cmath>
+#include <algorithm>
+#include <array>
+#include <complex>
 #include <cstdlib>
 #include <numeric>
+#include <tuple>
 #include <type_traits>
 #include <vector>
 
@@ -17,6 +21,8 @@
 #include "ck/library/utility/algorithm.hpp"
 #include "ck/library/utility/check_err.hpp"
 #include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_fft.hpp"
+#include "ck/library/utility/host_integer_gemm.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/convolution_parameter.hpp"
 #include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
@@ -113,6 +119,191 @@ struct ReferenceConvFwd : public device::BaseOperator
         OutElementwiseOperation out_element_op_;
     };
 
+    // int8/int4 convolutions accumulate exactly in int32, like the device kernels
+    static constexpr bool IsIntegerConv =
+        is_host_integer_gemm_type_v<InDataType> && is_host_integer_gemm_type_v<WeiDataType>;
+
+    // double convolutions accumulate in double, the others in float
+    static constexpr bool IsDoubleConv =
+        is_same_v<InDataType, double> && is_same_v<WeiDataType, double>;
+
+    using AccDataType =
+        std::conditional_t<IsIntegerConv, int32_t, std::conditional_t<IsDoubleConv, double, float>>;
+
+    // the int32 accumulator is passed to the output operation as is, e.g. to the requantization
+    // of Activation_Mul_Clamp, instead of being converted to OutDataType first
+    static constexpr bool OutElementOpTakesAcc =
+        IsIntegerConv && NumDElementwiseTensor == 0 &&
+        (!is_same_v<OutElementwiseOperation, element_wise::PassThrough> ||
+         is_same_v<OutDataType, int8_t> || is_same_v<OutDataType, int32_t> ||
+         is_same_v<OutDataType, int4_t>);
+
+    // without input and weight operations the integer convolution is an integer GEMM of the
+    // im2col rows of the input with the weights
+    static constexpr bool UseIntegerGemm =
+        IsIntegerConv && is_same_v<InElementwiseOperation, element_wise::PassThrough> &&
+        is_same_v<WeiElementwiseOperation, element_wise::PassThrough> &&
+        NumAElementwiseTensor == 0 && NumBElementwiseTensor == 0 && NumDElementwiseTensor == 0;
+
+    // Float convolutions with large filters run through FFTs, see RunFftConv(). The input and
+    // weight operations are applied while loading, so only elementwise A/B tensors rule it out.
+    static constexpr bool SupportsFftConv =
+        !IsIntegerConv && NumAElementwiseTensor == 0 && NumBElementwiseTensor == 0;
+
+    // smaller filters, e.g. 3x3x3 or 5x5, run as fast through the direct loops
+    static constexpr std::size_t FftConvMinFilterSize  = 32;
+    static constexpr std::size_t FftConvMaxBufferBytes = std::size_t{1} << 28;
+
+    // a multiply-add of the direct loops, with its index and bounds computations, takes about as
+    // long as this many of the FFT operations counted by UseFftConv()
+    static constexpr double FftConvDirectMacCost = 8;
+
+    // Overlap-save tiles of the stride 1 correlation, which holds the strided outputs at every
+    // stride-th position
+    struct FftConvTiling
+    {
+        std::array<std::size_t, NDimSpatial> fft_lengths_;
+        std::array<std::size_t, NDimSpatial> tile_lengths_;
+        std::array<std::size_t, NDimSpatial> num_tiles_;
+        std::size_t fft_size_ = 1;
+        std::size_t num_tile_ = 1;
+    };
+
+    // Per spatial dimension, the FFT length among the first few powers of 2 that hold twice the
+    // dilated filter which takes the fewest operations per output
+    static FftConvTiling GetFftConvTiling(const Argument& arg)
+    {
+        const auto& wei_lengths = arg.weight_.GetLengths();
+        const auto& out_lengths = arg.output_.GetLengths();
+
+        FftConvTiling tiling;
+
+        for(std::size_t d = 0; d < NDimSpatial; ++d)
+        {
+            const std::size_t filter_extent =
+                (wei_lengths[3 + d] - 1) * static_cast<std::size_t>(arg.conv_dilations_[d]) + 1;
+            const std::size_t full_length =
+                out_lengths[3 + d] == 0
+                    ? 1
+                    : (out_lengths[3 + d] - 1) * static_cast<std::size_t>(arg.conv_strides_[d]) + 1;
+
+            std::size_t fft_length = 1;
+            while(fft_length < std::min(2 * filter_extent, full_length + filter_extent - 1))
+            {
+                fft_length *= 2;
+            }
+
+            double best_cost = 0;
+
+            for(std::size_t i = 0; i < 4; ++i, fft_length *= 2)
+            {
+                const std::size_t tile_length = fft_length - filter_extent + 1;
+
+                const double cost = static_cast<double>(fft_length) *
+                                    (std::log2(static_cast<double>(fft_length)) + 4) /
+                                    static_cast<double>(std::min(tile_length, full_length));
+
+                if(i == 0 || cost < best_cost)
+                {
+                    best_cost               = cost;
+                    tiling.fft_lengths_[d]  = fft_length;
+                    tiling.tile_lengths_[d] = tile_length;
+                }
+
+                if(tile_length >= full_length)
+                {
+                    break;
+                }
+            }
+
+            tiling.num_tiles_[d] =
+                (full_length + tiling.tile_lengths_[d] - 1) / tiling.tile_lengths_[d];
+
+            tiling.fft_size_ *= tiling.fft_lengths_[d];
+            tiling.num_tile_ *= tiling.num_tiles_[d];
+        }
+
+        return tiling;
+    }
+
+    // value loaded into the FFTs, double data keeps its precision
+    template <typename DataType>
+    static double GetFftConvValue(const DataType& v)
+    {
+        if constexpr(is_same_v<DataType, double>)
+        {
+            return v;
+        }
+        else
+        {
+            return ck::type_convert<float>(v);
+        }
+    }
+
+    template <typename DataType>
+    static bool IsAllFinite(const Tensor<DataType>& tensor)
+    {
+        return std::all_of(tensor.mData.begin(), tensor.mData.end(), [](const DataType& v) {
+            return std::isfinite(GetFftConvValue(v));
+        });
+    }
+
+    // FFTs for filters of at least FftConvMinFilterSize taps when they are estimated to be faster
+    // than the direct loops. An Inf or NaN would spread over a whole FFT tile instead of only the
+    // outputs it contributes to, so inputs and weights with one take the direct loops.
+    static bool UseFftConv(const Argument& arg)
+    {
+        if constexpr(!SupportsFftConv)
+        {
+            ignore = arg;
+
+            return false;
+        }
+        else
+        {
+            const auto& wei_lengths = arg.weight_.GetLengths();
+            const auto& out_lengths = arg.output_.GetLengths();
+
+            const std::size_t G = out_lengths[0];
+            const std::size_t N = out_lengths[1];
+            const std::size_t K = out_lengths[2];
+            const std::size_t C = wei_lengths[2];
+
+            std::size_t filter_size = 1;
+
+            for(std::size_t d = 0; d < NDimSpatial; ++d)
+            {
+                filter_size *= wei_lengths[3 + d];
+            }
+
+            if(filter_size < FftConvMinFilterSize || arg.output_.GetElementSize() == 0 || C == 0)
+            {
+                return false;
+            }
+
+            const auto tiling = GetFftConvTiling(arg);
+
+            const double fft_size  = static_cast<double>(tiling.fft_size_);
+            const double fft_ops   = fft_size * std::log2(fft_size);
+            const double num_task  = static_cast<double>(G * N * tiling.num_tile_);
+            const double num_k     = static_cast<double>(K);
+            const double num_c     = static_cast<double>(C);
+            const double num_group = static_cast<double>(G);
+
+            // forward transforms of the input tiles and of the weights, products summed over C,
+            // inverse transforms
+            const double fft_cost = num_task * (num_c * fft_ops + num_k * num_c * 4 * fft_size +
+                                                num_k * fft_ops) +
+                                    num_group * num_k * num_c * fft_ops;
+            const double direct_cost =
+                static_cast<double>(arg.output_.GetElementSize() * C * filter_size);
+
+            return fft_cost < FftConvDirectMacCost * direct_cost &&
+                   C * tiling.fft_size_ * sizeof(std::complex<double>) <= FftConvMaxBufferBytes &&
+                   IsAllFinite(arg.input_) && IsAllFinite(arg.weight_);
+        }
+    }
+
     struct Invoker : public device::BaseInvoker
     {
         using Argument = ReferenceConvFwd::Argument;
@@ -126,10 +317,23 @@ struct ReferenceConvFwd : public device::BaseOperator
                 throw std::runtime_error("wrong! inconsistent dimension");
             }
 
+            if constexpr(UseIntegerGemm)
+            {
+                return RunIntegerGemm(arg);
+            }
+
+            if constexpr(SupportsFftConv)
+            {
+                if(UseFftConv(arg))
+                {
+                    return RunFftConv(arg);
+                }
+            }
+
             if constexpr(NDimSpatial == 1)
             {
                 auto func = [&](auto g, auto n, auto k, auto wo) {
-                    float v_acc = 0;
+                    AccDataType v_acc = 0;
 
                     for(std::size_t c = 0; c < arg.weight_.GetLengths()[2]; ++c)
                     {
@@ -163,22 +367,12 @@ struct ReferenceConvFwd : public device::BaseOperator
                                                      k,
                                                      c,
                                                      x);
-                                v_acc +=
-                                    ck::type_convert<float>(v_in) * ck::type_convert<float>(v_wei);
+                                v_acc += ck::type_convert<AccDataType>(v_in) *
+                                         ck::type_convert<AccDataType>(v_wei);
                             }
                         }
                     }
-                    OutDataType v_acc_converted = ck::type_convert<OutDataType>(v_acc);
-                    OutDataType& v_out          = arg.output_(g, n, k, wo);
-                    ExecuteElementwiseOp(arg.out_element_op_,
-                                         arg.elementwise_d_tensors_,
-                                         Number<NumDElementwiseTensor>{},
-                                         v_out,
-                                         v_acc_converted,
-                                         g,
-                                         n,
-                                         k,
-                                         wo);
+                    RunOutElementOp(arg, arg.output_(g, n, k, wo), v_acc, g, n, k, wo);
                 };
 
                 make_ParallelTensorFunctor(func,
@@ -193,7 +387,7 @@ struct ReferenceConvFwd : public device::BaseOperator
             else if constexpr(NDimSpatial == 2)
             {
                 auto func = [&](auto g, auto n, auto k, auto ho, auto wo) {
-                    float v_acc = 0;
+                    AccDataType v_acc = 0;
 
                     for(std::size_t c = 0; c < arg.weight_.GetLengths()[2]; ++c)
                     {
@@ -238,24 +432,13 @@ struct ReferenceConvFwd : public device::BaseOperator
                                                          c,
                                                          y,
                                                          x);
-                                    v_acc += ck::type_convert<float>(v_in) *
-                                             ck::type_convert<float>(v_wei);
+                                    v_acc += ck::type_convert<AccDataType>(v_in) *
+                                             ck::type_convert<AccDataType>(v_wei);
                                 }
                             }
                         }
                     }
-                    OutDataType v_acc_converted = ck::type_convert<OutDataType>(v_acc);
-                    OutDataType& v_out          = arg.output_(g, n, k, ho, wo);
-                    ExecuteElementwiseOp(arg.out_element_op_,
-                                         arg.elementwise_d_tensors_,
-                                         Number<NumDElementwiseTensor>{},
-                                         v_out,
-                                         v_acc_converted,
-                                         g,
-                                         n,
-                                         k,
-                                         ho,
-                                         wo);
+                    RunOutElementOp(arg, arg.output_(g, n, k, ho, wo), v_acc, g, n, k, ho, wo);
                 };
 
                 make_ParallelTensorFunctor(func,
@@ -271,7 +454,7 @@ struct ReferenceConvFwd : public device::BaseOperator
             else if constexpr(NDimSpatial == 3)
             {
                 auto func = [&](auto g, auto n, auto k, auto d_o, auto ho, auto wo) {
-                    float v_acc = 0;
+                    AccDataType v_acc = 0;
 
                     for(std::size_t c = 0; c < arg.weight_.GetLengths()[2]; ++c)
                     {
@@ -327,26 +510,15 @@ struct ReferenceConvFwd : public device::BaseOperator
                                                              z,
                                                              y,
                                                              x);
-                                        v_acc += ck::type_convert<float>(v_in) *
-                                                 ck::type_convert<float>(v_wei);
+                                        v_acc += ck::type_convert<AccDataType>(v_in) *
+                                                 ck::type_convert<AccDataType>(v_wei);
                                     }
                                 }
                             }
                         }
                     }
-                    OutDataType v_acc_converted = ck::type_convert<OutDataType>(v_acc);
-                    OutDataType& v_out          = arg.output_(g, n, k, d_o, ho, wo);
-                    ExecuteElementwiseOp(arg.out_element_op_,
-                                         arg.elementwise_d_tensors_,
-                                         Number<NumDElementwiseTensor>{},
-                                         v_out,
-                                         v_acc_converted,
-                                         g,
-                                         n,
-                                         k,
-                                         d_o,
-                                         ho,
-                                         wo);
+                    RunOutElementOp(
+                        arg, arg.output_(g, n, k, d_o, ho, wo), v_acc, g, n, k, d_o, ho, wo);
                 };
 
                 make_ParallelTensorFunctor(func,
@@ -369,6 +541,402 @@ struct ReferenceConvFwd : public device::BaseOperator
         {
             return Run(*dynamic_cast<const Argument*>(p_arg));
         }
+
+        private:
+        // f(idx) for every multi-index idx of lengths, row-major
+        template <typename F>
+        static void ForEachSpatialIndex(const std::array<std::size_t, NDimSpatial>& lengths, F&& f)
+        {
+            if(std::find(lengths.begin(), lengths.end(), 0) != lengths.end())
+            {
+                return;
+            }
+
+            std::array<std::size_t, NDimSpatial> idx{};
+
+            while(true)
+            {
+                f(idx);
+
+                std::size_t d = NDimSpatial;
+
+                for(; d > 0 && ++idx[d - 1] == lengths[d - 1]; --d)
+                {
+                    idx[d - 1] = 0;
+                }
+
+                if(d == 0)
+                {
+                    return;
+                }
+            }
+        }
+
+        // Per group, the conjugated spectra of the dilated weights of a chunk of K are computed
+        // once. Every (n, tile) task transforms its C input tiles, zero padding included, sums
+        // their products with the weight spectra over C and transforms back per k. The stride 1
+        // correlation of the tile is then decimated to the strided outputs in it.
+        static float RunFftConv(const Argument& arg)
+        {
+            using Complex = std::complex<double>;
+
+            const auto& in_lengths  = arg.input_.GetLengths();
+            const auto& in_strides  = arg.input_.GetStrides();
+            const auto& wei_lengths = arg.weight_.GetLengths();
+            const auto& wei_strides = arg.weight_.GetStrides();
+            const auto& out_lengths = arg.output_.GetLengths();
+            const auto& out_strides = arg.output_.GetStrides();
+
+            const std::size_t G = out_lengths[0];
+            const std::size_t N = out_lengths[1];
+            const std::size_t K = out_lengths[2];
+            const std::size_t C = wei_lengths[2];
+
+            const auto tiling = GetFftConvTiling(arg);
+
+            const utils::HostFftNdPlan fft(
+                std::vector<std::size_t>(tiling.fft_lengths_.begin(), tiling.fft_lengths_.end()));
+
+            const std::size_t P = tiling.fft_size_;
+
+            std::array<std::size_t, NDimSpatial> filter_lengths;
+            std::array<std::size_t, NDimSpatial> fft_strides;
+
+            for(std::size_t d = NDimSpatial, stride = 1; d > 0; --d)
+            {
+                filter_lengths[d - 1] = wei_lengths[2 + d];
+                fft_strides[d - 1]    = stride;
+                stride *= tiling.fft_lengths_[d - 1];
+            }
+
+            const std::size_t k_per_chunk =
+                std::max(std::size_t{1}, FftConvMaxBufferBytes / (C * P * sizeof(Complex)));
+
+            for(std::size_t g = 0; g < G; ++g)
+            {
+                for(std::size_t k_begin = 0; k_begin < K; k_begin += k_per_chunk)
+                {
+                    const std::size_t num_k = std::min(k_per_chunk, K - k_begin);
+
+                    std::vector<Complex> wei_spectra(num_k * C * P);
+
+                    auto& pool = ck::utils::HostThreadPool::GetInstance();
+
+                    pool.ParallelFor(num_k * C, [&](std::size_t kc) {
+                        const std::size_t k = k_begin + kc / C;
+                        const std::size_t c = kc % C;
+
+                        Complex* p_spectrum = wei_spectra.data() + kc * P;
+
+                        ForEachSpatialIndex(filter_lengths, [&](const auto& x) {
+                            std::size_t offset =
+                                g * wei_strides[0] + k * wei_strides[1] + c * wei_strides[2];
+                            std::size_t pos = 0;
+
+                            for(std::size_t d = 0; d < NDimSpatial; ++d)
+                            {
+                                offset += x[d] * wei_strides[3 + d];
+                                pos += x[d] * static_cast<std::size_t>(arg.conv_dilations_[d]) *
+                                       fft_strides[d];
+                            }
+
+                            WeiDataType v_wei;
+
+                            ExecuteElementwiseOp(arg.wei_element_op_,
+                                                 arg.elementwise_b_tensors_,
+                                                 Number<NumBElementwiseTensor>{},
+                                                 v_wei,
+                                                 arg.weight_.mData[offset]);
+
+                            p_spectrum[pos] = GetFftConvValue(v_wei);
+                        });
+
+                        fft.Forward(p_spectrum);
+
+                        for(std::size_t i = 0; i < P; ++i)
+                        {
+                            p_spectrum[i] = std::conj(p_spectrum[i]);
+                        }
+                    });
+
+                    auto run_tile = [&](std::size_t task) {
+                        const std::size_t n = task / tiling.num_tile_;
+
+                        // first stride 1 output of the tile
+                        std::array<std::size_t, NDimSpatial> origin;
+
+                        for(std::size_t d = NDimSpatial, i = task % tiling.num_tile_; d > 0; --d)
+                        {
+                            origin[d - 1] =
+                                (i % tiling.num_tiles_[d - 1]) * tiling.tile_lengths_[d - 1];
+                            i /= tiling.num_tiles_[d - 1];
+                        }
+
+                        std::vector<Complex> in_spectra(C * P);
+
+                        for(std::size_t c = 0; c < C; ++c)
+                        {
+                            Complex* p_spectrum = in_spectra.data() + c * P;
+
+                            ForEachSpatialIndex(tiling.fft_lengths_, [&](const auto& j) {
+                                std::size_t offset =
+                                    g * in_strides[0] + n * in_strides[1] + c * in_strides[2];
+                                std::size_t pos = 0;
+
+                                for(std::size_t d = 0; d < NDimSpatial; ++d)
+                                {
+                                    const auto i =
+                                        static_cast<ck::long_index_t>(origin[d] + j[d]) -
+                                        static_cast<ck::long_index_t>(arg.in_left_pads_[d]);
+
+                                    if(i < 0 || static_cast<std::size_t>(i) >= in_lengths[3 + d])
+                                    {
+                                        return;
+                                    }
+
+                                    offset += static_cast<std::size_t>(i) * in_strides[3 + d];
+                                    pos += j[d] * fft_strides[d];
+                                }
+
+                                InDataType v_in;
+
+                                ExecuteElementwiseOp(arg.in_element_op_,
+                                                     arg.elementwise_a_tensors_,
+                                                     Number<NumAElementwiseTensor>{},
+                                                     v_in,
+                                                     arg.input_.mData[offset]);
+
+                                p_spectrum[pos] = GetFftConvValue(v_in);
+                            });
+
+                            fft.Forward(p_spectrum);
+                        }
+
+                        std::vector<Complex> acc(P);
+
+                        for(std::size_t kk = 0; kk < num_k; ++kk)
+                        {
+                            std::fill(acc.begin(), acc.end(), Complex{});
+
+                            for(std::size_t c = 0; c < C; ++c)
+                            {
+                                const Complex* p_in  = in_spectra.data() + c * P;
+                                const Complex* p_wei = wei_spectra.data() + (kk * C + c) * P;
+
+                                for(std::size_t i = 0; i < P; ++i)
+                                {
+                                    acc[i] += utils::fft_multiply(p_in[i], p_wei[i]);
+                                }
+                            }
+
+                            fft.Inverse(acc.data());
+
+                            ForEachSpatialIndex(tiling.tile_lengths_, [&](const auto& j) {
+                                std::array<std::size_t, NDimSpatial + 3> out_idx{
+                                    g, n, k_begin + kk};
+                                std::size_t pos = 0;
+
+                                for(std::size_t d = 0; d < NDimSpatial; ++d)
+                                {
+                                    const std::size_t t      = origin[d] + j[d];
+                                    const std::size_t stride = arg.conv_strides_[d];
+
+                                    if(t % stride != 0 || t / stride >= out_lengths[3 + d])
+                                    {
+                                        return;
+                                    }
+
+                                    out_idx[3 + d] = t / stride;
+                                    pos += j[d] * fft_strides[d];
+                                }
+
+                                std::size_t offset = 0;
+
+                                for(std::size_t d = 0; d < NDimSpatial + 3; ++d)
+                                {
+                                    offset += out_idx[d] * out_strides[d];
+                                }
+
+                                std::apply(
+                                    [&](auto... idx) {
+                                        RunOutElementOp(arg,
+                                                        arg.output_.mData[offset],
+                                                        static_cast<AccDataType>(acc[pos].real()),
+                                                        idx...);
+                                    },
+                                    out_idx);
+                            });
+                        }
+                    };
+
+                    pool.ParallelFor(N * tiling.num_tile_, run_tile);
+                }
+            }
+
+            return 0;
+        }
+
+        template <typename... Args>
+        static void
+        RunOutElementOp(const Argument& arg, OutDataType& v_out, AccDataType v_acc, Args... dims)
+        {
+            if constexpr(OutElementOpTakesAcc)
+            {
+                ((ignore = dims), ...);
+                arg.out_element_op_(v_out, v_acc);
+            }
+            else
+            {
+                OutDataType v_acc_converted = ck::type_convert<OutDataType>(v_acc);
+                ExecuteElementwiseOp(arg.out_element_op_,
+                                     arg.elementwise_d_tensors_,
+                                     Number<NumDElementwiseTensor>{},
+                                     v_out,
+                                     v_acc_converted,
+                                     dims...);
+            }
+        }
+
+        // Per group, the [K, Z * Y * X * C] weights are multiplied with blocks of im2col rows of
+        // the input, one row of Z * Y * X * C values per output position (n, do, ho, wo)
+        static float RunIntegerGemm(const Argument& arg)
+        {
+            constexpr std::size_t RowsPerBlock = 64;
+
+            const auto& in_lengths  = arg.input_.GetLengths();
+            const auto& in_strides  = arg.input_.GetStrides();
+            const auto& wei_lengths = arg.weight_.GetLengths();
+            const auto& wei_strides = arg.weight_.GetStrides();
+            const auto& out_lengths = arg.output_.GetLengths();
+            const auto& out_strides = arg.output_.GetStrides();
+
+            const std::size_t G = out_lengths[0];
+            const std::size_t N = out_lengths[1];
+            const std::size_t K = out_lengths[2];
+            const std::size_t C = wei_lengths[2];
+
+            std::size_t filter_size      = 1;
+            std::size_t out_spatial_size = 1;
+
+            for(std::size_t d = 0; d < NDimSpatial; ++d)
+            {
+                filter_size *= wei_lengths[3 + d];
+                out_spatial_size *= out_lengths[3 + d];
+            }
+
+            const std::size_t gemm_k = filter_size * C;
+            const std::size_t rows   = N * out_spatial_size;
+
+            // multi-index of the last NDimSpatial dimensions of lengths, row-major
+            auto spatial_index = [](std::size_t i, const std::vector<std::size_t>& lengths) {
+                std::array<std::size_t, NDimSpatial> idx{};
+
+                for(std::size_t d = NDimSpatial; d > 0; --d)
+                {
+                    idx[d - 1] = i % lengths[2 + d];
+                    i /= lengths[2 + d];
+                }
+
+                return idx;
+            };
+
+            for(std::size_t g = 0; g < G; ++g)
+            {
+                const auto wei_packed =
+                    pack_integer_gemm_rows(K, gemm_k, [&](std::size_t k, std::size_t fc) {
+                        const auto x = spatial_index(fc / C, wei_lengths);
+
+                        std::size_t offset =
+                            g * wei_strides[0] + k * wei_strides[1] + (fc % C) * wei_strides[2];
+
+                        for(std::size_t d = 0; d < NDimSpatial; ++d)
+                        {
+                            offset += x[d] * wei_strides[3 + d];
+                        }
+
+                        return arg.weight_.mData[offset];
+                    });
+
+                auto run_block = [&](std::size_t block) {
+                    const std::size_t row_begin = block * RowsPerBlock;
+                    const std::size_t num_row   = std::min(RowsPerBlock, rows - row_begin);
+
+                    std::vector<int16_t> col(num_row * gemm_k, 0);
+
+                    for(std::size_t r = 0; r < num_row; ++r)
+                    {
+                        const std::size_t row = row_begin + r;
+                        const std::size_t n   = row / out_spatial_size;
+                        const auto o = spatial_index(row % out_spatial_size, out_lengths);
+
+                        for(std::size_t f = 0; f < filter_size; ++f)
+                        {
+                            const auto x = spatial_index(f, wei_lengths);
+
+                            std::size_t offset = g * in_strides[0] + n * in_strides[1];
+                            bool valid         = true;
+
+                            for(std::size_t d = 0; d < NDimSpatial; ++d)
+                            {
+                                const auto i =
+                                    static_cast<ck::long_index_t>(o[d] * arg.conv_strides_[d]) +
+                                    static_cast<ck::long_index_t>(x[d] * arg.conv_dilations_[d]) -
+                                    static_cast<ck::long_index_t>(arg.in_left_pads_[d]);
+
+                                valid = valid && i >= 0 &&
+                                        static_cast<std::size_t>(i) < in_lengths[3 + d];
+                                offset += static_cast<std::size_t>(i) * in_strides[3 + d];
+                            }
+
+                            if(!valid)
+                            {
+                                continue;
+                            }
+
+                            int16_t* p_col = col.data() + r * gemm_k + f * C;
+
+                            for(std::size_t c = 0; c < C; ++c)
+                            {
+                                p_col[c] = static_cast<int16_t>(
+                                    arg.input_.mData[offset + c * in_strides[2]]);
+                            }
+                        }
+                    }
+
+                    std::vector<int32_t> acc(num_row * K);
+
+                    integer_gemm_packed(
+                        col.data(), wei_packed.data(), acc.data(), num_row, K, gemm_k);
+
+                    for(std::size_t r = 0; r < num_row; ++r)
+                    {
+                        const std::size_t row = row_begin + r;
+                        const std::size_t n   = row / out_spatial_size;
+                        const auto o = spatial_index(row % out_spatial_size, out_lengths);
+
+                        std::size_t offset = g * out_strides[0] + n * out_strides[1];
+
+                        for(std::size_t d = 0; d < NDimSpatial; ++d)
+                        {
+                            offset += o[d] * out_strides[3 + d];
+                        }
+
+                        for(std::size_t k = 0; k < K; ++k)
+                        {
+                            RunOutElementOp(arg,
+                                            arg.output_.mData[offset + k * out_strides[2]],
+                                            acc[r * K + k]);
+                        }
+                    }
+                };
+
+                auto& pool = ck::utils::HostThreadPool::GetInstance();
+
+                pool.ParallelFor((rows + RowsPerBlock - 1) / RowsPerBlock, run_block);
+            }
+
+            return 0;
+        }
     };
 
     template <typename... Args,
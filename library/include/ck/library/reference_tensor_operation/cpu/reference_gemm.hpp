@@ -8,7 +8,9 @@
 
 #include "ck/tensor_operation/gpu/element/unary_element_wise_operation.hpp"
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/utility/host_integer_gemm.hpp"
 #include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tiled_tensor_functor.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -52,6 +54,58 @@ struct ReferenceGemm : public device::BaseOperator
         CElementwiseOperation c_element_op_;
     };
 
+    // int8/int4 A and B without element-wise operation are multiplied exactly in int32
+    static constexpr bool UseIntegerGemm =
+        is_host_integer_gemm_type_v<ADataType> && is_host_integer_gemm_type_v<BDataType> &&
+        is_same_v<AccDataType, int32_t> && is_same_v<ComputeTypeA, ADataType> &&
+        is_same_v<ComputeTypeB, BDataType> &&
+        is_same_v<AElementwiseOperation, ck::tensor_operation::element_wise::PassThrough> &&
+        is_same_v<BElementwiseOperation, ck::tensor_operation::element_wise::PassThrough>;
+
+    // sum over k of a_element_op(A(m, k)) * b_element_op(B(k, n)) in AccDataType, the inner loop
+    // of the reference, also used by ReferenceGemmMultipleD and ReferenceGroupedGemm
+    static AccDataType Accumulate(const Tensor<ADataType>& a_m_k,
+                                  const Tensor<BDataType>& b_k_n,
+                                  const AElementwiseOperation& a_element_op,
+                                  const BElementwiseOperation& b_element_op,
+                                  std::size_t m,
+                                  std::size_t n)
+    {
+        const std::size_t K = a_m_k.mDesc.GetLengths()[1];
+
+        AccDataType v_acc = 0;
+        ComputeTypeA v_a  = 0;
+        ComputeTypeB v_b  = 0;
+
+        for(std::size_t k = 0; k < K; ++k)
+        {
+            // use PassThrough instead of ConvertBF16RTN for reference calculation
+            if constexpr(is_same_v<AElementwiseOperation,
+                                   ck::tensor_operation::element_wise::ConvertBF16RTN>)
+            {
+                ck::tensor_operation::element_wise::PassThrough{}(v_a, a_m_k(m, k));
+            }
+            else
+            {
+                a_element_op(v_a, a_m_k(m, k));
+            }
+            // same for B matrix
+            if constexpr(is_same_v<BElementwiseOperation,
+                                   ck::tensor_operation::element_wise::ConvertBF16RTN>)
+            {
+                ck::tensor_operation::element_wise::PassThrough{}(v_b, b_k_n(k, n));
+            }
+            else
+            {
+                b_element_op(v_b, b_k_n(k, n));
+            }
+
+            v_acc += ck::type_convert<AccDataType>(v_a) * ck::type_convert<AccDataType>(v_b);
+        }
+
+        return v_acc;
+    }
+
     // Invoker
     struct Invoker : public device::BaseInvoker
     {
@@ -59,40 +113,31 @@ struct ReferenceGemm : public device::BaseOperator
 
         float Run(const Argument& arg)
         {
-            auto f_mk_kn_mn = [&](auto m, auto n) {
-                const int K = arg.a_m_k_.mDesc.GetLengths()[1];
+            if constexpr(UseIntegerGemm)
+            {
+                const auto acc      = integer_gemm(arg.a_m_k_, arg.b_k_n_);
+                const std::size_t M = arg.c_m_n_.mDesc.GetLengths()[0];
+                const std::size_t N = arg.c_m_n_.mDesc.GetLengths()[1];
 
-                AccDataType v_acc = 0;
-                ComputeTypeA v_a  = 0;
-                ComputeTypeB v_b  = 0;
-
-                for(int k = 0; k < K; ++k)
+                for(std::size_t m = 0; m < M; ++m)
                 {
-                    // use PassThrough instead of ConvertBF16RTN for reference calculation
-                    if constexpr(is_same_v<AElementwiseOperation,
-                                           ck::tensor_operation::element_wise::ConvertBF16RTN>)
-                    {
-                        ck::tensor_operation::element_wise::PassThrough{}(v_a, arg.a_m_k_(m, k));
-                    }
-                    else
-                    {
-                        arg.a_element_op_(v_a, arg.a_m_k_(m, k));
-                    }
-                    // same for B matrix
-                    if constexpr(is_same_v<BElementwiseOperation,
-                                           ck::tensor_operation::element_wise::ConvertBF16RTN>)
+                    for(std::size_t n = 0; n < N; ++n)
                     {
-                        ck::tensor_operation::element_wise::PassThrough{}(v_b, arg.b_k_n_(k, n));
-                    }
-                    else
-                    {
-                        arg.b_element_op_(v_b, arg.b_k_n_(k, n));
-                    }
+                        CDataType v_c = 0;
 
-                    v_acc +=
-                        ck::type_convert<AccDataType>(v_a) * ck::type_convert<AccDataType>(v_b);
+                        arg.c_element_op_(v_c, acc[m * N + n]);
+
+                        arg.c_m_n_(m, n) = v_c;
+                    }
                 }
 
+                return 0;
+            }
+
+            auto f_mk_kn_mn = [&](auto m, auto n) {
+                const AccDataType v_acc =
+                    Accumulate(arg.a_m_k_, arg.b_k_n_, arg.a_element_op_, arg.b_element_op_, m, n);
+
                 CDataType v_c = 0;
 
                 arg.c_element_op_(v_c, v_acc);
@@ -100,7 +145,8 @@ struct ReferenceGemm : public device::BaseOperator
                 arg.c_m_n_(m, n) = v_c;
             };
 
-            make_ParallelTensorFunctor(
+            // M x N tiles along a Hilbert curve keep the B columns of a tile in cache
+            make_TiledParallelTensorFunctor(
                 f_mk_kn_mn, arg.c_m_n_.mDesc.GetLengths()[0], arg.c_m_n_.mDesc.GetLengths()[1])(
                 std::thread::hardware_concurrency());
 
@@ -0,0 +1,198 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <iostream>
+#include <sstream>
+#include <tuple>
+#include <utility>
+
+#include "ck/tensor_operation/gpu/element/unary_element_wise_operation.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+#include "ck/library/utility/host_integer_gemm.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tiled_tensor_functor.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+// E = cde_element_op(A * B, D0, D1, ...), the host counterpart of DeviceGemmMultipleD.
+//
+// The CDE operation gets the AccDataType result of an element together with the Ds at the same
+// (m, n), right after it has been accumulated, so no M x N accumulator tensor and no second pass
+// over it are needed. Ds are accessed through their descriptors, a bias broadcast along M is a
+// D with stride 0 for m. int8/int4 A and B are multiplied by integer_gemm() first instead, which
+// is exact and much faster than accumulating element by element.
+template <typename ADataType,
+          typename BDataType,
+          typename DsDataType,
+          typename EDataType,
+          typename AccDataType,
+          typename AElementwiseOperation,
+          typename BElementwiseOperation,
+          typename CDEElementwiseOperation,
+          typename ComputeTypeA = ADataType,
+          typename ComputeTypeB = ComputeTypeA>
+struct ReferenceGemmMultipleD : public device::BaseOperator
+{
+    static constexpr index_t NumDTensor = DsDataType::Size();
+
+    template <typename... DDataType>
+    static auto GetDsTensors(ck::Tuple<DDataType...>) -> std::tuple<const Tensor<DDataType>&...>;
+
+    // std::tuple<const Tensor<D0DataType>&, const Tensor<D1DataType>&, ...>
+    using DsTensors = decltype(GetDsTensors(std::declval<DsDataType>()));
+
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(const Tensor<ADataType>& a_m_k,
+                 const Tensor<BDataType>& b_k_n,
+                 DsTensors ds_m_n,
+                 Tensor<EDataType>& e_m_n,
+                 AElementwiseOperation a_element_op,
+                 BElementwiseOperation b_element_op,
+                 CDEElementwiseOperation cde_element_op)
+            : a_m_k_{a_m_k},
+              b_k_n_{b_k_n},
+              ds_m_n_{ds_m_n},
+              e_m_n_{e_m_n},
+              a_element_op_{a_element_op},
+              b_element_op_{b_element_op},
+              cde_element_op_{cde_element_op}
+        {
+        }
+
+        const Tensor<ADataType>& a_m_k_;
+        const Tensor<BDataType>& b_k_n_;
+        DsTensors ds_m_n_;
+        Tensor<EDataType>& e_m_n_;
+
+        AElementwiseOperation a_element_op_;
+        BElementwiseOperation b_element_op_;
+        CDEElementwiseOperation cde_element_op_;
+    };
+
+    // A * B is accumulated the same way as by ReferenceGemm
+    using ReferenceGemmInstance = ReferenceGemm<ADataType,
+                                                BDataType,
+                                                EDataType,
+                                                AccDataType,
+                                                AElementwiseOperation,
+                                                BElementwiseOperation,
+                                                ck::tensor_operation::element_wise::PassThrough,
+                                                ComputeTypeA,
+                                                ComputeTypeB>;
+
+    // int8/int4 A and B without element-wise operation are multiplied exactly in int32
+    static constexpr bool UseIntegerGemm = ReferenceGemmInstance::UseIntegerGemm;
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferenceGemmMultipleD::Argument;
+
+        float Run(const Argument& arg)
+        {
+            if constexpr(UseIntegerGemm)
+            {
+                const auto acc      = integer_gemm(arg.a_m_k_, arg.b_k_n_);
+                const std::size_t M = arg.e_m_n_.mDesc.GetLengths()[0];
+                const std::size_t N = arg.e_m_n_.mDesc.GetLengths()[1];
+
+                for(std::size_t m = 0; m < M; ++m)
+                {
+                    for(std::size_t n = 0; n < N; ++n)
+                    {
+                        EDataType v_e = 0;
+
+                        std::apply(
+                            [&](const auto&... ds_m_n) {
+                                arg.cde_element_op_(v_e, acc[m * N + n], ds_m_n(m, n)...);
+                            },
+                            arg.ds_m_n_);
+
+                        arg.e_m_n_(m, n) = v_e;
+                    }
+                }
+
+                return 0;
+            }
+
+            auto f_mk_kn_mn = [&](auto m, auto n) {
+                const AccDataType v_acc = ReferenceGemmInstance::Accumulate(
+                    arg.a_m_k_, arg.b_k_n_, arg.a_element_op_, arg.b_element_op_, m, n);
+
+                EDataType v_e = 0;
+
+                std::apply(
+                    [&](const auto&... ds_m_n) {
+                        arg.cde_element_op_(v_e, v_acc, ds_m_n(m, n)...);
+                    },
+                    arg.ds_m_n_);
+
+                arg.e_m_n_(m, n) = v_e;
+            };
+
+            // the Ds tiles are read along with the E tile they are applied to
+            make_TiledParallelTensorFunctor(
+                f_mk_kn_mn, arg.e_m_n_.mDesc.GetLengths()[0], arg.e_m_n_.mDesc.GetLengths()[1])(
+                std::thread::hardware_concurrency());
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    static auto MakeArgument(const Tensor<ADataType>& a_m_k,
+                             const Tensor<BDataType>& b_k_n,
+                             DsTensors ds_m_n,
+                             Tensor<EDataType>& e_m_n,
+                             AElementwiseOperation a_element_op,
+                             BElementwiseOperation b_element_op,
+                             CDEElementwiseOperation cde_element_op)
+    {
+        return Argument{
+            a_m_k, b_k_n, ds_m_n, e_m_n, a_element_op, b_element_op, cde_element_op};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceGemmMultipleD"
+            << "<NumDTensor " << NumDTensor << ">"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
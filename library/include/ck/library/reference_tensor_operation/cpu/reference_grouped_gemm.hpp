@@ -0,0 +1,214 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include "ck/tensor_operation/gpu/element/unary_element_wise_operation.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+// C[i] = A[i] * B[i] for every group i, the host counterpart of DeviceGroupedGemm.
+//
+// Groups can have different M, N, K and strides. Instead of one ReferenceGemm per group, the M x N
+// tiles of all groups go into a single work list, ordered by their cost TileM * TileN * K, most
+// expensive first, and are handed out one at a time to the threads of HostThreadPool. Thousands
+// of small groups then cost no thread launches, and a few large groups no longer leave cores idle
+// while the small ones are done.
+template <typename ADataType,
+          typename BDataType,
+          typename CDataType,
+          typename AccDataType,
+          typename AElementwiseOperation,
+          typename BElementwiseOperation,
+          typename CElementwiseOperation,
+          typename ComputeTypeA = ADataType,
+          typename ComputeTypeB = ComputeTypeA>
+struct ReferenceGroupedGemm : public device::BaseOperator
+{
+    static constexpr std::size_t TileM = 32;
+    static constexpr std::size_t TileN = 32;
+
+    // every element of a group is computed by the inner loop of ReferenceGemm
+    using ReferenceGemmInstance = ReferenceGemm<ADataType,
+                                                BDataType,
+                                                CDataType,
+                                                AccDataType,
+                                                AElementwiseOperation,
+                                                BElementwiseOperation,
+                                                CElementwiseOperation,
+                                                ComputeTypeA,
+                                                ComputeTypeB>;
+
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(const std::vector<Tensor<ADataType>>& a_g_m_k,
+                 const std::vector<Tensor<BDataType>>& b_g_k_n,
+                 std::vector<Tensor<CDataType>>& c_g_m_n,
+                 AElementwiseOperation a_element_op,
+                 BElementwiseOperation b_element_op,
+                 CElementwiseOperation c_element_op)
+            : a_g_m_k_{a_g_m_k},
+              b_g_k_n_{b_g_k_n},
+              c_g_m_n_{c_g_m_n},
+              a_element_op_{a_element_op},
+              b_element_op_{b_element_op},
+              c_element_op_{c_element_op}
+        {
+            if(a_g_m_k_.size() != c_g_m_n_.size() || b_g_k_n_.size() != c_g_m_n_.size())
+            {
+                throw std::runtime_error("wrong! inconsistent number of groups");
+            }
+        }
+
+        const std::vector<Tensor<ADataType>>& a_g_m_k_;
+        const std::vector<Tensor<BDataType>>& b_g_k_n_;
+        std::vector<Tensor<CDataType>>& c_g_m_n_;
+
+        AElementwiseOperation a_element_op_;
+        BElementwiseOperation b_element_op_;
+        CElementwiseOperation c_element_op_;
+    };
+
+    struct Tile
+    {
+        std::size_t group_;
+        std::size_t m_begin_;
+        std::size_t n_begin_;
+        std::size_t cost_;
+    };
+
+    // tiles of all groups, most expensive first
+    static std::vector<Tile> GetTiles(const Argument& arg)
+    {
+        std::vector<Tile> tiles;
+
+        for(std::size_t g = 0; g < arg.c_g_m_n_.size(); ++g)
+        {
+            const std::size_t M = arg.c_g_m_n_[g].mDesc.GetLengths()[0];
+            const std::size_t N = arg.c_g_m_n_[g].mDesc.GetLengths()[1];
+            const std::size_t K = arg.a_g_m_k_[g].mDesc.GetLengths()[1];
+
+            for(std::size_t m = 0; m < M; m += TileM)
+            {
+                for(std::size_t n = 0; n < N; n += TileN)
+                {
+                    // + 1 so that tiles with K = 0 still count for writing C
+                    const std::size_t cost =
+                        std::min(TileM, M - m) * std::min(TileN, N - n) * (K + 1);
+
+                    tiles.push_back({g, m, n, cost});
+                }
+            }
+        }
+
+        std::stable_sort(tiles.begin(), tiles.end(), [](const Tile& a, const Tile& b) {
+            return a.cost_ > b.cost_;
+        });
+
+        return tiles;
+    }
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferenceGroupedGemm::Argument;
+
+        static void RunTile(const Argument& arg, const Tile& tile)
+        {
+            const auto& a_m_k = arg.a_g_m_k_[tile.group_];
+            const auto& b_k_n = arg.b_g_k_n_[tile.group_];
+            auto& c_m_n       = arg.c_g_m_n_[tile.group_];
+
+            const std::size_t M = c_m_n.mDesc.GetLengths()[0];
+            const std::size_t N = c_m_n.mDesc.GetLengths()[1];
+
+            const std::size_t m_end = std::min(tile.m_begin_ + TileM, M);
+            const std::size_t n_end = std::min(tile.n_begin_ + TileN, N);
+
+            for(std::size_t m = tile.m_begin_; m < m_end; ++m)
+            {
+                for(std::size_t n = tile.n_begin_; n < n_end; ++n)
+                {
+                    const AccDataType v_acc = ReferenceGemmInstance::Accumulate(
+                        a_m_k, b_k_n, arg.a_element_op_, arg.b_element_op_, m, n);
+
+                    CDataType v_c = 0;
+
+                    arg.c_element_op_(v_c, v_acc);
+
+                    c_m_n(m, n) = v_c;
+                }
+            }
+        }
+
+        float Run(const Argument& arg)
+        {
+            const auto tiles = GetTiles(arg);
+
+            ck::utils::HostThreadPool::GetInstance().ParallelFor(
+                tiles.size(), [&](std::size_t i) { RunTile(arg, tiles[i]); });
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    static auto MakeArgument(const std::vector<Tensor<ADataType>>& a_g_m_k,
+                             const std::vector<Tensor<BDataType>>& b_g_k_n,
+                             std::vector<Tensor<CDataType>>& c_g_m_n,
+                             AElementwiseOperation a_element_op,
+                             BElementwiseOperation b_element_op,
+                             CElementwiseOperation c_element_op)
+    {
+        return Argument{a_g_m_k, b_g_k_n, c_g_m_n, a_element_op, b_element_op, c_element_op};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceGroupedGemm"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
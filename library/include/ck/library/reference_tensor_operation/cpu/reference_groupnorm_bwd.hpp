@@ -9,6 +9,8 @@
 #include <algorithm>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_normalization_bwd.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 
@@ -91,84 +93,55 @@ struct ReferenceGroupnormBwd : public device::BaseOperator
     {
         float Run(const Argument& arg)
         {
-            int N = arg.lengths_[0];
-            int H = arg.lengths_[1];
-            int W = arg.lengths_[2];
-            int G = arg.lengths_[3];
-            int C = arg.lengths_[4];
-
-            // Calculate dgamma and dbeta
-            for(int g = 0; g < G; ++g)
-                for(int c = 0; c < C; ++c)
-                {
-                    ComputeDataType dgamma = 0;
-                    ComputeDataType dbeta  = 0;
-
-                    for(int n = 0; n < N; ++n)
-                        for(int h = 0; h < H; ++h)
-                            for(int w = 0; w < W; ++w)
-                            {
-                                ComputeDataType dy =
-                                    ck::type_convert<ComputeDataType>(arg.dy_nhwgc_(n, h, w, g, c));
-                                ComputeDataType x =
-                                    ck::type_convert<ComputeDataType>(arg.x_nhwgc_(n, h, w, g, c));
-                                ComputeDataType mean =
-                                    ck::type_convert<ComputeDataType>(arg.mean_ng_(n, g));
-                                ComputeDataType rstd =
-                                    ck::type_convert<ComputeDataType>(arg.inv_std_ng_(n, g));
-                                dgamma += dy * rstd * (x - mean);
-                                dbeta += dy;
-                            }
-                    arg.dgamma_gc_(g, c) = ck::type_convert<DGammaDataType>(dgamma);
-                    arg.dbeta_gc_(g, c)  = ck::type_convert<DBetaDataType>(dbeta);
-                }
-
-            // Calculate dx
-            int reduce_size = H * W * C;
-            for(int n = 0; n < N; ++n)
-                for(int g = 0; g < G; ++g)
-                {
-                    ComputeDataType ds = 0;
-                    ComputeDataType db = 0;
-
-                    ComputeDataType mean = ck::type_convert<ComputeDataType>(arg.mean_ng_(n, g));
-                    ComputeDataType rstd = ck::type_convert<ComputeDataType>(arg.inv_std_ng_(n, g));
-
-                    for(int h = 0; h < H; ++h)
-                        for(int w = 0; w < W; ++w)
-                            for(int c = 0; c < C; ++c)
-                            {
-                                ComputeDataType dy =
-                                    ck::type_convert<ComputeDataType>(arg.dy_nhwgc_(n, h, w, g, c));
-                                ComputeDataType x =
-                                    ck::type_convert<ComputeDataType>(arg.x_nhwgc_(n, h, w, g, c));
-                                ComputeDataType gamma =
-                                    ck::type_convert<ComputeDataType>(arg.gamma_gc_(g, c));
-
-                                ds += dy * gamma * x;
-                                db += dy * gamma;
-                            }
-
-                    for(int h = 0; h < H; ++h)
-                        for(int w = 0; w < W; ++w)
-                            for(int c = 0; c < C; ++c)
-                            {
-                                ComputeDataType dy =
-                                    ck::type_convert<ComputeDataType>(arg.dy_nhwgc_(n, h, w, g, c));
-                                ComputeDataType x =
-                                    ck::type_convert<ComputeDataType>(arg.x_nhwgc_(n, h, w, g, c));
-                                ComputeDataType gamma =
-                                    ck::type_convert<ComputeDataType>(arg.gamma_gc_(g, c));
-
-                                ComputeDataType b =
-                                    (db * mean - ds) * rstd * rstd * rstd / reduce_size;
-                                ComputeDataType c1 = -b * mean - db * rstd / reduce_size;
-                                arg.dx_nhwgc_(n, h, w, g, c) =
-                                    ck::type_convert<DXDataType>(dy * gamma * rstd + b * x + c1);
-                            }
-                }
-
-            return 0;
+            using Layout = NormalizationBwdLayout;
+
+            const index_t N = arg.lengths_[0];
+            const index_t H = arg.lengths_[1];
+            const index_t W = arg.lengths_[2];
+            const index_t G = arg.lengths_[3];
+            const index_t C = arg.lengths_[4];
+
+            // a group per (n, g), a parameter per (g, c)
+            Layout layout;
+
+            layout.x_group_offsets_  = Layout::GetTensorOffsets(arg.x_nhwgc_.mDesc, {0, 3});
+            layout.dy_group_offsets_ = Layout::GetTensorOffsets(arg.dy_nhwgc_.mDesc, {0, 3});
+            layout.dx_group_offsets_ = Layout::GetTensorOffsets(arg.dx_nhwgc_.mDesc, {0, 3});
+            layout.mean_offsets_     = Layout::GetTensorOffsets(arg.mean_ng_.mDesc, {0, 1});
+            layout.inv_std_offsets_  = Layout::GetTensorOffsets(arg.inv_std_ng_.mDesc, {0, 1});
+            layout.group_params_     = Layout::GetOffsets({N, G}, {0, static_cast<std::size_t>(C)});
+
+            layout.x_reduce_offsets_  = Layout::GetTensorOffsets(arg.x_nhwgc_.mDesc, {1, 2, 4});
+            layout.dy_reduce_offsets_ = Layout::GetTensorOffsets(arg.dy_nhwgc_.mDesc, {1, 2, 4});
+            layout.dx_reduce_offsets_ = Layout::GetTensorOffsets(arg.dx_nhwgc_.mDesc, {1, 2, 4});
+            layout.reduce_params_     = Layout::GetOffsets({H, W, C}, {0, 0, 1});
+
+            layout.gamma_offsets_  = Layout::GetTensorOffsets(arg.gamma_gc_.mDesc, {0, 1});
+            layout.dgamma_offsets_ = Layout::GetTensorOffsets(arg.dgamma_gc_.mDesc, {0, 1});
+            layout.dbeta_offsets_  = Layout::GetTensorOffsets(arg.dbeta_gc_.mDesc, {0, 1});
+
+            using ReferenceInstance = ReferenceNormalizationBwd<DYDataType,
+                                                                XDataType,
+                                                                GammaDataType,
+                                                                MeanInvStdDataType,
+                                                                DGammaDataType,
+                                                                DBetaDataType,
+                                                                DXDataType,
+                                                                ComputeDataType,
+                                                                element_wise::PassThrough>;
+
+            return ReferenceInstance::MakeInvoker().Run(
+                ReferenceInstance::MakeArgument(std::move(layout),
+                                                arg.dy_nhwgc_.mData.data(),
+                                                arg.x_nhwgc_.mData.data(),
+                                                arg.gamma_gc_.mData.data(),
+                                                arg.mean_ng_.mData.data(),
+                                                arg.inv_std_ng_.mData.data(),
+                                                0.0,
+                                                element_wise::PassThrough{},
+                                                arg.dgamma_gc_.mData.data(),
+                                                arg.dbeta_gc_.mData.data(),
+                                                arg.dx_nhwgc_.mData.data()));
         }
 
         float Run(const device::BaseArgument* p_arg,
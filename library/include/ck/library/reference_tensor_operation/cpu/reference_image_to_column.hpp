@@ -3,13 +3,17 @@
 
 #pragma once
 
+#include <array>
+#include <cstring>
 #include <iostream>
 #include <type_traits>
 #include <sstream>
+#include <vector>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
 #include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
 #include "ck/library/utility/numeric.hpp"
 
 namespace ck {
@@ -91,6 +95,64 @@ struct ReferenceImageToColumn : public device::BaseOperator
     {
         using Argument = ReferenceImageToColumn::Argument;
 
+        // tap * dilation along every spatial dimension, for the filter taps in column order
+        static std::vector<std::array<long_index_t, NDimSpatial>>
+        GetFilterTapOffsets(const Argument& arg)
+        {
+            std::vector<std::array<long_index_t, NDimSpatial>> taps(1);
+
+            for(std::size_t d = 0; d < NDimSpatial; ++d)
+            {
+                std::vector<std::array<long_index_t, NDimSpatial>> next_taps;
+
+                for(const auto& tap : taps)
+                {
+                    for(index_t x = 0; x < arg.filter_spatial_lengths_[d]; ++x)
+                    {
+                        next_taps.push_back(tap);
+                        next_taps.back()[d] = static_cast<long_index_t>(x) * arg.conv_dilations_[d];
+                    }
+                }
+
+                taps = std::move(next_taps);
+            }
+
+            return taps;
+        }
+
+        static void CopyRun(const InDataType* p_src,
+                            std::size_t src_stride,
+                            OutDataType* p_dst,
+                            std::size_t dst_stride,
+                            std::size_t length)
+        {
+            if(src_stride == 1 && dst_stride == 1)
+            {
+                if constexpr(std::is_same_v<InDataType, OutDataType>)
+                {
+                    std::memcpy(p_dst, p_src, length * sizeof(InDataType));
+                }
+                else
+                {
+                    for(std::size_t i = 0; i < length; ++i)
+                    {
+                        p_dst[i] = ck::type_convert<OutDataType>(p_src[i]);
+                    }
+                }
+
+                return;
+            }
+
+            for(std::size_t i = 0; i < length; ++i)
+            {
+                p_dst[i * dst_stride] = ck::type_convert<OutDataType>(p_src[i * src_stride]);
+            }
+        }
+
+        // One task per (g, n, leading output indices) fills the Wo rows of one output line. C is
+        // contiguous in every image layout, so each filter tap of a row is one run of C elements
+        // that is copied at once; taps that fall into the padding are skipped as a whole and leave
+        // the output untouched.
         float Run(const Argument& arg)
         {
             if(!(arg.input_.GetNumOfDimension() == NDimSpatial + 3 &&
@@ -99,139 +161,73 @@ struct ReferenceImageToColumn : public device::BaseOperator
                 throw std::runtime_error("wrong! inconsistent dimension");
             }
 
-            const index_t G = arg.input_.GetLengths()[0];
-            const index_t N = arg.input_.GetLengths()[1];
-            const index_t C = arg.input_.GetLengths()[2];
+            const auto& image_lengths  = arg.input_.GetLengths();
+            const auto& image_strides  = arg.input_.GetStrides();
+            const auto& column_strides = arg.output_.GetStrides();
 
-            if constexpr(NDimSpatial == 1)
-            {
-                const index_t Wo = arg.output_spatial_lengths_[0];
-                auto func        = [&](auto g, auto n, auto wo) {
-                    index_t row    = n * Wo + wo;
-                    index_t column = 0;
+            const std::size_t G = image_lengths[0];
+            const std::size_t N = image_lengths[1];
+            const std::size_t C = image_lengths[2];
 
-                    for(index_t x = 0; x < arg.filter_spatial_lengths_[0]; ++x)
-                    {
-                        auto wi = static_cast<ck::long_index_t>(wo * arg.conv_strides_[0]) +
-                                  static_cast<ck::long_index_t>(x * arg.conv_dilations_[0]) -
-                                  static_cast<ck::long_index_t>(arg.in_left_pads_[0]);
+            const auto taps = GetFilterTapOffsets(arg);
 
-                        for(index_t c = 0; c < C; ++c)
-                        {
-                            if(wi >= 0 &&
-                               ck::type_convert<std::size_t>(wi) < arg.input_.GetLengths()[3])
-                            {
-                                InDataType v_in             = arg.input_(g, n, c, wi);
-                                arg.output_(g, row, column) = ck::type_convert<OutDataType>(v_in);
-                            }
-                            column++;
-                        }
-                    }
-                };
+            const std::size_t Wo       = arg.output_spatial_lengths_[NDimSpatial - 1];
+            const std::size_t num_line = ck::accumulate_n<std::size_t>(
+                arg.output_spatial_lengths_.begin(), NDimSpatial - 1, 1, std::multiplies<>());
 
-                make_ParallelTensorFunctor(func, G, N, Wo)(std::thread::hardware_concurrency());
+            const InDataType* p_image = arg.input_.mData.data();
+            OutDataType* p_column     = arg.output_.mData.data();
 
-                return 0;
-            }
-            else if constexpr(NDimSpatial == 2)
-            {
-                const index_t Ho = arg.output_spatial_lengths_[0];
-                const index_t Wo = arg.output_spatial_lengths_[1];
+            auto& pool = ck::utils::HostThreadPool::GetInstance();
 
-                auto func = [&](auto g, auto n, auto ho, auto wo) {
-                    index_t row    = n * Ho * Wo + ho * Wo + wo;
-                    index_t column = 0;
+            pool.ParallelFor(G * N * num_line, [&](std::size_t task) {
+                const std::size_t line = task % num_line;
+                const std::size_t n    = task / num_line % N;
+                const std::size_t g    = task / num_line / N;
 
-                    for(index_t y = 0; y < arg.filter_spatial_lengths_[0]; ++y)
-                    {
-                        auto hi = static_cast<ck::long_index_t>(ho * arg.conv_strides_[0]) +
-                                  static_cast<ck::long_index_t>(y * arg.conv_dilations_[0]) -
-                                  static_cast<ck::long_index_t>(arg.in_left_pads_[0]);
+                std::array<long_index_t, NDimSpatial> o{};
 
-                        for(index_t x = 0; x < arg.filter_spatial_lengths_[1]; ++x)
-                        {
-                            auto wi = static_cast<ck::long_index_t>(wo * arg.conv_strides_[1]) +
-                                      static_cast<ck::long_index_t>(x * arg.conv_dilations_[1]) -
-                                      static_cast<ck::long_index_t>(arg.in_left_pads_[1]);
-
-                            for(index_t c = 0; c < C; ++c)
-                            {
-
-                                if(hi >= 0 &&
-                                   ck::type_convert<std::size_t>(hi) < arg.input_.GetLengths()[3] &&
-                                   wi >= 0 &&
-                                   ck::type_convert<std::size_t>(wi) < arg.input_.GetLengths()[4])
-                                {
-                                    InDataType v_in = arg.input_(g, n, c, hi, wi);
-                                    arg.output_(g, row, column) =
-                                        ck::type_convert<OutDataType>(v_in);
-                                }
-                                column++;
-                            }
-                        }
-                    }
-                };
+                for(std::size_t d = NDimSpatial - 1, rest = line; d > 0; --d)
+                {
+                    o[d - 1] = static_cast<long_index_t>(rest % arg.output_spatial_lengths_[d - 1]);
+                    rest /= arg.output_spatial_lengths_[d - 1];
+                }
 
-                make_ParallelTensorFunctor(func, G, N, Ho, Wo)(std::thread::hardware_concurrency());
+                for(std::size_t wo = 0; wo < Wo; ++wo)
+                {
+                    o[NDimSpatial - 1] = static_cast<long_index_t>(wo);
 
-                return 0;
-            }
-            else if constexpr(NDimSpatial == 3)
-            {
-                const index_t Do = arg.output_spatial_lengths_[0];
-                const index_t Ho = arg.output_spatial_lengths_[1];
-                const index_t Wo = arg.output_spatial_lengths_[2];
+                    const std::size_t row = (n * num_line + line) * Wo + wo;
 
-                auto func = [&](auto g, auto n, auto d_o, auto ho, auto wo) {
-                    index_t row    = n * Do * Ho * Wo + d_o * Ho * Wo + ho * Wo + wo;
-                    index_t column = 0;
+                    OutDataType* p_row = p_column + g * column_strides[0] + row * column_strides[1];
 
-                    for(index_t z = 0; z < arg.filter_spatial_lengths_[0]; ++z)
+                    for(std::size_t tap = 0; tap < taps.size(); ++tap)
                     {
-                        auto di = static_cast<ck::long_index_t>(d_o * arg.conv_strides_[0]) +
-                                  static_cast<ck::long_index_t>(z * arg.conv_dilations_[0]) -
-                                  static_cast<ck::long_index_t>(arg.in_left_pads_[0]);
-                        for(index_t y = 0; y < arg.filter_spatial_lengths_[1]; ++y)
+                        std::size_t offset = g * image_strides[0] + n * image_strides[1];
+                        bool in_image      = true;
+
+                        for(std::size_t d = 0; d < NDimSpatial && in_image; ++d)
+                        {
+                            const long_index_t i =
+                                o[d] * arg.conv_strides_[d] + taps[tap][d] - arg.in_left_pads_[d];
+
+                            in_image = i >= 0 && static_cast<std::size_t>(i) < image_lengths[3 + d];
+                            offset += static_cast<std::size_t>(i) * image_strides[3 + d];
+                        }
+
+                        if(in_image)
                         {
-                            auto hi = static_cast<ck::long_index_t>(ho * arg.conv_strides_[1]) +
-                                      static_cast<ck::long_index_t>(y * arg.conv_dilations_[1]) -
-                                      static_cast<ck::long_index_t>(arg.in_left_pads_[1]);
-                            for(index_t x = 0; x < arg.filter_spatial_lengths_[2]; ++x)
-                            {
-                                auto wi =
-                                    static_cast<ck::long_index_t>(wo * arg.conv_strides_[2]) +
-                                    static_cast<ck::long_index_t>(x * arg.conv_dilations_[2]) -
-                                    static_cast<ck::long_index_t>(arg.in_left_pads_[2]);
-                                for(index_t c = 0; c < C; ++c)
-                                {
-                                    if(di >= 0 &&
-                                       ck::type_convert<std::size_t>(di) <
-                                           arg.input_.GetLengths()[3] &&
-                                       hi >= 0 &&
-                                       ck::type_convert<std::size_t>(hi) <
-                                           arg.input_.GetLengths()[4] &&
-                                       wi >= 0 &&
-                                       ck::type_convert<std::size_t>(wi) <
-                                           arg.input_.GetLengths()[5])
-                                    {
-                                        InDataType v_in = arg.input_(g, n, c, di, hi, wi);
-                                        arg.output_(g, row, column) =
-                                            ck::type_convert<OutDataType>(v_in);
-                                    }
-                                    column++;
-                                }
-                            }
+                            CopyRun(p_image + offset,
+                                    image_strides[2],
+                                    p_row + tap * C * column_strides[2],
+                                    column_strides[2],
+                                    C);
                         }
                     }
-                };
+                }
+            });
 
-                make_ParallelTensorFunctor(func, G, N, Do, Ho, Wo)(
-                    std::thread::hardware_concurrency());
-
-                return 0;
-            }
-            throw std::runtime_error("Img2Col: number of dimensions should be between 1 and 3.");
-            return 1;
+            return 0;
         }
 
         float Run(const device::BaseArgument* p_arg,
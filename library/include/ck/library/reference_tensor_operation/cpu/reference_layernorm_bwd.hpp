@@ -9,6 +9,8 @@
 #include <algorithm>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_normalization_bwd.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 
@@ -90,61 +92,52 @@ struct ReferenceLayernormBwd : public device::BaseOperator
     {
         float Run(const Argument& arg)
         {
-            int M = arg.lengths_[0];
-            int N = arg.lengths_[1];
-
-            // Calculate dgamma and dbeta
-            for(int n = 0; n < N; ++n)
-            {
-                ComputeDataType dgamma = 0;
-                ComputeDataType dbeta  = 0;
-
-                for(int m = 0; m < M; ++m)
-                {
-                    ComputeDataType dy   = ck::type_convert<ComputeDataType>(arg.dy_m_n_(m, n));
-                    ComputeDataType x    = ck::type_convert<ComputeDataType>(arg.x_m_n_(m, n));
-                    ComputeDataType mean = ck::type_convert<ComputeDataType>(arg.mean_m_(m));
-                    ComputeDataType rstd = ck::type_convert<ComputeDataType>(arg.inv_std_m_(m));
-                    dgamma += dy * rstd * (x - mean);
-                    dbeta += dy;
-                }
-                arg.dgamma_n_(n) = ck::type_convert<DGammaDataType>(dgamma);
-                arg.dbeta_n_(n)  = ck::type_convert<DBetaDataType>(dbeta);
-            }
-
-            // Calculate dx
-            for(int m = 0; m < M; ++m)
-            {
-                ComputeDataType ds = 0;
-                ComputeDataType db = 0;
-
-                ComputeDataType mean = ck::type_convert<ComputeDataType>(arg.mean_m_(m));
-                ComputeDataType rstd = ck::type_convert<ComputeDataType>(arg.inv_std_m_(m));
-
-                for(int n = 0; n < N; ++n)
-                {
-                    ComputeDataType dy    = ck::type_convert<ComputeDataType>(arg.dy_m_n_(m, n));
-                    ComputeDataType x     = ck::type_convert<ComputeDataType>(arg.x_m_n_(m, n));
-                    ComputeDataType gamma = ck::type_convert<ComputeDataType>(arg.gamma_n_(n));
-
-                    ds += dy * gamma * x;
-                    db += dy * gamma;
-                }
-
-                for(int n = 0; n < N; ++n)
-                {
-                    ComputeDataType dy    = ck::type_convert<ComputeDataType>(arg.dy_m_n_(m, n));
-                    ComputeDataType x     = ck::type_convert<ComputeDataType>(arg.x_m_n_(m, n));
-                    ComputeDataType gamma = ck::type_convert<ComputeDataType>(arg.gamma_n_(n));
-
-                    ComputeDataType b = (db * mean - ds) * rstd * rstd * rstd / N;
-                    ComputeDataType c = -b * mean - db * rstd / N;
-
-                    arg.dx_m_n_(m, n) = ck::type_convert<DXDataType>(dy * gamma * rstd + b * x + c);
-                }
-            }
-
-            return 0;
+            using Layout = NormalizationBwdLayout;
+
+            const index_t M = arg.lengths_[0];
+            const index_t N = arg.lengths_[1];
+
+            // a group per row m, a parameter per column n
+            Layout layout;
+
+            layout.x_group_offsets_  = Layout::GetTensorOffsets(arg.x_m_n_.mDesc, {0});
+            layout.dy_group_offsets_ = Layout::GetTensorOffsets(arg.dy_m_n_.mDesc, {0});
+            layout.dx_group_offsets_ = Layout::GetTensorOffsets(arg.dx_m_n_.mDesc, {0});
+            layout.mean_offsets_     = Layout::GetTensorOffsets(arg.mean_m_.mDesc, {0});
+            layout.inv_std_offsets_  = Layout::GetTensorOffsets(arg.inv_std_m_.mDesc, {0});
+            layout.group_params_     = Layout::GetOffsets({M}, {0});
+
+            layout.x_reduce_offsets_  = Layout::GetTensorOffsets(arg.x_m_n_.mDesc, {1});
+            layout.dy_reduce_offsets_ = Layout::GetTensorOffsets(arg.dy_m_n_.mDesc, {1});
+            layout.dx_reduce_offsets_ = Layout::GetTensorOffsets(arg.dx_m_n_.mDesc, {1});
+            layout.reduce_params_     = Layout::GetOffsets({N}, {1});
+
+            layout.gamma_offsets_  = Layout::GetTensorOffsets(arg.gamma_n_.mDesc, {0});
+            layout.dgamma_offsets_ = Layout::GetTensorOffsets(arg.dgamma_n_.mDesc, {0});
+            layout.dbeta_offsets_  = Layout::GetTensorOffsets(arg.dbeta_n_.mDesc, {0});
+
+            using ReferenceInstance = ReferenceNormalizationBwd<DYDataType,
+                                                                XDataType,
+                                                                GammaDataType,
+                                                                MeanInvStdDataType,
+                                                                DGammaDataType,
+                                                                DBetaDataType,
+                                                                DXDataType,
+                                                                ComputeDataType,
+                                                                element_wise::PassThrough>;
+
+            return ReferenceInstance::MakeInvoker().Run(
+                ReferenceInstance::MakeArgument(std::move(layout),
+                                                arg.dy_m_n_.mData.data(),
+                                                arg.x_m_n_.mData.data(),
+                                                arg.gamma_n_.mData.data(),
+                                                arg.mean_m_.mData.data(),
+                                                arg.inv_std_m_.mData.data(),
+                                                0.0,
+                                                element_wise::PassThrough{},
+                                                arg.dgamma_n_.mData.data(),
+                                                arg.dbeta_n_.mData.data(),
+                                                arg.dx_m_n_.mData.data()));
         }
 
         float Run(const device::BaseArgument* p_arg,
@@ -0,0 +1,369 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/utility/functional2.hpp"
+#include "ck/utility/ignore.hpp"
+#include "ck/utility/reduction_common.hpp"
+#include "ck/utility/reduction_functions_accumulate.hpp"
+#include "ck/utility/tuple.hpp"
+#include "ck/library/utility/host_common_util.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
+#include "ck/tensor_operation/gpu/device/device_multiple_reduce.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+// Whether the reduce operation reports if the accumulated value changed, i.e. whether it has an
+// index to output (Max, Min, AMax)
+template <typename ReduceOperation, typename AccDataType>
+inline constexpr bool is_indexable_reduce_operation_v =
+    std::is_invocable_v<ReduceOperation, AccDataType&, AccDataType, bool&>;
+
+// Host reference for NumReduction reductions of the same input over the same dims. The I-th
+// elements of ReduceOperationTuple, InElementwiseOperationTuple and AccElementwiseOperationTuple
+// make the I-th reduction, which writes an output of the I-th type of OutDataTypeTuple.
+//
+// All reductions are computed in one parallel pass over the output positions: the offsets of the
+// reduced positions are computed once, and every input element is read once and fed to all the
+// reductions. With OutputIndex, the indexable reductions also write the position of their result
+// in the reduced dims, as ReferenceReduce does, to their buffer in out_index_hosts.
+template <typename InDataType,
+          typename AccDataType,
+          typename OutDataTypeTuple,
+          index_t Rank,
+          index_t NumReduceDim,
+          typename ReduceOperationTuple,
+          typename InElementwiseOperationTuple,
+          typename AccElementwiseOperationTuple,
+          bool PropagateNan,
+          bool OutputIndex>
+struct ReferenceMultipleReduce
+    : public device::DeviceMultipleReduce<Rank,
+                                          NumReduceDim,
+                                          OutDataTypeTuple::Size(),
+                                          InElementwiseOperationTuple,
+                                          AccElementwiseOperationTuple>
+{
+    using IndexDataType = int32_t;
+
+    static constexpr index_t NumReduction = OutDataTypeTuple::Size();
+
+    static_assert(ReduceOperationTuple::Size() == NumReduction &&
+                      InElementwiseOperationTuple::Size() == NumReduction &&
+                      AccElementwiseOperationTuple::Size() == NumReduction,
+                  "All tuples must have one element per reduction!");
+
+    static constexpr index_t NumInvariantDim = Rank - NumReduceDim;
+
+    static constexpr index_t NumDstDim = (NumInvariantDim == 0) ? 1 : NumInvariantDim;
+
+    template <index_t I>
+    using ReduceOperation = remove_cvref_t<tuple_element_t<I, ReduceOperationTuple>>;
+
+    template <index_t I>
+    using OutDataType = remove_cvref_t<tuple_element_t<I, OutDataTypeTuple>>;
+
+    template <index_t I>
+    static constexpr bool OutputIndexOf =
+        OutputIndex && is_indexable_reduce_operation_v<ReduceOperation<I>, AccDataType>;
+
+    struct Argument : public device::BaseArgument
+    {
+        Argument(const std::array<index_t, Rank> inLengths,
+                 const std::array<index_t, Rank> inStrides,
+                 const std::array<index_t, NumDstDim> outLengths,
+                 const std::array<std::array<index_t, NumDstDim>, NumReduction> outStrides,
+                 const std::array<int, NumReduceDim> reduceDims,
+                 const std::array<double, NumReduction> alphas,
+                 const std::array<double, NumReduction> betas,
+                 const InDataType* in_host,
+                 const std::array<void*, NumReduction> out_hosts,
+                 const std::array<IndexDataType*, NumReduction> out_index_hosts,
+                 const InElementwiseOperationTuple in_elementwise_op_tuple,
+                 const AccElementwiseOperationTuple acc_elementwise_op_tuple)
+            : outStrides_(outStrides),
+              in_host_(in_host),
+              out_hosts_(out_hosts),
+              out_index_hosts_(out_index_hosts),
+              in_elementwise_op_tuple_(in_elementwise_op_tuple),
+              acc_elementwise_op_tuple_(acc_elementwise_op_tuple)
+        {
+            using ck::host_common::get_index_set;
+            using ck::host_common::get_offset_from_index;
+
+            if(std::any_of(
+                   reduceDims.begin(), reduceDims.end(), [](int d) { return d < 0 || d >= Rank; }))
+                throw std::runtime_error("Invalid reduce dimensions!");
+
+            std::array<index_t, NumReduceDim> reduce_lengths;
+            std::array<index_t, NumReduceDim> in_reduce_strides;
+
+            for(int i = 0; i < NumReduceDim; i++)
+            {
+                reduce_lengths[i]    = inLengths[reduceDims[i]];
+                in_reduce_strides[i] = inStrides[reduceDims[i]];
+            }
+
+            for(int dim = 0, i = 0; dim < Rank; dim++)
+            {
+                if(std::none_of(
+                       reduceDims.begin(), reduceDims.end(), [&](int d) { return d == dim; }))
+                {
+                    if(i == NumInvariantDim || inLengths[dim] != outLengths[i])
+                        throw std::runtime_error("Invalid lengths parameters!");
+
+                    invariant_lengths_[i]    = inLengths[dim];
+                    in_invariant_strides_[i] = inStrides[dim];
+                    i++;
+                }
+            }
+
+            num_invariant_ = 1;
+
+            for(int i = 0; i < NumInvariantDim; i++)
+                num_invariant_ *= invariant_lengths_[i];
+
+            // the traversal of the reduced dims is shared by all outputs, so it is set up once
+            for(const auto& reduce_index : get_index_set<NumReduceDim>(reduce_lengths))
+                in_reduce_offsets_.push_back(
+                    get_offset_from_index<NumReduceDim>(in_reduce_strides, reduce_index));
+
+            for(int i = 0; i < NumReduction; i++)
+            {
+                alphas_[i] = type_convert<AccDataType>(alphas[i]);
+                betas_[i]  = type_convert<AccDataType>(betas[i]);
+            }
+        };
+
+        std::array<index_t, NumInvariantDim> invariant_lengths_;
+        std::array<index_t, NumInvariantDim> in_invariant_strides_;
+        const std::array<std::array<index_t, NumDstDim>, NumReduction> outStrides_;
+
+        std::size_t num_invariant_;
+        std::vector<std::size_t> in_reduce_offsets_;
+
+        const InDataType* in_host_;
+        const std::array<void*, NumReduction> out_hosts_;
+        const std::array<IndexDataType*, NumReduction> out_index_hosts_;
+        const InElementwiseOperationTuple in_elementwise_op_tuple_;
+        const AccElementwiseOperationTuple acc_elementwise_op_tuple_;
+
+        std::array<AccDataType, NumReduction> alphas_;
+        std::array<AccDataType, NumReduction> betas_;
+    };
+
+    struct Invoker : public device::BaseInvoker
+    {
+        float Run(const Argument& arg, const StreamConfig& stream_config = StreamConfig{})
+        {
+            ignore = stream_config;
+
+            using ck::float_equal_one;
+            using ck::float_equal_zero;
+            using ck::type_convert;
+
+            auto thread_reduce_func = [&](std::size_t invariant) {
+                std::size_t in_invariant_offset = 0;
+                std::array<std::size_t, NumReduction> dst_offsets{};
+
+                // the output position of the invariant-th output, last dim fastest
+                for(int i = NumInvariantDim - 1; i >= 0; i--)
+                {
+                    const std::size_t index = invariant % arg.invariant_lengths_[i];
+
+                    invariant /= arg.invariant_lengths_[i];
+
+                    in_invariant_offset += index * arg.in_invariant_strides_[i];
+
+                    for(int r = 0; r < NumReduction; r++)
+                        dst_offsets[r] += index * arg.outStrides_[r][i];
+                }
+
+                std::array<AccDataType, NumReduction> accuVals;
+                std::array<IndexDataType, NumReduction> accuIndices{};
+
+                static_for<0, NumReduction, 1>{}([&](auto I) {
+                    using ReduceOp = ReduceOperation<I.value>;
+
+                    accuVals[I] = ReduceOp::template GetIdentityValue<AccDataType>();
+                });
+
+                for(std::size_t i = 0; i < arg.in_reduce_offsets_.size(); i++)
+                {
+                    const auto inVal = type_convert<AccDataType>(
+                        arg.in_host_[in_invariant_offset + arg.in_reduce_offsets_[i]]);
+
+                    static_for<0, NumReduction, 1>{}([&](auto I) {
+                        AccDataType currVal;
+
+                        arg.in_elementwise_op_tuple_[I](currVal, inVal);
+
+                        if constexpr(OutputIndexOf<I.value>)
+                        {
+                            using Accumulation =
+                                ck::detail::AccumulateWithIndexAndNanCheck<PropagateNan,
+                                                                           ReduceOperation<I.value>,
+                                                                           AccDataType,
+                                                                           IndexDataType>;
+
+                            Accumulation::Calculate(accuVals[I],
+                                                    currVal,
+                                                    accuIndices[I],
+                                                    static_cast<IndexDataType>(i));
+                        }
+                        else
+                        {
+                            using Accumulation =
+                                ck::detail::AccumulateWithNanCheck<PropagateNan,
+                                                                   ReduceOperation<I.value>,
+                                                                   AccDataType>;
+
+                            Accumulation::Calculate(accuVals[I], currVal);
+                        }
+                    });
+                }
+
+                static_for<0, NumReduction, 1>{}([&](auto I) {
+                    auto out_host = static_cast<OutDataType<I.value>*>(arg.out_hosts_[I]);
+
+                    AccDataType accuVal = accuVals[I];
+
+                    arg.acc_elementwise_op_tuple_[I](accuVal, accuVal);
+
+                    if(!float_equal_one{}(arg.alphas_[I]))
+                        accuVal *= arg.alphas_[I];
+
+                    if(!float_equal_zero{}(arg.betas_[I]))
+                        accuVal +=
+                            type_convert<AccDataType>(out_host[dst_offsets[I]]) * arg.betas_[I];
+
+                    out_host[dst_offsets[I]] = type_convert<OutDataType<I.value>>(accuVal);
+
+                    if constexpr(OutputIndexOf<I.value>)
+                        arg.out_index_hosts_[I][dst_offsets[I]] = accuIndices[I];
+                });
+            };
+
+            auto& pool = ck::utils::HostThreadPool::GetInstance();
+
+            pool.ParallelFor(arg.num_invariant_, thread_reduce_func);
+
+            return (0.0f);
+        };
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& stream_config = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg), stream_config);
+        };
+    };
+
+    bool IsSupportedArgument(const device::BaseArgument* p_arg) override
+    {
+        const auto* p_arg_ = dynamic_cast<const Argument*>(p_arg);
+
+        bool supported = true;
+
+        // every index output needs its buffer
+        static_for<0, NumReduction, 1>{}([&](auto I) {
+            if constexpr(OutputIndexOf<I.value>)
+                supported = supported && p_arg_->out_index_hosts_[I] != nullptr;
+        });
+
+        return supported;
+    };
+
+    static auto
+    MakeArgument(const std::array<index_t, Rank> inLengths,
+                 const std::array<index_t, Rank> inStrides,
+                 const std::array<index_t, NumDstDim> outLengths,
+                 const std::array<std::array<index_t, NumDstDim>, NumReduction> outStrides,
+                 const std::array<int, NumReduceDim> reduceDims,
+                 const std::array<double, NumReduction> alphas,
+                 const std::array<double, NumReduction> betas,
+                 const InDataType* in_host,
+                 const std::array<void*, NumReduction> out_hosts,
+                 const std::array<IndexDataType*, NumReduction> out_index_hosts,
+                 const InElementwiseOperationTuple in_elementwise_op_tuple,
+                 const AccElementwiseOperationTuple acc_elementwise_op_tuple)
+    {
+        return Argument{inLengths,
+                        inStrides,
+                        outLengths,
+                        outStrides,
+                        reduceDims,
+                        alphas,
+                        betas,
+                        in_host,
+                        out_hosts,
+                        out_index_hosts,
+                        in_elementwise_op_tuple,
+                        acc_elementwise_op_tuple};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    // without index outputs, see MakeArgument() for OutputIndex
+    std::unique_ptr<device::BaseArgument> MakeArgumentPointer(
+        const std::array<index_t, Rank> inLengths,
+        const std::array<index_t, Rank> inStrides,
+        const std::array<index_t, NumDstDim> outLengths,
+        const std::array<std::array<index_t, NumDstDim>, NumReduction> outStrides,
+        const std::array<int, NumReduceDim> reduceDims,
+        const std::array<double, NumReduction> alphas,
+        const std::array<double, NumReduction> betas,
+        const void* in_host,
+        const std::array<void*, NumReduction> out_hosts,
+        const InElementwiseOperationTuple in_elementwise_op_tuple,
+        const AccElementwiseOperationTuple acc_elementwise_op_tuple) override
+    {
+        std::array<IndexDataType*, NumReduction> out_index_hosts;
+
+        out_index_hosts.fill(nullptr);
+
+        return std::make_unique<Argument>(inLengths,
+                                          inStrides,
+                                          outLengths,
+                                          outStrides,
+                                          reduceDims,
+                                          alphas,
+                                          betas,
+                                          static_cast<const InDataType*>(in_host),
+                                          out_hosts,
+                                          out_index_hosts,
+                                          in_elementwise_op_tuple,
+                                          acc_elementwise_op_tuple);
+    };
+
+    std::unique_ptr<device::BaseInvoker> MakeInvokerPointer() override
+    {
+        return std::make_unique<Invoker>();
+    };
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "Reference_MultipleReduce<" << NumReduction << ">" << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,467 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/utility/math_v2.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+// Positions reduced per task of ReferenceNormalizationBwd, and the number of slices the tasks are
+// split into. Both only depend on the problem, never on the number of threads, so the results are
+// the same for any number of threads.
+inline constexpr std::size_t NormalizationBwdChunkLength = 4096;
+inline constexpr std::size_t NormalizationBwdNumSlice    = 64;
+
+// Where ReferenceNormalizationBwd finds its operands. The elements of x, dy and dx are split into
+// groups that share a mean and an inv std, e.g. the rows of a layernorm or the (n, g) of a
+// groupnorm, and every group has the same number of normalized positions. Element r of group s is
+// at x_group_offsets_[s] + x_reduce_offsets_[r] (and likewise for dy and dx), and it is scaled by
+// the parameter group_params_[s] + reduce_params_[r], whose gamma, dgamma and dbeta are at the
+// offsets of that index in gamma_offsets_, dgamma_offsets_ and dbeta_offsets_.
+struct NormalizationBwdLayout
+{
+    // Offsets of all positions of dims with the given lengths and strides, last dim fastest
+    static std::vector<std::size_t> GetOffsets(const std::vector<index_t>& lengths,
+                                               const std::vector<std::size_t>& strides)
+    {
+        std::vector<std::size_t> offsets{0};
+
+        for(std::size_t i = 0; i < lengths.size(); ++i)
+        {
+            std::vector<std::size_t> dim_offsets;
+
+            dim_offsets.reserve(offsets.size() * lengths[i]);
+
+            for(const auto offset : offsets)
+                for(index_t j = 0; j < lengths[i]; ++j)
+                    dim_offsets.push_back(offset + j * strides[i]);
+
+            offsets = std::move(dim_offsets);
+        }
+
+        return offsets;
+    }
+
+    // GetOffsets() over the given dims of a tensor
+    static std::vector<std::size_t> GetTensorOffsets(const HostTensorDescriptor& desc,
+                                                     const std::vector<std::size_t>& dims)
+    {
+        std::vector<index_t> lengths;
+        std::vector<std::size_t> strides;
+
+        for(const auto dim : dims)
+        {
+            lengths.push_back(static_cast<index_t>(desc.GetLengths()[dim]));
+            strides.push_back(desc.GetStrides()[dim]);
+        }
+
+        return GetOffsets(lengths, strides);
+    }
+
+    // one per group
+    std::vector<std::size_t> x_group_offsets_;
+    std::vector<std::size_t> dy_group_offsets_;
+    std::vector<std::size_t> dx_group_offsets_;
+    std::vector<std::size_t> mean_offsets_;
+    std::vector<std::size_t> inv_std_offsets_;
+    std::vector<std::size_t> group_params_;
+
+    // one per normalized position of a group
+    std::vector<std::size_t> x_reduce_offsets_;
+    std::vector<std::size_t> dy_reduce_offsets_;
+    std::vector<std::size_t> dx_reduce_offsets_;
+    std::vector<std::size_t> reduce_params_;
+
+    // one per parameter
+    std::vector<std::size_t> gamma_offsets_;
+    std::vector<std::size_t> dgamma_offsets_;
+    std::vector<std::size_t> dbeta_offsets_;
+};
+
+// Backward of y = gamma * (x - mean) * inv_std + beta, the common part of the batchnorm, groupnorm
+// and layernorm backward references. With x_hat = (x - mean) * inv_std and R positions per group
+//     dgamma = sum(dy * x_hat) and dbeta = sum(dy) over the elements of every parameter
+//     ds = sum(dy * gamma * x_hat) and db = sum(dy * gamma) over the elements of every group
+//     dx = inv_std / R * (R * dy * gamma - db - x_hat * ds)
+// dgamma, dbeta, ds and db come from one parallel pass over x and dy, dx from a second one. The
+// mean and inv std are read from p_mean and p_inv_std if both are given and are otherwise computed
+// with Welford's method in a pass over x before, with inv_std = 1 / sqrt(variance + epsilon).
+// p_dgamma, p_dbeta and p_dx may be null to skip their outputs.
+//
+// The work is split into tasks of up to NormalizationBwdChunkLength positions of one group, in
+// group order, and the tasks into NormalizationBwdNumSlice contiguous slices run in parallel. Every
+// task and slice sums into its own partial results, which are added up in task and slice order.
+template <typename DYDataType,
+          typename XDataType,
+          typename GammaDataType,
+          typename MeanInvStdDataType,
+          typename DGammaDataType,
+          typename DBetaDataType,
+          typename DXDataType,
+          typename ComputeDataType,
+          typename DyElementwiseOp>
+struct ReferenceNormalizationBwd : public device::BaseOperator
+{
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(NormalizationBwdLayout layout,
+                 const DYDataType* p_dy,
+                 const XDataType* p_x,
+                 const GammaDataType* p_gamma,
+                 const MeanInvStdDataType* p_mean,
+                 const MeanInvStdDataType* p_inv_std,
+                 double epsilon,
+                 const DyElementwiseOp dy_elementwise_op,
+                 DGammaDataType* p_dgamma,
+                 DBetaDataType* p_dbeta,
+                 DXDataType* p_dx)
+            : layout_(std::move(layout)),
+              p_dy_(p_dy),
+              p_x_(p_x),
+              p_gamma_(p_gamma),
+              p_mean_(p_mean),
+              p_inv_std_(p_inv_std),
+              epsilon_(type_convert<ComputeDataType>(epsilon)),
+              dy_elementwise_op_(dy_elementwise_op),
+              p_dgamma_(p_dgamma),
+              p_dbeta_(p_dbeta),
+              p_dx_(p_dx)
+        {
+            const auto num_group   = layout_.x_group_offsets_.size();
+            const auto reduce_size = layout_.x_reduce_offsets_.size();
+            const auto num_param   = layout_.gamma_offsets_.size();
+
+            if(layout_.dy_group_offsets_.size() != num_group ||
+               layout_.dx_group_offsets_.size() != num_group ||
+               layout_.mean_offsets_.size() != num_group ||
+               layout_.inv_std_offsets_.size() != num_group ||
+               layout_.group_params_.size() != num_group ||
+               layout_.dy_reduce_offsets_.size() != reduce_size ||
+               layout_.dx_reduce_offsets_.size() != reduce_size ||
+               layout_.reduce_params_.size() != reduce_size ||
+               layout_.dgamma_offsets_.size() != num_param ||
+               layout_.dbeta_offsets_.size() != num_param)
+                throw std::runtime_error("Inconsistent normalization backward layout!");
+        }
+
+        const NormalizationBwdLayout layout_;
+
+        const DYDataType* p_dy_;
+        const XDataType* p_x_;
+        const GammaDataType* p_gamma_;
+        const MeanInvStdDataType* p_mean_;
+        const MeanInvStdDataType* p_inv_std_;
+        const ComputeDataType epsilon_;
+        const DyElementwiseOp dy_elementwise_op_;
+
+        DGammaDataType* p_dgamma_;
+        DBetaDataType* p_dbeta_;
+        DXDataType* p_dx_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        float Run(const Argument& arg)
+        {
+            const auto& layout = arg.layout_;
+
+            const std::size_t num_group   = layout.x_group_offsets_.size();
+            const std::size_t reduce_size = layout.x_reduce_offsets_.size();
+            const std::size_t num_param   = layout.gamma_offsets_.size();
+
+            const std::size_t num_chunk = std::max<std::size_t>(
+                1, (reduce_size + NormalizationBwdChunkLength - 1) / NormalizationBwdChunkLength);
+            const std::size_t num_task  = num_group * num_chunk;
+            const std::size_t num_slice = std::min(num_task, NormalizationBwdNumSlice);
+
+            // f(slice, task, group, first position, end position) for every task, the tasks of a
+            // slice in order
+            auto for_each_task = [&](auto&& f) {
+                auto& pool = ck::utils::HostThreadPool::GetInstance();
+
+                pool.ParallelFor(num_slice, [&](std::size_t slice) {
+                    const std::size_t task_begin = num_task * slice / num_slice;
+                    const std::size_t task_end   = num_task * (slice + 1) / num_slice;
+
+                    for(std::size_t task = task_begin; task < task_end; ++task)
+                    {
+                        const std::size_t chunk = task % num_chunk;
+
+                        f(slice,
+                          task,
+                          task / num_chunk,
+                          chunk * NormalizationBwdChunkLength,
+                          std::min(reduce_size, (chunk + 1) * NormalizationBwdChunkLength));
+                    }
+                });
+            };
+
+            auto load_x = [&](std::size_t s, std::size_t r) {
+                return type_convert<ComputeDataType>(
+                    arg.p_x_[layout.x_group_offsets_[s] + layout.x_reduce_offsets_[r]]);
+            };
+
+            auto load_dy = [&](std::size_t s, std::size_t r) {
+                ComputeDataType dy = type_convert<ComputeDataType>(
+                    arg.p_dy_[layout.dy_group_offsets_[s] + layout.dy_reduce_offsets_[r]]);
+
+                arg.dy_elementwise_op_(dy, dy);
+
+                return dy;
+            };
+
+            auto load_gamma = [&](std::size_t p) {
+                return type_convert<ComputeDataType>(arg.p_gamma_[layout.gamma_offsets_[p]]);
+            };
+
+            std::vector<ComputeDataType> mean(num_group);
+            std::vector<ComputeDataType> inv_std(num_group);
+
+            if(arg.p_mean_ != nullptr && arg.p_inv_std_ != nullptr)
+            {
+                for(std::size_t s = 0; s < num_group; ++s)
+                {
+                    const auto mean_offset    = layout.mean_offsets_[s];
+                    const auto inv_std_offset = layout.inv_std_offsets_[s];
+
+                    mean[s]    = type_convert<ComputeDataType>(arg.p_mean_[mean_offset]);
+                    inv_std[s] = type_convert<ComputeDataType>(arg.p_inv_std_[inv_std_offset]);
+                }
+            }
+            else
+            {
+                // Welford's method per task, then the tasks of every group merged in order
+                std::vector<ComputeDataType> task_mean(num_task);
+                std::vector<ComputeDataType> task_m2(num_task);
+
+                auto welford = [&](std::size_t /* slice */,
+                                   std::size_t task,
+                                   std::size_t s,
+                                   std::size_t begin,
+                                   std::size_t end) {
+                    ComputeDataType curr_mean = 0;
+                    ComputeDataType curr_m2   = 0;
+
+                    for(std::size_t r = begin; r < end; ++r)
+                    {
+                        const ComputeDataType x     = load_x(s, r);
+                        const ComputeDataType delta = x - curr_mean;
+
+                        curr_mean += delta / type_convert<ComputeDataType>(r - begin + 1);
+                        curr_m2 += delta * (x - curr_mean);
+                    }
+
+                    task_mean[task] = curr_mean;
+                    task_m2[task]   = curr_m2;
+                };
+
+                for_each_task(welford);
+
+                for(std::size_t s = 0; s < num_group; ++s)
+                {
+                    ComputeDataType curr_mean = 0;
+                    ComputeDataType curr_m2   = 0;
+                    std::size_t curr_count    = 0;
+
+                    for(std::size_t chunk = 0; chunk < num_chunk; ++chunk)
+                    {
+                        const std::size_t task  = s * num_chunk + chunk;
+                        const std::size_t count = std::min(reduce_size - curr_count,
+                                                           NormalizationBwdChunkLength);
+
+                        const auto n_a   = type_convert<ComputeDataType>(curr_count);
+                        const auto n_b   = type_convert<ComputeDataType>(count);
+                        const auto delta = task_mean[task] - curr_mean;
+
+                        curr_count += count;
+
+                        const auto n = type_convert<ComputeDataType>(curr_count);
+
+                        curr_mean += delta * n_b / n;
+                        curr_m2 += task_m2[task] + delta * delta * n_a * n_b / n;
+                    }
+
+                    const ComputeDataType variance =
+                        curr_m2 / type_convert<ComputeDataType>(reduce_size);
+
+                    mean[s]    = curr_mean;
+                    inv_std[s] = type_convert<ComputeDataType>(1) /
+                                 ck::math::sqrt(variance + arg.epsilon_);
+                }
+            }
+
+            // the fused pass: partial ds and db per task, partial dgamma and dbeta per slice
+            std::vector<ComputeDataType> task_ds(num_task);
+            std::vector<ComputeDataType> task_db(num_task);
+            std::vector<ComputeDataType> slice_dgamma(num_slice * num_param);
+            std::vector<ComputeDataType> slice_dbeta(num_slice * num_param);
+
+            auto reduce = [&](std::size_t slice,
+                              std::size_t task,
+                              std::size_t s,
+                              std::size_t begin,
+                              std::size_t end) {
+                ComputeDataType ds = 0;
+                ComputeDataType db = 0;
+
+                ComputeDataType* dgamma = slice_dgamma.data() + slice * num_param;
+                ComputeDataType* dbeta  = slice_dbeta.data() + slice * num_param;
+
+                for(std::size_t r = begin; r < end; ++r)
+                {
+                    const std::size_t p = layout.group_params_[s] + layout.reduce_params_[r];
+
+                    const ComputeDataType x_hat = (load_x(s, r) - mean[s]) * inv_std[s];
+                    const ComputeDataType dy    = load_dy(s, r);
+                    const ComputeDataType gamma = load_gamma(p);
+
+                    ds += dy * gamma * x_hat;
+                    db += dy * gamma;
+
+                    dgamma[p] += dy * x_hat;
+                    dbeta[p] += dy;
+                }
+
+                task_ds[task] = ds;
+                task_db[task] = db;
+            };
+
+            for_each_task(reduce);
+
+            if(arg.p_dgamma_ != nullptr || arg.p_dbeta_ != nullptr)
+            {
+                ck::utils::HostThreadPool::GetInstance().ParallelFor(num_param, [&](std::size_t p) {
+                    ComputeDataType dgamma = 0;
+                    ComputeDataType dbeta  = 0;
+
+                    for(std::size_t slice = 0; slice < num_slice; ++slice)
+                    {
+                        dgamma += slice_dgamma[slice * num_param + p];
+                        dbeta += slice_dbeta[slice * num_param + p];
+                    }
+
+                    if(arg.p_dgamma_ != nullptr)
+                        arg.p_dgamma_[layout.dgamma_offsets_[p]] =
+                            type_convert<DGammaDataType>(dgamma);
+
+                    if(arg.p_dbeta_ != nullptr)
+                        arg.p_dbeta_[layout.dbeta_offsets_[p]] = type_convert<DBetaDataType>(dbeta);
+                });
+            }
+
+            if(arg.p_dx_ == nullptr)
+                return 0;
+
+            std::vector<ComputeDataType> group_ds(num_group);
+            std::vector<ComputeDataType> group_db(num_group);
+
+            for(std::size_t s = 0; s < num_group; ++s)
+            {
+                for(std::size_t chunk = 0; chunk < num_chunk; ++chunk)
+                {
+                    group_ds[s] += task_ds[s * num_chunk + chunk];
+                    group_db[s] += task_db[s * num_chunk + chunk];
+                }
+            }
+
+            const auto R = type_convert<ComputeDataType>(reduce_size);
+
+            // the streaming pass
+            auto backward_data = [&](std::size_t /* slice */,
+                                     std::size_t /* task */,
+                                     std::size_t s,
+                                     std::size_t begin,
+                                     std::size_t end) {
+                for(std::size_t r = begin; r < end; ++r)
+                {
+                    const std::size_t p = layout.group_params_[s] + layout.reduce_params_[r];
+
+                    const ComputeDataType x_hat = (load_x(s, r) - mean[s]) * inv_std[s];
+                    const ComputeDataType dy    = load_dy(s, r);
+                    const ComputeDataType gamma = load_gamma(p);
+
+                    const ComputeDataType dx =
+                        inv_std[s] / R * (R * dy * gamma - group_db[s] - x_hat * group_ds[s]);
+
+                    arg.p_dx_[layout.dx_group_offsets_[s] + layout.dx_reduce_offsets_[r]] =
+                        type_convert<DXDataType>(dx);
+                }
+            };
+
+            for_each_task(backward_data);
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    static auto MakeArgument(NormalizationBwdLayout layout,
+                             const DYDataType* p_dy,
+                             const XDataType* p_x,
+                             const GammaDataType* p_gamma,
+                             const MeanInvStdDataType* p_mean,
+                             const MeanInvStdDataType* p_inv_std,
+                             double epsilon,
+                             const DyElementwiseOp dy_elementwise_op,
+                             DGammaDataType* p_dgamma,
+                             DBetaDataType* p_dbeta,
+                             DXDataType* p_dx)
+    {
+        return Argument{std::move(layout),
+                        p_dy,
+                        p_x,
+                        p_gamma,
+                        p_mean,
+                        p_inv_std,
+                        epsilon,
+                        dy_elementwise_op,
+                        p_dgamma,
+                        p_dbeta,
+                        p_dx};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    std::unique_ptr<device::BaseInvoker> MakeInvokerPointer() override
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceNormalizationBwd"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
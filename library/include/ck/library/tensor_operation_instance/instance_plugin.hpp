@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+// With CK_INSTANCE_PLUGINS the instances are built into one shared object per operation family
+// and data type (e.g. libck_instances_gemm_f16.so) instead of being linked into the application.
+// The application links device_operations_lazy instead, which defines every
+// add_device_*_instances() function as a trampoline: the first call loads the plugin providing it
+// with dlopen and forwards to the real function. Nothing changes for
+// DeviceOperationInstanceFactory<DeviceOp>::GetInstances(), which only loads the plugins of the
+// instances it asks for.
+//
+// Plugins are looked up in the directory of libdevice_operations_lazy.so, or in
+// CK_INSTANCE_PLUGIN_PATH if set, through the manifest ck_instance_plugins.manifest that is
+// generated with them:
+//   #ck-instance-plugins v1
+//   plugin <file> <family> <data type>
+//   adder  <file> <mangled add_device_*_instances symbol> <DeviceOp interface>
+// with tab separated fields.
+
+// every add_device_*_instances() takes a std::vector<std::unique_ptr<DeviceOp>>& only, which is
+// passed as a pointer
+using InstanceAdder = void (*)(void*);
+
+struct InstancePluginInfo
+{
+    std::string file_;
+    std::string family_;
+    std::string data_type_;
+    // DeviceOp interfaces the plugin has instances of
+    std::vector<std::string> interfaces_;
+    bool loaded_ = false;
+};
+
+// the adder for a mangled symbol, loading its plugin on first use, throws if there is none
+InstanceAdder get_instance_plugin_adder(const char* symbol);
+
+// plugins listed in the manifest and whether they have been loaded
+std::vector<InstancePluginInfo> get_instance_plugins();
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
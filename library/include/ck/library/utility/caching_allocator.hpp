@@ -0,0 +1,383 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Memory the CachingAllocator gets its blocks from, e.g. host memory or hipMalloc
+struct CachingAllocatorBackend
+{
+    virtual ~CachingAllocatorBackend() = default;
+
+    // throws when out of memory
+    virtual void* Allocate(std::size_t size) = 0;
+    virtual void Free(void* p)               = 0;
+
+    // called before a freed block is cached for reuse, e.g. to wait for pending device work
+    virtual void Synchronize() {}
+};
+
+struct HostMemoryBackend : public CachingAllocatorBackend
+{
+    static constexpr std::size_t Alignment = 64;
+
+    void* Allocate(std::size_t size) override
+    {
+        return ::operator new(size, std::align_val_t{Alignment});
+    }
+
+    void Free(void* p) override { ::operator delete(p, std::align_val_t{Alignment}); }
+};
+
+struct CachingAllocatorStats
+{
+    std::size_t num_allocations_         = 0; // requests served
+    std::size_t num_reuses_              = 0; // requests served from the cache
+    std::size_t num_backend_allocations_ = 0;
+    std::size_t num_backend_frees_       = 0;
+    std::size_t bytes_in_use_            = 0;
+    std::size_t peak_bytes_in_use_       = 0;
+    std::size_t bytes_cached_            = 0;
+    std::size_t peak_bytes_reserved_     = 0; // in use + cached
+};
+
+inline std::ostream& operator<<(std::ostream& os, const CachingAllocatorStats& stats)
+{
+    os << "allocations: " << stats.num_allocations_ << ", reuses: " << stats.num_reuses_
+       << ", backend allocations: " << stats.num_backend_allocations_
+       << ", backend frees: " << stats.num_backend_frees_
+       << ", bytes in use: " << stats.bytes_in_use_
+       << ", peak bytes in use: " << stats.peak_bytes_in_use_
+       << ", bytes cached: " << stats.bytes_cached_
+       << ", peak bytes reserved: " << stats.peak_bytes_reserved_;
+
+    return os;
+}
+
+// Size class caching allocator.
+//
+// Requests are rounded up to a size class, four per power of two, and freed blocks are kept in a
+// free list per class instead of being returned to the backend, so a sweep that allocates the same
+// problem sizes over and over only reaches the backend for the first one. Cached blocks are
+// released when the cache grows beyond SetMaxCachedBytes(), DefaultMaxCachedBytes unless set
+// otherwise, on Trim(), and when the backend runs out of memory.
+class CachingAllocator
+{
+    public:
+    static constexpr std::size_t MinBlockSize = 256;
+
+    // freed memory beyond this goes back to the backend, e.g. the OS for host memory
+    static constexpr std::size_t DefaultMaxCachedBytes = std::size_t{1} << 30;
+
+    // process wide allocator for host memory, used by Tensor
+    static CachingAllocator& GetHostInstance()
+    {
+        static CachingAllocator allocator(std::make_unique<HostMemoryBackend>());
+
+        return allocator;
+    }
+
+    explicit CachingAllocator(std::unique_ptr<CachingAllocatorBackend> backend,
+                              std::size_t max_cached_bytes = DefaultMaxCachedBytes)
+        : backend_(std::move(backend)), max_cached_bytes_(max_cached_bytes)
+    {
+    }
+
+    CachingAllocator(const CachingAllocator&) = delete;
+    CachingAllocator& operator=(const CachingAllocator&) = delete;
+
+    // blocks still in use are left to their owners
+    ~CachingAllocator()
+    {
+        try
+        {
+            Trim();
+        }
+        catch(...)
+        {
+        }
+    }
+
+    static std::size_t GetSizeClass(std::size_t size)
+    {
+        if(size <= MinBlockSize)
+        {
+            return MinBlockSize;
+        }
+
+        std::size_t power = MinBlockSize;
+        while(power < (size - 1) / 2 + 1)
+        {
+            power *= 2;
+        }
+
+        // four classes between power and 2 * power
+        const std::size_t step = power / 4;
+
+        if(size > std::numeric_limits<std::size_t>::max() - step)
+        {
+            throw std::bad_alloc();
+        }
+
+        return (size + step - 1) / step * step;
+    }
+
+    void* Allocate(std::size_t size)
+    {
+        if(size == 0)
+        {
+            return nullptr;
+        }
+
+        const std::size_t size_class = GetSizeClass(size);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        void* p = nullptr;
+
+        auto& free_blocks = free_blocks_[size_class];
+
+        if(!free_blocks.empty())
+        {
+            p = free_blocks.back();
+            free_blocks.pop_back();
+
+            stats_.bytes_cached_ -= size_class;
+            ++stats_.num_reuses_;
+        }
+        else
+        {
+            p = AllocateFromBackend(size_class);
+        }
+
+        live_blocks_.emplace(p, size_class);
+
+        ++stats_.num_allocations_;
+        stats_.bytes_in_use_ += size_class;
+        stats_.peak_bytes_in_use_ = std::max(stats_.peak_bytes_in_use_, stats_.bytes_in_use_);
+
+        return p;
+    }
+
+    void Free(void* p)
+    {
+        if(p == nullptr)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        const auto iter = live_blocks_.find(p);
+
+        if(iter == live_blocks_.end())
+        {
+            throw std::runtime_error("wrong! pointer was not allocated by this CachingAllocator");
+        }
+
+        const std::size_t size_class = iter->second;
+
+        live_blocks_.erase(iter);
+        stats_.bytes_in_use_ -= size_class;
+
+        if(stats_.bytes_cached_ + size_class > max_cached_bytes_)
+        {
+            backend_->Free(p);
+            ++stats_.num_backend_frees_;
+
+            return;
+        }
+
+        backend_->Synchronize();
+
+        free_blocks_[size_class].push_back(p);
+        stats_.bytes_cached_ += size_class;
+    }
+
+    // return all cached blocks to the backend
+    void Trim()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        ReleaseCached();
+    }
+
+    // 0 disables caching, blocks go back to the backend as soon as they are freed
+    void SetMaxCachedBytes(std::size_t max_cached_bytes)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        max_cached_bytes_ = max_cached_bytes;
+
+        if(stats_.bytes_cached_ > max_cached_bytes_)
+        {
+            ReleaseCached();
+        }
+    }
+
+    std::size_t GetMaxCachedBytes() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        return max_cached_bytes_;
+    }
+
+    CachingAllocatorStats GetStats() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        return stats_;
+    }
+
+    // restart the counters and peaks from the current usage
+    void ResetStats()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        CachingAllocatorStats stats;
+
+        stats.bytes_in_use_        = stats_.bytes_in_use_;
+        stats.peak_bytes_in_use_   = stats_.bytes_in_use_;
+        stats.bytes_cached_        = stats_.bytes_cached_;
+        stats.peak_bytes_reserved_ = stats_.bytes_in_use_ + stats_.bytes_cached_;
+
+        stats_ = stats;
+    }
+
+    private:
+    void* AllocateFromBackend(std::size_t size_class)
+    {
+        void* p = nullptr;
+
+        try
+        {
+            p = backend_->Allocate(size_class);
+        }
+        catch(...)
+        {
+            if(stats_.bytes_cached_ == 0)
+            {
+                throw;
+            }
+
+            // out of memory with blocks of other sizes cached, release them and retry once
+            ReleaseCached();
+
+            p = backend_->Allocate(size_class);
+        }
+
+        ++stats_.num_backend_allocations_;
+        stats_.peak_bytes_reserved_ = std::max(stats_.peak_bytes_reserved_,
+                                               stats_.bytes_in_use_ + size_class +
+                                                   stats_.bytes_cached_);
+
+        return p;
+    }
+
+    void ReleaseCached()
+    {
+        for(auto& [size_class, blocks] : free_blocks_)
+        {
+            for(void* p : blocks)
+            {
+                backend_->Free(p);
+                ++stats_.num_backend_frees_;
+                stats_.bytes_cached_ -= size_class;
+            }
+
+            blocks.clear();
+        }
+    }
+
+    std::unique_ptr<CachingAllocatorBackend> backend_;
+
+    mutable std::mutex mutex_;
+
+    std::unordered_map<std::size_t, std::vector<void*>> free_blocks_;
+    std::unordered_map<void*, std::size_t> live_blocks_;
+
+    std::size_t max_cached_bytes_;
+
+    CachingAllocatorStats stats_;
+};
+
+// Standard allocator on top of CachingAllocator::GetHostInstance().
+//
+// With default_init the container default-initializes new elements instead of value-initializing
+// them, so e.g. resize() of a std::vector<float> leaves the new elements unset rather than
+// zero-filling memory that is about to be overwritten. Allocators only compare equal if they
+// initialize the same way, and move assignment and swap take the allocator along with the memory.
+template <typename T>
+struct HostCachingAllocator
+{
+    using value_type                             = T;
+    using is_always_equal                        = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap            = std::true_type;
+
+    HostCachingAllocator() = default;
+
+    explicit HostCachingAllocator(bool default_init) : default_init_(default_init) {}
+
+    template <typename U>
+    HostCachingAllocator(const HostCachingAllocator<U>& other) : default_init_(other.default_init_)
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+        if(n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+        {
+            throw std::bad_array_new_length();
+        }
+
+        return static_cast<T*>(CachingAllocator::GetHostInstance().Allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, std::size_t) { CachingAllocator::GetHostInstance().Free(p); }
+
+    template <typename U>
+    void construct(U* p)
+    {
+        if(default_init_)
+        {
+            ::new(static_cast<void*>(p)) U;
+        }
+        else
+        {
+            ::new(static_cast<void*>(p)) U();
+        }
+    }
+
+    template <typename U, typename... Args>
+    void construct(U* p, Args&&... args)
+    {
+        ::new(static_cast<void*>(p)) U(std::forward<Args>(args)...);
+    }
+
+    bool default_init_ = false;
+};
+
+template <typename T, typename U>
+bool operator==(const HostCachingAllocator<T>& lhs, const HostCachingAllocator<U>& rhs)
+{
+    return lhs.default_init_ == rhs.default_init_;
+}
+
+template <typename T, typename U>
+bool operator!=(const HostCachingAllocator<T>& lhs, const HostCachingAllocator<U>& rhs)
+{
+    return !(lhs == rhs);
+}
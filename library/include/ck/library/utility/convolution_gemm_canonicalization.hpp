@@ -0,0 +1,203 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <vector>
+
+#include "ck/ck.hpp"
+
+#include "ck/library/utility/convolution_parameter.hpp"
+#include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace utils {
+namespace conv {
+
+// A grouped convolution forward in batched GEMM terms. For every group g
+//   E[g][m, n] = sum_k A[g][m, k] * B[g][k, n]
+// with A the input, row-major [M, K], B the weight, column-major [K, N], and E the output,
+// row-major [M, N]; m runs over N and the output positions, n over K and k over the filter taps
+// and C. The strides are in elements of the convolution tensors, so the GEMM works on their
+// memory as it is.
+struct ConvFwdGemmProblem
+{
+    ck::index_t G_ = 0;
+    ck::index_t M_ = 0;
+    ck::index_t N_ = 0;
+    ck::index_t K_ = 0;
+
+    ck::index_t StrideA_ = 0;
+    ck::index_t StrideB_ = 0;
+    ck::index_t StrideE_ = 0;
+
+    ck::index_t BatchStrideA_ = 0;
+    ck::index_t BatchStrideB_ = 0;
+    ck::index_t BatchStrideE_ = 0;
+};
+
+namespace detail {
+
+// Folds dims given outermost first into a single dim, if the stride of every dim of length
+// above 1 is the stride times the length of the next such dim. stride is the stride of the
+// folded dim, 0 if all dims have length 1.
+inline bool fold_dims(const std::vector<std::size_t>& lengths,
+                      const std::vector<std::size_t>& strides,
+                      std::size_t& stride)
+{
+    stride = 0;
+
+    std::size_t folded_length = 1;
+
+    for(std::size_t i = lengths.size(); i > 0; --i)
+    {
+        if(lengths[i - 1] == 1)
+        {
+            continue;
+        }
+
+        if(folded_length == 1)
+        {
+            stride = strides[i - 1];
+        }
+        else if(strides[i - 1] != stride * folded_length)
+        {
+            return false;
+        }
+
+        folded_length *= lengths[i - 1];
+    }
+
+    return true;
+}
+
+} // namespace detail
+
+// Whether the convolution is a GEMM on the memory of its tensors, and if so the GEMM in
+// gemm_problem. That is the case if nothing is padded and, in every tensor, the dims of the rows
+// (N and the output positions) and the dims of the reduction (the filter taps and C) each fold
+// into one dim, as they do for 1x1 stride 1 filters, for filters covering the whole input and
+// for some strided 1x1 filters in channels last layouts. The descriptors are ordered
+// G, N, C, Wi..., G, K, C, X... and G, N, K, Wo... as the ones of
+// make_*_host_tensor_descriptor_*_packed().
+inline bool get_conv_fwd_gemm_problem(const ConvParam& conv_param,
+                                      const HostTensorDescriptor& in_g_n_c_wis_desc,
+                                      const HostTensorDescriptor& wei_g_k_c_xs_desc,
+                                      const HostTensorDescriptor& out_g_n_k_wos_desc,
+                                      ConvFwdGemmProblem& gemm_problem)
+{
+    const std::size_t num_dim_spatial = conv_param.num_dim_spatial_;
+
+    auto is_zero = [](ck::index_t pad) { return pad == 0; };
+
+    const auto& left_pads  = conv_param.input_left_pads_;
+    const auto& right_pads = conv_param.input_right_pads_;
+
+    if(!std::all_of(left_pads.begin(), left_pads.end(), is_zero) ||
+       !std::all_of(right_pads.begin(), right_pads.end(), is_zero))
+    {
+        return false;
+    }
+
+    constexpr auto max_index = static_cast<std::size_t>(std::numeric_limits<ck::index_t>::max());
+
+    for(const auto* desc : {&in_g_n_c_wis_desc, &wei_g_k_c_xs_desc, &out_g_n_k_wos_desc})
+    {
+        if(desc->GetElementSpaceSize() > max_index)
+        {
+            return false;
+        }
+    }
+
+    const auto& in_strides  = in_g_n_c_wis_desc.GetStrides();
+    const auto& wei_strides = wei_g_k_c_xs_desc.GetStrides();
+    const auto& out_strides = out_g_n_k_wos_desc.GetStrides();
+
+    // rows: N, Wo...
+    std::vector<std::size_t> m_lengths{static_cast<std::size_t>(conv_param.N_)};
+    std::vector<std::size_t> in_m_strides{in_strides[1]};
+    std::vector<std::size_t> out_m_strides{out_strides[1]};
+
+    // reduction: X..., C
+    std::vector<std::size_t> k_lengths;
+    std::vector<std::size_t> in_k_strides;
+    std::vector<std::size_t> wei_k_strides;
+
+    for(std::size_t i = 0; i < num_dim_spatial; ++i)
+    {
+        m_lengths.push_back(conv_param.output_spatial_lengths_[i]);
+        in_m_strides.push_back(in_strides[3 + i] * conv_param.conv_filter_strides_[i]);
+        out_m_strides.push_back(out_strides[3 + i]);
+
+        k_lengths.push_back(conv_param.filter_spatial_lengths_[i]);
+        in_k_strides.push_back(in_strides[3 + i] * conv_param.conv_filter_dilations_[i]);
+        wei_k_strides.push_back(wei_strides[3 + i]);
+    }
+
+    k_lengths.push_back(conv_param.C_);
+    in_k_strides.push_back(in_strides[2]);
+    wei_k_strides.push_back(wei_strides[2]);
+
+    std::size_t in_m_stride  = 0;
+    std::size_t out_m_stride = 0;
+    std::size_t in_k_stride  = 0;
+    std::size_t wei_k_stride = 0;
+
+    if(!detail::fold_dims(m_lengths, in_m_strides, in_m_stride) ||
+       !detail::fold_dims(m_lengths, out_m_strides, out_m_stride) ||
+       !detail::fold_dims(k_lengths, in_k_strides, in_k_stride) ||
+       !detail::fold_dims(k_lengths, wei_k_strides, wei_k_stride))
+    {
+        return false;
+    }
+
+    const std::size_t M = ck::accumulate_n<std::size_t>(
+        m_lengths.begin(), m_lengths.size(), 1, std::multiplies<>());
+    const std::size_t K = ck::accumulate_n<std::size_t>(
+        k_lengths.begin(), k_lengths.size(), 1, std::multiplies<>());
+    const std::size_t N = conv_param.K_;
+
+    // A and B contiguous along K, E along N, as the row-major [M, K], column-major [K, N] and
+    // row-major [M, N] GEMMs need
+    if((K > 1 && (in_k_stride != 1 || wei_k_stride != 1)) || (N > 1 && out_strides[2] != 1))
+    {
+        return false;
+    }
+
+    gemm_problem.G_ = conv_param.G_;
+    gemm_problem.M_ = static_cast<ck::index_t>(M);
+    gemm_problem.N_ = static_cast<ck::index_t>(N);
+    gemm_problem.K_ = static_cast<ck::index_t>(K);
+
+    // strides of dims of length 1 are free, take the ones of packed matrices
+    gemm_problem.StrideA_ = static_cast<ck::index_t>(M > 1 ? in_m_stride : K);
+    gemm_problem.StrideB_ = static_cast<ck::index_t>(N > 1 ? wei_strides[1] : K);
+    gemm_problem.StrideE_ = static_cast<ck::index_t>(M > 1 ? out_m_stride : N);
+
+    gemm_problem.BatchStrideA_ = static_cast<ck::index_t>(in_strides[0]);
+    gemm_problem.BatchStrideB_ = static_cast<ck::index_t>(wei_strides[0]);
+    gemm_problem.BatchStrideE_ = static_cast<ck::index_t>(out_strides[0]);
+
+    return true;
+}
+
+// get_conv_fwd_gemm_problem() for packed tensors in the given layouts
+template <typename InLayout, typename WeiLayout, typename OutLayout>
+bool get_conv_fwd_gemm_problem(const ConvParam& conv_param, ConvFwdGemmProblem& gemm_problem)
+{
+    return get_conv_fwd_gemm_problem(
+        conv_param,
+        make_input_host_tensor_descriptor_g_n_c_wis_packed<InLayout>(conv_param),
+        make_weight_host_tensor_descriptor_g_k_c_xs_packed<WeiLayout>(conv_param),
+        make_output_host_tensor_descriptor_g_n_k_wos_packed<OutLayout>(conv_param),
+        gemm_problem);
+}
+
+} // namespace conv
+} // namespace utils
+} // namespace ck
@@ -5,6 +5,8 @@
 
 #include <hip/hip_runtime.h>
 
+#include "ck/library/utility/caching_allocator.hpp"
+
 template <typename T>
 __global__ void set_buffer_value(T* p, T x, uint64_t buffer_element_size)
 {
@@ -14,9 +16,19 @@ __global__ void set_buffer_value(T* p, T x, uint64_t buffer_element_size)
     }
 }
 
+/**
+ * @brief Process wide caching allocator for GPU device memory, used by DeviceMem
+ *
+ * Caching is off unless the CK_DEVICE_MEM_CACHE_MB environment variable sets the MiB of freed
+ * buffers to keep, since cached memory is not available to hipMalloc from other code.
+ */
+CachingAllocator& GetDeviceMemAllocator();
+
 /**
  * @brief Container for storing data in GPU device memory
  *
+ * Buffers come from GetDeviceMemAllocator(). With its cache enabled, buffers freed by one profiler
+ * run are reused by the next one instead of going through hipFree and hipMalloc again.
  */
 struct DeviceMem
 {
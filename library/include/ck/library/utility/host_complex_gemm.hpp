@@ -0,0 +1,463 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "ck/utility/type_convert.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
+
+// Complex GEMM for the host references, on planar or interleaved complex storage.
+//
+// Planar storage keeps the real and imaginary parts in two tensors of the same lengths, as the
+// CGEMM device operations do. Interleaved storage keeps them next to each other in one tensor with
+// an extra innermost dimension of length 2, like std::complex arrays and FFT libraries do.
+//
+// complex_gemm() converts both operands once to float rows with K contiguous and computes the real
+// and imaginary part of each output in the same pass, from register tiles of
+// ComplexGemmMPerTile x ComplexGemmNPerTile outputs. With CGemmAlgorithm::Gauss3M it computes the
+// three real products
+//
+//   t1 = sum a_real * b_real
+//   t2 = sum a_imag * b_imag
+//   t3 = sum (a_real + a_imag) * (b_real + b_imag)
+//
+// and c = (t1 - t2) + i (t3 - t1 - t2), three multiply-adds per k instead of four, at the price of
+// the cancellation in t3 - t1 - t2.
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+enum struct CGemmAlgorithm
+{
+    Classic4M, // four real products per k
+    Gauss3M,   // three real products per k
+};
+
+inline constexpr std::size_t ComplexGemmMPerTile  = 2;
+inline constexpr std::size_t ComplexGemmNPerTile  = 4;
+inline constexpr std::size_t ComplexGemmMPerBlock = 32;
+inline constexpr std::size_t ComplexGemmNPerBlock = 64;
+
+// Complex [rows, cols] matrix on planar or interleaved storage, T is const for read-only data
+template <typename T>
+struct HostComplexMatrix
+{
+    T& Real(std::size_t i, std::size_t j) const
+    {
+        return p_real_[i * real_strides_[0] + j * real_strides_[1]];
+    }
+
+    T& Imag(std::size_t i, std::size_t j) const
+    {
+        return p_imag_[i * imag_strides_[0] + j * imag_strides_[1]];
+    }
+
+    T* p_real_;
+    T* p_imag_;
+    std::size_t rows_;
+    std::size_t cols_;
+    std::array<std::size_t, 2> real_strides_;
+    std::array<std::size_t, 2> imag_strides_;
+};
+
+namespace detail {
+
+template <typename T, typename TensorType>
+HostComplexMatrix<T> make_planar_complex_matrix(TensorType& real, TensorType& imag)
+{
+    if(real.mDesc.GetNumOfDimension() != 2 || real.mDesc.GetLengths() != imag.mDesc.GetLengths())
+    {
+        throw std::runtime_error("wrong! Incompatible real and imag sizes in CGEMM");
+    }
+
+    const auto& real_strides = real.mDesc.GetStrides();
+    const auto& imag_strides = imag.mDesc.GetStrides();
+
+    return HostComplexMatrix<T>{real.mData.data(),
+                                imag.mData.data(),
+                                real.mDesc.GetLengths()[0],
+                                real.mDesc.GetLengths()[1],
+                                {real_strides[0], real_strides[1]},
+                                {imag_strides[0], imag_strides[1]}};
+}
+
+template <typename T, typename TensorType>
+HostComplexMatrix<T> make_interleaved_complex_matrix(TensorType& complex)
+{
+    if(complex.mDesc.GetNumOfDimension() != 3 || complex.mDesc.GetLengths()[2] != 2)
+    {
+        throw std::runtime_error("wrong! interleaved complex matrix must be [rows, cols, 2]");
+    }
+
+    const auto& strides = complex.mDesc.GetStrides();
+
+    return HostComplexMatrix<T>{complex.mData.data(),
+                                complex.mData.data() + strides[2],
+                                complex.mDesc.GetLengths()[0],
+                                complex.mDesc.GetLengths()[1],
+                                {strides[0], strides[1]},
+                                {strides[0], strides[1]}};
+}
+
+// calls f(i, j) with the offsets i in a and j in b of every element of lengths
+template <typename F>
+void for_each_offset(const std::vector<std::size_t>& lengths,
+                     const std::vector<std::size_t>& a_strides,
+                     const std::vector<std::size_t>& b_strides,
+                     F&& f)
+{
+    const std::size_t num_dim = lengths.size();
+
+    if(std::find(lengths.begin(), lengths.end(), 0) != lengths.end())
+    {
+        return;
+    }
+
+    std::vector<std::size_t> idx(num_dim, 0);
+
+    std::size_t a_offset = 0;
+    std::size_t b_offset = 0;
+
+    while(true)
+    {
+        f(a_offset, b_offset);
+
+        std::size_t d = num_dim;
+
+        for(; d > 0 && idx[d - 1] + 1 == lengths[d - 1]; --d)
+        {
+            a_offset -= idx[d - 1] * a_strides[d - 1];
+            b_offset -= idx[d - 1] * b_strides[d - 1];
+            idx[d - 1] = 0;
+        }
+
+        if(d == 0)
+        {
+            return;
+        }
+
+        ++idx[d - 1];
+        a_offset += a_strides[d - 1];
+        b_offset += b_strides[d - 1];
+    }
+}
+
+// real and imaginary part of c[i * ldc + j] for i < m <= MPerTile, j < n <= NPerTile, from rows of
+// a and b with K contiguous; rows past m and n repeat the first row and are computed but not
+// stored
+template <bool UseGauss>
+void complex_gemm_tile(const std::array<const float*, 3>& p_a,
+                       const std::array<const float*, 3>& p_b,
+                       float* p_c_real,
+                       float* p_c_imag,
+                       std::size_t ldc,
+                       std::size_t K,
+                       std::size_t m,
+                       std::size_t n)
+{
+    constexpr std::size_t MPerTile = ComplexGemmMPerTile;
+    constexpr std::size_t NPerTile = ComplexGemmNPerTile;
+
+    // real, imag and, for Gauss, real + imag rows
+    const float* p_a_row[3][MPerTile];
+    const float* p_b_row[3][NPerTile];
+
+    for(std::size_t p = 0; p < 3; ++p)
+    {
+        for(std::size_t i = 0; i < MPerTile; ++i)
+        {
+            p_a_row[p][i] = p_a[p] + (i < m ? i : 0) * K;
+        }
+
+        for(std::size_t j = 0; j < NPerTile; ++j)
+        {
+            p_b_row[p][j] = p_b[p] + (j < n ? j : 0) * K;
+        }
+    }
+
+    // Gauss: a_real * b_real, a_imag * b_imag, (a_real + a_imag) * (b_real + b_imag)
+    // otherwise: a_real * b_real, a_imag * b_imag, a_real * b_imag + a_imag * b_real
+    float acc[3][MPerTile][NPerTile] = {};
+
+    for(std::size_t k = 0; k < K; ++k)
+    {
+        for(std::size_t i = 0; i < MPerTile; ++i)
+        {
+            for(std::size_t j = 0; j < NPerTile; ++j)
+            {
+                const float a_real = p_a_row[0][i][k];
+                const float a_imag = p_a_row[1][i][k];
+                const float b_real = p_b_row[0][j][k];
+                const float b_imag = p_b_row[1][j][k];
+
+                acc[0][i][j] += a_real * b_real;
+                acc[1][i][j] += a_imag * b_imag;
+
+                if constexpr(UseGauss)
+                {
+                    acc[2][i][j] += p_a_row[2][i][k] * p_b_row[2][j][k];
+                }
+                else
+                {
+                    acc[2][i][j] += a_real * b_imag + a_imag * b_real;
+                }
+            }
+        }
+    }
+
+    for(std::size_t i = 0; i < m; ++i)
+    {
+        for(std::size_t j = 0; j < n; ++j)
+        {
+            p_c_real[i * ldc + j] = acc[0][i][j] - acc[1][i][j];
+            p_c_imag[i * ldc + j] =
+                UseGauss ? acc[2][i][j] - acc[0][i][j] - acc[1][i][j] : acc[2][i][j];
+        }
+    }
+}
+
+} // namespace detail
+
+template <typename T>
+HostComplexMatrix<const T> make_planar_complex_matrix(const Tensor<T>& real, const Tensor<T>& imag)
+{
+    return detail::make_planar_complex_matrix<const T>(real, imag);
+}
+
+template <typename T>
+HostComplexMatrix<T> make_planar_complex_matrix(Tensor<T>& real, Tensor<T>& imag)
+{
+    return detail::make_planar_complex_matrix<T>(real, imag);
+}
+
+template <typename T>
+HostComplexMatrix<const T> make_interleaved_complex_matrix(const Tensor<T>& complex)
+{
+    return detail::make_interleaved_complex_matrix<const T>(complex);
+}
+
+template <typename T>
+HostComplexMatrix<T> make_interleaved_complex_matrix(Tensor<T>& complex)
+{
+    return detail::make_interleaved_complex_matrix<T>(complex);
+}
+
+// Interleaved [..., 2] tensor from planar real and imag tensors of the same lengths
+template <typename T>
+Tensor<T> interleave_complex_host_tensor(const Tensor<T>& real, const Tensor<T>& imag)
+{
+    if(real.mDesc.GetLengths() != imag.mDesc.GetLengths())
+    {
+        throw std::runtime_error("wrong! real and imag lengths are different");
+    }
+
+    auto lengths = real.mDesc.GetLengths();
+    lengths.push_back(2);
+
+    Tensor<T> complex(HostTensorDescriptor(lengths), TensorUninitialized{});
+
+    auto complex_strides = complex.mDesc.GetStrides();
+    complex_strides.pop_back();
+
+    detail::for_each_offset(
+        real.mDesc.GetLengths(),
+        real.mDesc.GetStrides(),
+        complex_strides,
+        [&](std::size_t real_offset, std::size_t complex_offset) {
+            complex.mData[complex_offset] = real.mData[real_offset];
+        });
+
+    detail::for_each_offset(
+        imag.mDesc.GetLengths(),
+        imag.mDesc.GetStrides(),
+        complex_strides,
+        [&](std::size_t imag_offset, std::size_t complex_offset) {
+            complex.mData[complex_offset + 1] = imag.mData[imag_offset];
+        });
+
+    return complex;
+}
+
+// Planar real and imag tensors from an interleaved [..., 2] tensor, into tensors of its lengths
+// without the last one, with any strides
+template <typename T>
+void deinterleave_complex_host_tensor(const Tensor<T>& complex, Tensor<T>& real, Tensor<T>& imag)
+{
+    auto lengths = complex.mDesc.GetLengths();
+
+    if(lengths.empty() || lengths.back() != 2)
+    {
+        throw std::runtime_error("wrong! interleaved complex tensor must be [..., 2]");
+    }
+
+    lengths.pop_back();
+
+    if(real.mDesc.GetLengths() != lengths || imag.mDesc.GetLengths() != lengths)
+    {
+        throw std::runtime_error("wrong! real and imag lengths do not match the complex tensor");
+    }
+
+    auto complex_strides = complex.mDesc.GetStrides();
+
+    const std::size_t imag_offset = complex_strides.back();
+
+    complex_strides.pop_back();
+
+    detail::for_each_offset(lengths,
+                            complex_strides,
+                            real.mDesc.GetStrides(),
+                            [&](std::size_t complex_offset, std::size_t real_offset) {
+                                real.mData[real_offset] = complex.mData[complex_offset];
+                            });
+
+    detail::for_each_offset(lengths,
+                            complex_strides,
+                            imag.mDesc.GetStrides(),
+                            [&](std::size_t complex_offset, std::size_t offset) {
+                                imag.mData[offset] = complex.mData[complex_offset + imag_offset];
+                            });
+}
+
+// c_m_n = a_m_k * b_k_n in float, both parts of c in one pass. Blocks of C are spread over
+// HostThreadPool.
+template <typename ADataType, typename BDataType, typename CDataType>
+void complex_gemm(const HostComplexMatrix<const ADataType>& a_m_k,
+                  const HostComplexMatrix<const BDataType>& b_k_n,
+                  const HostComplexMatrix<CDataType>& c_m_n,
+                  CGemmAlgorithm algorithm = CGemmAlgorithm::Classic4M)
+{
+    const std::size_t M = a_m_k.rows_;
+    const std::size_t K = a_m_k.cols_;
+    const std::size_t N = b_k_n.cols_;
+
+    if(b_k_n.rows_ != K || c_m_n.rows_ != M || c_m_n.cols_ != N)
+    {
+        throw std::runtime_error("wrong! inconsistent CGEMM sizes");
+    }
+
+    const bool use_gauss = algorithm == CGemmAlgorithm::Gauss3M;
+
+    // A rows and B columns with K contiguous: real, imag and, for Gauss, real + imag
+    std::array<std::vector<float>, 3> a_packed;
+    std::array<std::vector<float>, 3> b_packed;
+
+    for(std::size_t p = 0; p < (use_gauss ? 3 : 2); ++p)
+    {
+        a_packed[p].resize(M * K);
+        b_packed[p].resize(N * K);
+    }
+
+    for(std::size_t m = 0; m < M; ++m)
+    {
+        for(std::size_t k = 0; k < K; ++k)
+        {
+            a_packed[0][m * K + k] = ck::type_convert<float>(a_m_k.Real(m, k));
+            a_packed[1][m * K + k] = ck::type_convert<float>(a_m_k.Imag(m, k));
+        }
+    }
+
+    for(std::size_t k = 0; k < K; ++k)
+    {
+        for(std::size_t n = 0; n < N; ++n)
+        {
+            b_packed[0][n * K + k] = ck::type_convert<float>(b_k_n.Real(k, n));
+            b_packed[1][n * K + k] = ck::type_convert<float>(b_k_n.Imag(k, n));
+        }
+    }
+
+    if(use_gauss)
+    {
+        for(std::size_t i = 0; i < M * K; ++i)
+        {
+            a_packed[2][i] = a_packed[0][i] + a_packed[1][i];
+        }
+
+        for(std::size_t i = 0; i < N * K; ++i)
+        {
+            b_packed[2][i] = b_packed[0][i] + b_packed[1][i];
+        }
+    }
+
+    const std::size_t num_m_block = (M + ComplexGemmMPerBlock - 1) / ComplexGemmMPerBlock;
+    const std::size_t num_n_block = (N + ComplexGemmNPerBlock - 1) / ComplexGemmNPerBlock;
+
+    // consecutive blocks share the block of B
+    auto& pool = ck::utils::HostThreadPool::GetInstance();
+
+    pool.ParallelFor(num_m_block * num_n_block, [&](std::size_t block) {
+        const std::size_t m_begin = (block % num_m_block) * ComplexGemmMPerBlock;
+        const std::size_t n_begin = (block / num_m_block) * ComplexGemmNPerBlock;
+        const std::size_t m_end   = std::min(M, m_begin + ComplexGemmMPerBlock);
+        const std::size_t n_end   = std::min(N, n_begin + ComplexGemmNPerBlock);
+        const std::size_t ldc     = ComplexGemmNPerBlock;
+
+        std::vector<float> c_real(ComplexGemmMPerBlock * ldc);
+        std::vector<float> c_imag(ComplexGemmMPerBlock * ldc);
+
+        for(std::size_t m = m_begin; m < m_end; m += ComplexGemmMPerTile)
+        {
+            for(std::size_t n = n_begin; n < n_end; n += ComplexGemmNPerTile)
+            {
+                // the real + imag rows are not used without Gauss
+                const std::array<const float*, 3> p_a{
+                    a_packed[0].data() + m * K,
+                    a_packed[1].data() + m * K,
+                    (use_gauss ? a_packed[2] : a_packed[0]).data() + m * K};
+                const std::array<const float*, 3> p_b{
+                    b_packed[0].data() + n * K,
+                    b_packed[1].data() + n * K,
+                    (use_gauss ? b_packed[2] : b_packed[0]).data() + n * K};
+
+                const std::size_t c_offset = (m - m_begin) * ldc + (n - n_begin);
+                const std::size_t m_tile   = std::min(ComplexGemmMPerTile, m_end - m);
+                const std::size_t n_tile   = std::min(ComplexGemmNPerTile, n_end - n);
+
+                if(use_gauss)
+                {
+                    detail::complex_gemm_tile<true>(p_a,
+                                                    p_b,
+                                                    c_real.data() + c_offset,
+                                                    c_imag.data() + c_offset,
+                                                    ldc,
+                                                    K,
+                                                    m_tile,
+                                                    n_tile);
+                }
+                else
+                {
+                    detail::complex_gemm_tile<false>(p_a,
+                                                     p_b,
+                                                     c_real.data() + c_offset,
+                                                     c_imag.data() + c_offset,
+                                                     ldc,
+                                                     K,
+                                                     m_tile,
+                                                     n_tile);
+                }
+            }
+        }
+
+        for(std::size_t m = m_begin; m < m_end; ++m)
+        {
+            for(std::size_t n = n_begin; n < n_end; ++n)
+            {
+                const std::size_t c_offset = (m - m_begin) * ldc + (n - n_begin);
+
+                c_m_n.Real(m, n) = ck::type_convert<CDataType>(c_real[c_offset]);
+                c_m_n.Imag(m, n) = ck::type_convert<CDataType>(c_imag[c_offset]);
+            }
+        }
+    });
+}
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,373 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "ck/utility/data_type.hpp"
+#include "ck/utility/type.hpp"
+#include "ck/utility/type_convert.hpp"
+#include "ck/tensor_operation/gpu/element/unary_element_wise_operation.hpp"
+#include "ck/tensor_operation/gpu/element/binary_element_wise_operation.hpp"
+
+// Batch application of element-wise operators to contiguous spans on the host.
+//
+// apply_element_wise(op, p_y, p_x, n) has the effect of op(p_y[i], p_x[i]) for i in [0, n), and
+// apply_element_wise(op, p_y, p_x0, p_x1, n) of op(p_y[i], p_x0[i], p_x1[i]). The implementation
+// is chosen from the type of op by HostElementWiseBatch<op>:
+//  - by default the scalar operator is called in a plain loop. Cheap operators (PassThrough,
+//    Scale, UnarySquare, Add, Multiply, ...) are inlined into it and the loop is vectorized by the
+//    host compiler as is.
+//  - operators calling libm (FastGelu, Gelu, Sigmoid, TanH, Swish, SoftRelu, Elu) are evaluated
+//    on float spans with the branch free polynomial approximations of exp, log, expm1, tanh and
+//    erf below, so that the loop over the span vectorizes too. Other data types use the scalar
+//    operator.
+//
+// The approximations are within 2.5 ulp of the exact function, libm is within 1 ulp. For every
+// specialized operator the result y differs from the scalar result y_ref by at most
+// 4 * eps * (|y_ref| + |x|), eps = 2^-23, and infinities and NaN are propagated as by the scalar
+// operator.
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+namespace detail {
+
+// c ? a : b with both sides evaluated, a conditional expression is not if-converted by the host
+// compiler when one side may trap (division), which keeps the loop over the span scalar
+inline float select(bool c, float a, float b)
+{
+    const int32_t mask = -static_cast<int32_t>(c);
+
+    return bit_cast<float>((bit_cast<int32_t>(a) & mask) | (bit_cast<int32_t>(b) & ~mask));
+}
+
+// exp(x), within 1 ulp, 0 below the normal range of float
+inline float fast_exp(float x)
+{
+    constexpr float lo = -87.33654f;
+    constexpr float hi = 88.72283f;
+
+    // x = n * ln(2) + r, |r| <= ln(2) / 2, ln(2) split for an exact n * ln2_hi
+    // NaN is clamped to lo, so that the conversion to int is defined
+    const float xc = select(x >= lo, select(x <= hi, x, hi), lo);
+    const float t  = xc * 1.44269504f;
+    const float n  = (t + 12582912.f) - 12582912.f; // round to nearest, |t| < 2^22
+    const float r  = (xc - n * 0.693359375f) + n * 2.12194440e-4f;
+
+    float p = 1.9875691500e-4f;
+    p       = p * r + 1.3981999507e-3f;
+    p       = p * r + 8.3334519073e-3f;
+    p       = p * r + 4.1665795894e-2f;
+    p       = p * r + 1.6666665459e-1f;
+    p       = p * r + 5.0000001201e-1f;
+    p       = p * r * r + r + 1.f;
+
+    // 2^n = 2^(n - e0) * 2^e0, n is 128 at the upper clamp
+    const int32_t e    = static_cast<int32_t>(n);
+    const int32_t e0   = std::min(e, 127);
+    const float scale0 = bit_cast<float>((e0 + 127) << 23);
+    const float scale1 = bit_cast<float>((e - e0 + 127) << 23);
+    const float y      = p * scale1 * scale0;
+
+    const float y_range =
+        select(x > hi, std::numeric_limits<float>::infinity(), select(x < lo, 0.f, y));
+
+    return select(std::isnan(x), x, y_range);
+}
+
+// log(x) for positive normal x and infinity, within 1 ulp
+inline float fast_log(float x)
+{
+    // x = 2^e * m, sqrt(1/2) <= m < sqrt(2)
+    const int32_t bits = bit_cast<int32_t>(x);
+    const float m0     = bit_cast<float>((bits & 0x007fffff) | 0x3f000000);
+    const bool below   = m0 < 0.70710678f;
+    const int32_t e    = ((bits >> 23) & 0xff) - (below ? 127 : 126);
+    const float m      = select(below, m0 + m0 - 1.f, m0 - 1.f);
+    const float z      = m * m;
+
+    float p = 7.0376836292e-2f;
+    p       = p * m - 1.1514610310e-1f;
+    p       = p * m + 1.1676998740e-1f;
+    p       = p * m - 1.2420140846e-1f;
+    p       = p * m + 1.4249322787e-1f;
+    p       = p * m - 1.6668057665e-1f;
+    p       = p * m + 2.0000714765e-1f;
+    p       = p * m - 2.4999993993e-1f;
+    p       = p * m + 3.3333331174e-1f;
+
+    const float fe = static_cast<float>(e);
+    float y        = m * z * p + fe * -2.12194440e-4f - 0.5f * z;
+    y              = m + y + fe * 0.693359375f;
+
+    return select(std::isnan(x) || std::isinf(x), x, y);
+}
+
+// exp(x) - 1, within 1.5 ulp
+inline float fast_expm1(float x)
+{
+    // Taylor series around 0, where exp(x) - 1 cancels
+    float p = 1.f / 362880.f;
+    p       = p * x + 1.f / 40320.f;
+    p       = p * x + 1.f / 5040.f;
+    p       = p * x + 1.f / 720.f;
+    p       = p * x + 1.f / 120.f;
+    p       = p * x + 1.f / 24.f;
+    p       = p * x + 1.f / 6.f;
+    p       = p * x + 0.5f;
+
+    const float y_small = p * x * x + x;
+    const float y_large = fast_exp(x) - 1.f;
+
+    return select(std::abs(x) < 0.5f, y_small, y_large);
+}
+
+// tanh(x), within 1.5 ulp
+inline float fast_tanh(float x)
+{
+    const float ax = std::abs(x);
+    const float z  = x * x;
+
+    float p = -5.70498872745e-3f;
+    p       = p * z + 2.06390887954e-2f;
+    p       = p * z - 5.37397155531e-2f;
+    p       = p * z + 1.33314422036e-1f;
+    p       = p * z - 3.33332819422e-1f;
+
+    const float y_small = p * z * x + x;
+    const float y_large = 1.f - 2.f / (fast_exp(2.f * ax) + 1.f);
+
+    return select(ax < 0.625f, y_small, std::copysign(y_large, x));
+}
+
+// erf(x), within 2.5 ulp
+inline float fast_erf(float x)
+{
+    // odd polynomial for small |x|
+    const float z = x * x;
+
+    float p = 7.853861353153693e-5f;
+    p       = p * z - 8.010193625184903e-4f;
+    p       = p * z + 5.188327685732524e-3f;
+    p       = p * z - 2.685381193529856e-2f;
+    p       = p * z + 1.128358514861418e-1f;
+    p       = p * z - 3.761262582423300e-1f;
+    p       = p * z + 1.128379165726710e+0f;
+
+    // 1 - erfc(|x|) otherwise, erfc(x) = t * exp(-x^2 + q(t)), t = 1 / (1 + x / 2)
+    const float ax = select(std::abs(x) < 10.f, std::abs(x), 10.f);
+    const float t  = 1.f / (1.f + 0.5f * ax);
+
+    float q = 0.17087277f;
+    q       = q * t - 0.82215223f;
+    q       = q * t + 1.48851587f;
+    q       = q * t - 1.13520398f;
+    q       = q * t + 0.27886807f;
+    q       = q * t - 0.18628806f;
+    q       = q * t + 0.09678418f;
+    q       = q * t + 0.37409196f;
+    q       = q * t + 1.00002368f;
+    q       = q * t - 1.26551223f;
+
+    const float y_small = x * p;
+    const float y_large = 1.f - t * fast_exp(q - ax * ax);
+
+    const float y = select(std::abs(x) < 0.75f, y_small, std::copysign(y_large, x));
+
+    return select(std::isnan(x), x, y);
+}
+
+// p_y[i] = f(p_x[i]) if both spans are float, op(p_y[i], p_x[i]) otherwise
+template <typename ElementOp, typename Y, typename X, typename F>
+void apply_float(const ElementOp& op, Y* p_y, const X* p_x, std::size_t n, F f)
+{
+    if constexpr(is_same_v<Y, float> && is_same_v<X, float>)
+    {
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            p_y[i] = f(p_x[i]);
+        }
+    }
+    else
+    {
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            op(p_y[i], p_x[i]);
+        }
+    }
+}
+
+} // namespace detail
+
+// Scalar operator in a loop, for operators without a batch implementation
+template <typename ElementOp>
+struct HostElementWiseBatch
+{
+    template <typename Y, typename X>
+    static void Run(const ElementOp& op, Y* p_y, const X* p_x, std::size_t n)
+    {
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            op(p_y[i], p_x[i]);
+        }
+    }
+
+    template <typename Y, typename X0, typename X1>
+    static void Run(const ElementOp& op, Y* p_y, const X0* p_x0, const X1* p_x1, std::size_t n)
+    {
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            op(p_y[i], p_x0[i], p_x1[i]);
+        }
+    }
+};
+
+template <>
+struct HostElementWiseBatch<element_wise::FastGelu>
+{
+    static float Compute(float x)
+    {
+        const float u   = 2.f * x * (0.035677f * x * x + 0.797885f);
+        const float emu = detail::fast_exp(-u);
+        const float cdf = 0.5f + 0.5f * (2.f / (1.f + emu) - 1.f);
+
+        return x * cdf;
+    }
+
+    // float and half_t, half_t is computed in float as by the scalar operator
+    template <typename Y, typename X>
+    static void Run(const element_wise::FastGelu& op, Y* p_y, const X* p_x, std::size_t n)
+    {
+        if constexpr((is_same_v<Y, float> && is_same_v<X, float>) ||
+                     (is_same_v<Y, half_t> && (is_same_v<X, float> || is_same_v<X, half_t>)))
+        {
+            for(std::size_t i = 0; i < n; ++i)
+            {
+                p_y[i] = type_convert<Y>(Compute(type_convert<float>(p_x[i])));
+            }
+        }
+        else
+        {
+            for(std::size_t i = 0; i < n; ++i)
+            {
+                op(p_y[i], p_x[i]);
+            }
+        }
+    }
+};
+
+template <>
+struct HostElementWiseBatch<element_wise::Gelu>
+{
+    template <typename Y, typename X>
+    static void Run(const element_wise::Gelu& op, Y* p_y, const X* p_x, std::size_t n)
+    {
+        detail::apply_float(op, p_y, p_x, n, [](float x) {
+            return 0.5f * x * (1.f + detail::fast_erf(0.70710678118f * x));
+        });
+    }
+};
+
+template <>
+struct HostElementWiseBatch<element_wise::Sigmoid>
+{
+    template <typename Y, typename X>
+    static void Run(const element_wise::Sigmoid& op, Y* p_y, const X* p_x, std::size_t n)
+    {
+        detail::apply_float(
+            op, p_y, p_x, n, [](float x) { return 1.f / (1.f + detail::fast_exp(-x)); });
+    }
+};
+
+template <>
+struct HostElementWiseBatch<element_wise::TanH>
+{
+    template <typename Y, typename X>
+    static void Run(const element_wise::TanH& op, Y* p_y, const X* p_x, std::size_t n)
+    {
+        detail::apply_float(op, p_y, p_x, n, [](float x) { return detail::fast_tanh(x); });
+    }
+};
+
+template <>
+struct HostElementWiseBatch<element_wise::Swish>
+{
+    template <typename Y, typename X>
+    static void Run(const element_wise::Swish& op, Y* p_y, const X* p_x, std::size_t n)
+    {
+        const float beta = op.beta_;
+
+        detail::apply_float(op, p_y, p_x, n, [beta](float x) {
+            return x / (1.f + detail::fast_exp(-beta * x));
+        });
+    }
+};
+
+template <>
+struct HostElementWiseBatch<element_wise::SoftRelu>
+{
+    template <typename Y, typename X>
+    static void Run(const element_wise::SoftRelu& op, Y* p_y, const X* p_x, std::size_t n)
+    {
+        const float alpha = op.alpha_;
+
+        detail::apply_float(op, p_y, p_x, n, [alpha](float x) {
+            return detail::fast_log(1.f + detail::fast_exp(x * alpha)) / alpha;
+        });
+    }
+};
+
+template <>
+struct HostElementWiseBatch<element_wise::Elu>
+{
+    template <typename Y, typename X>
+    static void Run(const element_wise::Elu& op, Y* p_y, const X* p_x, std::size_t n)
+    {
+        const float alpha = op.alpha_;
+
+        detail::apply_float(op, p_y, p_x, n, [alpha](float x) {
+            return detail::select(x > 0, x, alpha * detail::fast_expm1(x));
+        });
+    }
+};
+
+/**
+ * \brief Apply unary element-wise operator to a contiguous span, p_y[i] = op(p_x[i]).
+ *
+ * \param op Element-wise operator.
+ * \param p_y Output, may be p_x.
+ * \param p_x Input.
+ * \param n Number of elements.
+ */
+template <typename ElementOp, typename Y, typename X>
+void apply_element_wise(const ElementOp& op, Y* p_y, const X* p_x, std::size_t n)
+{
+    HostElementWiseBatch<ElementOp>::Run(op, p_y, p_x, n);
+}
+
+/**
+ * \brief Apply binary element-wise operator to contiguous spans, p_y[i] = op(p_x0[i], p_x1[i]).
+ *
+ * \param op Element-wise operator.
+ * \param p_y Output, may be one of the inputs.
+ * \param p_x0 First input.
+ * \param p_x1 Second input.
+ * \param n Number of elements.
+ */
+template <typename ElementOp, typename Y, typename X0, typename X1>
+void apply_element_wise(
+    const ElementOp& op, Y* p_y, const X0* p_x0, const X1* p_x1, std::size_t n)
+{
+    HostElementWiseBatch<ElementOp>::Run(op, p_y, p_x0, p_x1, n);
+}
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
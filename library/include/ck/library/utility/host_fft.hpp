@@ -0,0 +1,243 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Double precision complex FFTs for the host references.
+//
+// A HostFftPlan holds the bit reversal permutation and the twiddle factors of one power of two
+// length. HostFftPlan::Get() keeps the plans of every length used so far for the whole process, so
+// references that transform many buffers of the same lengths, within one call or across calls,
+// compute them once.
+
+namespace ck {
+namespace utils {
+
+// a * b without the NaN and infinity handling of std::complex, which keeps it out of the loops
+inline std::complex<double> fft_multiply(std::complex<double> a, std::complex<double> b)
+{
+    return {a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real()};
+}
+
+class HostFftPlan
+{
+    public:
+    static bool IsValidLength(std::size_t length)
+    {
+        return length > 0 && (length & (length - 1)) == 0;
+    }
+
+    // process wide plan cache, safe to call from several threads
+    static std::shared_ptr<const HostFftPlan> Get(std::size_t length)
+    {
+        static std::mutex mutex;
+        static std::unordered_map<std::size_t, std::shared_ptr<const HostFftPlan>> plans;
+
+        std::lock_guard<std::mutex> lock(mutex);
+
+        auto& plan = plans[length];
+
+        if(!plan)
+        {
+            plan = std::make_shared<const HostFftPlan>(length);
+        }
+
+        return plan;
+    }
+
+    explicit HostFftPlan(std::size_t length) : length_(length)
+    {
+        if(!IsValidLength(length))
+        {
+            throw std::runtime_error("wrong! FFT length must be a power of 2");
+        }
+
+        std::size_t log2_length = 0;
+        while((std::size_t{1} << log2_length) < length)
+        {
+            ++log2_length;
+        }
+
+        bit_reverse_.resize(length);
+
+        for(std::size_t i = 0; i < length; ++i)
+        {
+            std::size_t r = 0;
+
+            for(std::size_t b = 0; b < log2_length; ++b)
+            {
+                r |= ((i >> b) & 1) << (log2_length - 1 - b);
+            }
+
+            bit_reverse_[i] = r;
+        }
+
+        const double pi = std::acos(-1.0);
+
+        twiddles_.resize(length / 2);
+
+        for(std::size_t j = 0; j < length / 2; ++j)
+        {
+            twiddles_[j] =
+                std::polar(1.0, -2 * pi * static_cast<double>(j) / static_cast<double>(length));
+        }
+    }
+
+    std::size_t GetLength() const { return length_; }
+
+    // in place, X[f] = sum_t x[t] exp(-2 pi i f t / length)
+    void Forward(std::complex<double>* p_data) const { Transform(p_data, false); }
+
+    // in place, including the scaling by 1 / length
+    void Inverse(std::complex<double>* p_data) const { Transform(p_data, true); }
+
+    private:
+    void Transform(std::complex<double>* p_data, bool inverse) const
+    {
+        for(std::size_t i = 0; i < length_; ++i)
+        {
+            if(i < bit_reverse_[i])
+            {
+                std::swap(p_data[i], p_data[bit_reverse_[i]]);
+            }
+        }
+
+        for(std::size_t half = 1; half < length_; half *= 2)
+        {
+            const std::size_t step = length_ / (2 * half);
+
+            for(std::size_t i = 0; i < length_; i += 2 * half)
+            {
+                for(std::size_t j = 0; j < half; ++j)
+                {
+                    const auto w = inverse ? std::conj(twiddles_[j * step]) : twiddles_[j * step];
+
+                    const auto u = p_data[i + j];
+                    const auto v = fft_multiply(p_data[i + j + half], w);
+
+                    p_data[i + j]        = u + v;
+                    p_data[i + j + half] = u - v;
+                }
+            }
+        }
+
+        if(inverse)
+        {
+            const double scale = 1.0 / static_cast<double>(length_);
+
+            for(std::size_t i = 0; i < length_; ++i)
+            {
+                p_data[i] *= scale;
+            }
+        }
+    }
+
+    std::size_t length_;
+    std::vector<std::size_t> bit_reverse_;
+    std::vector<std::complex<double>> twiddles_;
+};
+
+// Multi-dimensional FFT of a packed row-major buffer, one HostFftPlan per dimension
+class HostFftNdPlan
+{
+    public:
+    explicit HostFftNdPlan(const std::vector<std::size_t>& lengths) : lengths_(lengths)
+    {
+        for(std::size_t length : lengths)
+        {
+            plans_.push_back(HostFftPlan::Get(length));
+        }
+    }
+
+    std::size_t GetElementSize() const
+    {
+        std::size_t size = 1;
+
+        for(std::size_t length : lengths_)
+        {
+            size *= length;
+        }
+
+        return size;
+    }
+
+    void Forward(std::complex<double>* p_data) const { Transform(p_data, false); }
+
+    void Inverse(std::complex<double>* p_data) const { Transform(p_data, true); }
+
+    private:
+    // the lines along the innermost dimension are transformed in place, the others are gathered
+    // into a contiguous line first
+    void Transform(std::complex<double>* p_data, bool inverse) const
+    {
+        const std::size_t size = GetElementSize();
+
+        std::vector<std::complex<double>> line;
+
+        std::size_t stride = 1;
+
+        for(std::size_t d = lengths_.size(); d > 0; --d)
+        {
+            const std::size_t length = lengths_[d - 1];
+            const auto& plan         = *plans_[d - 1];
+
+            if(length > 1)
+            {
+                line.resize(length);
+
+                // lines start at every offset that has index 0 along dimension d - 1
+                for(std::size_t outer = 0; outer < size; outer += length * stride)
+                {
+                    for(std::size_t inner = 0; inner < stride; ++inner)
+                    {
+                        std::complex<double>* p_line = p_data + outer + inner;
+
+                        std::complex<double>* p_contiguous = stride == 1 ? p_line : line.data();
+
+                        for(std::size_t i = 0; stride != 1 && i < length; ++i)
+                        {
+                            line[i] = p_line[i * stride];
+                        }
+
+                        if(inverse)
+                        {
+                            plan.Inverse(p_contiguous);
+                        }
+                        else
+                        {
+                            plan.Forward(p_contiguous);
+                        }
+
+                        if(stride == 1)
+                        {
+                            continue;
+                        }
+
+                        for(std::size_t i = 0; i < length; ++i)
+                        {
+                            p_line[i * stride] = line[i];
+                        }
+                    }
+                }
+            }
+
+            stride *= length;
+        }
+    }
+
+    std::vector<std::size_t> lengths_;
+    std::vector<std::shared_ptr<const HostFftPlan>> plans_;
+};
+
+} // namespace utils
+} // namespace ck
@@ -0,0 +1,205 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "ck/utility/data_type.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
+
+// Exact integer GEMM for the int8 and int4 host references.
+//
+// The float accumulation of the generic references rounds once a sum of int8 products exceeds
+// 2^24, e.g. for K >= 1024 with values near the int8 range, so a quantized kernel can not be
+// checked bit for bit against them. integer_gemm_packed() accumulates in int32 like the device
+// kernels do. The operands are packed once to int16 rows with K contiguous, so that every output
+// is a dot product over two contiguous rows: the host compiler turns the inner loop into
+// multiply-add of int16 pairs into int32 lanes (pmaddwd, vpmaddwd, vpdpwssd). Each tile of
+// IntegerGemmMPerTile x IntegerGemmNPerTile outputs is kept in registers and reuses every loaded
+// row, and blocks of IntegerGemmNPerBlock rows of B stay in cache for a block of rows of A.
+//
+// The int32 accumulation wraps as on the device only for K beyond 2^31 / 2^14 = 131072.
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+template <typename T>
+inline constexpr bool is_host_integer_gemm_type_v =
+    std::is_same_v<T, int8_t> || std::is_same_v<T, int4_t>;
+
+inline constexpr std::size_t IntegerGemmMPerTile   = 2;
+inline constexpr std::size_t IntegerGemmNPerTile   = 4;
+inline constexpr std::size_t IntegerGemmMPerBlock  = 32;
+inline constexpr std::size_t IntegerGemmNPerBlock  = 64;
+inline constexpr std::size_t IntegerGemmSerialMacs = std::size_t{1} << 22;
+
+namespace detail {
+
+// c[i * ldc + j] = sum_k a[i][k] * b[j][k] for i < m <= MPerTile, j < n <= NPerTile; rows past
+// m and n repeat the first row and are computed but not stored
+inline void integer_gemm_tile(const int16_t* p_a,
+                              const int16_t* p_b,
+                              int32_t* p_c,
+                              std::size_t ldc,
+                              std::size_t K,
+                              std::size_t m,
+                              std::size_t n)
+{
+    constexpr std::size_t MPerTile = IntegerGemmMPerTile;
+    constexpr std::size_t NPerTile = IntegerGemmNPerTile;
+
+    const int16_t* p_a_row[MPerTile];
+    const int16_t* p_b_row[NPerTile];
+
+    for(std::size_t i = 0; i < MPerTile; ++i)
+    {
+        p_a_row[i] = p_a + (i < m ? i : 0) * K;
+    }
+
+    for(std::size_t j = 0; j < NPerTile; ++j)
+    {
+        p_b_row[j] = p_b + (j < n ? j : 0) * K;
+    }
+
+    int32_t acc[MPerTile][NPerTile] = {};
+
+    for(std::size_t k = 0; k < K; ++k)
+    {
+        for(std::size_t i = 0; i < MPerTile; ++i)
+        {
+            for(std::size_t j = 0; j < NPerTile; ++j)
+            {
+                acc[i][j] += static_cast<int32_t>(p_a_row[i][k]) * p_b_row[j][k];
+            }
+        }
+    }
+
+    for(std::size_t i = 0; i < m; ++i)
+    {
+        for(std::size_t j = 0; j < n; ++j)
+        {
+            p_c[i * ldc + j] = acc[i][j];
+        }
+    }
+}
+
+} // namespace detail
+
+// Packs rows x K values f(row, k) to int16 with K contiguous
+template <typename F>
+std::vector<int16_t> pack_integer_gemm_rows(std::size_t rows, std::size_t K, F&& f)
+{
+    std::vector<int16_t> packed(rows * K);
+
+    for(std::size_t r = 0; r < rows; ++r)
+    {
+        for(std::size_t k = 0; k < K; ++k)
+        {
+            packed[r * K + k] = static_cast<int16_t>(f(r, k));
+        }
+    }
+
+    return packed;
+}
+
+// c[m * N + n] = sum_k a[m * K + k] * b[n * K + k] in int32, for A [M, K] and B [N, K] packed
+// by pack_integer_gemm_rows(). Blocks of C are spread over HostThreadPool for large problems.
+inline void integer_gemm_packed(const int16_t* p_a,
+                                const int16_t* p_b,
+                                int32_t* p_c,
+                                std::size_t M,
+                                std::size_t N,
+                                std::size_t K)
+{
+    if(M == 0 || N == 0)
+    {
+        return;
+    }
+
+    if(K == 0)
+    {
+        std::fill(p_c, p_c + M * N, 0);
+        return;
+    }
+
+    const std::size_t num_m_block = (M + IntegerGemmMPerBlock - 1) / IntegerGemmMPerBlock;
+    const std::size_t num_n_block = (N + IntegerGemmNPerBlock - 1) / IntegerGemmNPerBlock;
+
+    auto run_block = [&](std::size_t block) {
+        const std::size_t m_begin = (block % num_m_block) * IntegerGemmMPerBlock;
+        const std::size_t n_begin = (block / num_m_block) * IntegerGemmNPerBlock;
+        const std::size_t m_end   = std::min(M, m_begin + IntegerGemmMPerBlock);
+        const std::size_t n_end   = std::min(N, n_begin + IntegerGemmNPerBlock);
+
+        for(std::size_t m = m_begin; m < m_end; m += IntegerGemmMPerTile)
+        {
+            for(std::size_t n = n_begin; n < n_end; n += IntegerGemmNPerTile)
+            {
+                detail::integer_gemm_tile(p_a + m * K,
+                                          p_b + n * K,
+                                          p_c + m * N + n,
+                                          N,
+                                          K,
+                                          std::min(IntegerGemmMPerTile, m_end - m),
+                                          std::min(IntegerGemmNPerTile, n_end - n));
+            }
+        }
+    };
+
+    // consecutive blocks share the block of B
+    const std::size_t num_block = num_m_block * num_n_block;
+
+    if(M * N * K < IntegerGemmSerialMacs)
+    {
+        for(std::size_t block = 0; block < num_block; ++block)
+        {
+            run_block(block);
+        }
+    }
+    else
+    {
+        ck::utils::HostThreadPool::GetInstance().ParallelFor(num_block, run_block);
+    }
+}
+
+// acc[m * N + n] = sum_k a_m_k(m, k) * b_k_n(k, n) in int32
+template <typename ADataType, typename BDataType>
+std::vector<int32_t> integer_gemm(const Tensor<ADataType>& a_m_k, const Tensor<BDataType>& b_k_n)
+{
+    const std::size_t M = a_m_k.mDesc.GetLengths()[0];
+    const std::size_t K = a_m_k.mDesc.GetLengths()[1];
+    const std::size_t N = b_k_n.mDesc.GetLengths()[1];
+
+    if(b_k_n.mDesc.GetLengths()[0] != K)
+    {
+        throw std::runtime_error("wrong! inconsistent K");
+    }
+
+    const auto& a_strides = a_m_k.mDesc.GetStrides();
+    const auto& b_strides = b_k_n.mDesc.GetStrides();
+
+    const auto a_packed = pack_integer_gemm_rows(M, K, [&](std::size_t m, std::size_t k) {
+        return a_m_k.mData[m * a_strides[0] + k * a_strides[1]];
+    });
+    const auto b_packed = pack_integer_gemm_rows(N, K, [&](std::size_t n, std::size_t k) {
+        return b_k_n.mData[k * b_strides[0] + n * b_strides[1]];
+    });
+
+    std::vector<int32_t> acc(M * N);
+
+    integer_gemm_packed(a_packed.data(), b_packed.data(), acc.data(), M, N, K);
+
+    return acc;
+}
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
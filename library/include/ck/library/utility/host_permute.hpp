@@ -0,0 +1,501 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/unary_element_wise_operation.hpp"
+#include "ck/library/utility/host_element_wise_batch.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
+
+namespace ck {
+namespace utils {
+
+// Host permutation of tensors of any rank, dst(i_0, ..., i_n) = op(src(i_new2old...)), i.e.
+// dimension i of dst is dimension new2old[i] of src, as for
+// transpose_host_tensor_descriptor_given_new2old(). Unlike that function, which only relabels
+// strides, the data is moved into the layout of dst.
+//
+// make_host_permute_plan() drops unit dimensions and merges dimensions that are contiguous in both
+// tensors, so e.g. NCDHW -> NDHWC becomes a batch of 2-D transposes [C, DHW] -> [DHW, C]. If the
+// innermost dimension of src and dst is the same one, rows are copied with apply_element_wise().
+// Otherwise the plane of the two innermost dimensions is transposed in cache blocks of
+// HostPermuteBlock x HostPermuteBlock elements, each block through register tiles of
+// HostPermuteTile x HostPermuteTile elements, that are read along the contiguous dimension of src
+// and written along the contiguous dimension of dst. Blocks and outer dimensions are distributed
+// over HostThreadPool.
+
+struct HostPermutePlan
+{
+    // dimensions after dropping unit lengths and merging, in dst order
+    std::vector<std::size_t> lengths_;
+    std::vector<std::size_t> src_strides_;
+    std::vector<std::size_t> dst_strides_;
+
+    // dimensions with the smallest stride in src and in dst
+    std::size_t src_inner_ = 0;
+    std::size_t dst_inner_ = 0;
+
+    std::size_t element_size_ = 0;
+
+    std::size_t GetNumOfDimension() const { return lengths_.size(); }
+};
+
+inline constexpr std::size_t HostPermuteBlock = 64;
+inline constexpr std::size_t HostPermuteTile  = 8;
+
+// below this number of elements a permutation runs on the calling thread
+inline constexpr std::size_t HostPermuteParallelThreshold = std::size_t{1} << 16;
+
+inline HostPermutePlan make_host_permute_plan(const HostTensorDescriptor& src_desc,
+                                              const HostTensorDescriptor& dst_desc,
+                                              const std::vector<std::size_t>& new2old)
+{
+    const std::size_t num_dim = src_desc.GetNumOfDimension();
+
+    if(dst_desc.GetNumOfDimension() != num_dim || new2old.size() != num_dim)
+    {
+        throw std::runtime_error("wrong! inconsistent number of dimensions for permute");
+    }
+
+    std::vector<bool> used(num_dim, false);
+
+    for(std::size_t i = 0; i < num_dim; ++i)
+    {
+        if(new2old[i] >= num_dim || used[new2old[i]])
+        {
+            throw std::runtime_error("wrong! new2old is not a permutation");
+        }
+
+        used[new2old[i]] = true;
+
+        if(dst_desc.GetLengths()[i] != src_desc.GetLengths()[new2old[i]])
+        {
+            throw std::runtime_error("wrong! dst lengths are not the permuted src lengths");
+        }
+    }
+
+    HostPermutePlan plan;
+
+    plan.element_size_ = dst_desc.GetElementSize();
+
+    for(std::size_t i = 0; i < num_dim; ++i)
+    {
+        const std::size_t length     = dst_desc.GetLengths()[i];
+        const std::size_t src_stride = src_desc.GetStrides()[new2old[i]];
+        const std::size_t dst_stride = dst_desc.GetStrides()[i];
+
+        if(length == 1)
+        {
+            continue;
+        }
+
+        // merge into the previous dimension if both tensors continue it
+        if(!plan.lengths_.empty() && plan.src_strides_.back() == src_stride * length &&
+           plan.dst_strides_.back() == dst_stride * length)
+        {
+            plan.lengths_.back() *= length;
+            plan.src_strides_.back() = src_stride;
+            plan.dst_strides_.back() = dst_stride;
+            continue;
+        }
+
+        plan.lengths_.push_back(length);
+        plan.src_strides_.push_back(src_stride);
+        plan.dst_strides_.push_back(dst_stride);
+    }
+
+    if(plan.lengths_.empty())
+    {
+        plan.lengths_     = {1};
+        plan.src_strides_ = {0};
+        plan.dst_strides_ = {0};
+    }
+
+    // later dimensions win ties, so that packed tensors keep their last dimension innermost
+    for(std::size_t i = 0; i < plan.GetNumOfDimension(); ++i)
+    {
+        if(plan.dst_strides_[i] <= plan.dst_strides_[plan.dst_inner_])
+        {
+            plan.dst_inner_ = i;
+        }
+
+        if(plan.src_strides_[i] <= plan.src_strides_[plan.src_inner_])
+        {
+            plan.src_inner_ = i;
+        }
+    }
+
+    if(plan.src_strides_[plan.dst_inner_] == plan.src_strides_[plan.src_inner_])
+    {
+        plan.src_inner_ = plan.dst_inner_;
+    }
+
+    return plan;
+}
+
+namespace detail {
+
+using UnitStride = std::integral_constant<std::size_t, 1>;
+
+// m x n elements, i along the contiguous dimension of src, j along the contiguous dimension of dst
+template <typename Src,
+          typename Dst,
+          typename ElementOp,
+          typename SrcStrideI,
+          typename DstStrideJ>
+void permute_block(const Src* p_src,
+                   Dst* p_dst,
+                   std::size_t m,
+                   std::size_t n,
+                   SrcStrideI src_stride_i,
+                   std::size_t src_stride_j,
+                   std::size_t dst_stride_i,
+                   DstStrideJ dst_stride_j,
+                   const ElementOp& op)
+{
+    constexpr std::size_t T = HostPermuteTile;
+
+    const std::size_t m_tile = m - m % T;
+    const std::size_t n_tile = n - n % T;
+
+    for(std::size_t i0 = 0; i0 < m_tile; i0 += T)
+    {
+        for(std::size_t j0 = 0; j0 < n_tile; j0 += T)
+        {
+            // transposed in registers: read rows of src, write rows of dst
+            Dst tile[T][T];
+
+            for(std::size_t j = 0; j < T; ++j)
+            {
+                for(std::size_t i = 0; i < T; ++i)
+                {
+                    op(tile[j][i], p_src[(i0 + i) * src_stride_i + (j0 + j) * src_stride_j]);
+                }
+            }
+
+            for(std::size_t i = 0; i < T; ++i)
+            {
+                for(std::size_t j = 0; j < T; ++j)
+                {
+                    p_dst[(i0 + i) * dst_stride_i + (j0 + j) * dst_stride_j] = tile[j][i];
+                }
+            }
+        }
+    }
+
+    // edges
+    for(std::size_t i = 0; i < m; ++i)
+    {
+        for(std::size_t j = (i < m_tile ? n_tile : 0); j < n; ++j)
+        {
+            op(p_dst[i * dst_stride_i + j * dst_stride_j],
+               p_src[i * src_stride_i + j * src_stride_j]);
+        }
+    }
+}
+
+template <typename Src, typename Dst, typename ElementOp>
+void permute_row(const Src* p_src,
+                 Dst* p_dst,
+                 std::size_t n,
+                 std::size_t src_stride,
+                 std::size_t dst_stride,
+                 const ElementOp& op)
+{
+    if(src_stride == 1 && dst_stride == 1)
+    {
+        tensor_operation::host::apply_element_wise(op, p_dst, p_src, n);
+        return;
+    }
+
+    for(std::size_t j = 0; j < n; ++j)
+    {
+        op(p_dst[j * dst_stride], p_src[j * src_stride]);
+    }
+}
+
+} // namespace detail
+
+/**
+ * \brief Run a permutation plan on raw buffers.
+ *
+ * \param plan Plan from make_host_permute_plan().
+ * \param p_src Source buffer, laid out as the src descriptor of the plan.
+ * \param p_dst Destination buffer, laid out as the dst descriptor of the plan, must not overlap
+ *              the source.
+ * \param op Element-wise operator applied on the way, called as op(dst_element, src_element).
+ */
+template <typename Src, typename Dst, typename ElementOp>
+void run_host_permute_plan(const HostPermutePlan& plan,
+                           const Src* p_src,
+                           Dst* p_dst,
+                           const ElementOp& op)
+{
+    if(plan.element_size_ == 0)
+    {
+        return;
+    }
+
+    const std::size_t a = plan.src_inner_;
+    const std::size_t b = plan.dst_inner_;
+
+    const bool transpose = a != b;
+
+    // all dimensions but the inner ones, last fastest
+    std::vector<std::size_t> outer;
+    for(std::size_t i = 0; i < plan.GetNumOfDimension(); ++i)
+    {
+        if(i != a && i != b)
+        {
+            outer.push_back(i);
+        }
+    }
+
+    std::size_t num_outer = 1;
+    for(std::size_t i : outer)
+    {
+        num_outer *= plan.lengths_[i];
+    }
+
+    constexpr std::size_t B = HostPermuteBlock;
+
+    const std::size_t length_a = transpose ? plan.lengths_[a] : 1;
+    const std::size_t length_b = plan.lengths_[b];
+
+    // rows are split into chunks of a block's size
+    const std::size_t chunk_b  = transpose ? B : B * B;
+    const std::size_t num_blk_a = (length_a + B - 1) / B;
+    const std::size_t num_blk_b = (length_b + chunk_b - 1) / chunk_b;
+
+    const auto run_task = [&](std::size_t task) {
+        const std::size_t blk_b = task % num_blk_b;
+        const std::size_t blk_a = task / num_blk_b % num_blk_a;
+        std::size_t outer_id    = task / num_blk_b / num_blk_a;
+
+        std::size_t src_offset = 0;
+        std::size_t dst_offset = 0;
+
+        for(std::size_t k = outer.size(); k > 0; --k)
+        {
+            const std::size_t dim = outer[k - 1];
+            const std::size_t idx = outer_id % plan.lengths_[dim];
+
+            outer_id /= plan.lengths_[dim];
+            src_offset += idx * plan.src_strides_[dim];
+            dst_offset += idx * plan.dst_strides_[dim];
+        }
+
+        const std::size_t b_begin = blk_b * chunk_b;
+        const std::size_t n       = std::min(chunk_b, length_b - b_begin);
+
+        src_offset += b_begin * plan.src_strides_[b];
+        dst_offset += b_begin * plan.dst_strides_[b];
+
+        if(!transpose)
+        {
+            detail::permute_row(p_src + src_offset,
+                                p_dst + dst_offset,
+                                n,
+                                plan.src_strides_[b],
+                                plan.dst_strides_[b],
+                                op);
+            return;
+        }
+
+        const std::size_t a_begin = blk_a * B;
+        const std::size_t m       = std::min(B, length_a - a_begin);
+
+        src_offset += a_begin * plan.src_strides_[a];
+        dst_offset += a_begin * plan.dst_strides_[a];
+
+        if(plan.src_strides_[a] == 1 && plan.dst_strides_[b] == 1)
+        {
+            detail::permute_block(p_src + src_offset,
+                                  p_dst + dst_offset,
+                                  m,
+                                  n,
+                                  detail::UnitStride{},
+                                  plan.src_strides_[b],
+                                  plan.dst_strides_[a],
+                                  detail::UnitStride{},
+                                  op);
+        }
+        else
+        {
+            detail::permute_block(p_src + src_offset,
+                                  p_dst + dst_offset,
+                                  m,
+                                  n,
+                                  plan.src_strides_[a],
+                                  plan.src_strides_[b],
+                                  plan.dst_strides_[a],
+                                  plan.dst_strides_[b],
+                                  op);
+        }
+    };
+
+    const std::size_t num_task = num_outer * num_blk_a * num_blk_b;
+
+    if(plan.element_size_ < HostPermuteParallelThreshold)
+    {
+        for(std::size_t task = 0; task < num_task; ++task)
+        {
+            run_task(task);
+        }
+    }
+    else
+    {
+        HostThreadPool::GetInstance().ParallelFor(num_task, run_task);
+    }
+}
+
+/**
+ * \brief Permute a host tensor into another one, dst(i...) = op(src(i_new2old...)).
+ *
+ * \param src Source tensor.
+ * \param new2old Dimension new2old[i] of src becomes dimension i of dst.
+ * \param dst Destination tensor with the permuted lengths of src and any strides.
+ * \param op Element-wise operator applied on the way.
+ */
+template <typename Src,
+          typename Dst,
+          typename ElementOp = tensor_operation::element_wise::PassThrough>
+void permute_host_tensor(const Tensor<Src>& src,
+                         const std::vector<std::size_t>& new2old,
+                         Tensor<Dst>& dst,
+                         const ElementOp& op = ElementOp{})
+{
+    const auto plan = make_host_permute_plan(src.mDesc, dst.mDesc, new2old);
+
+    run_host_permute_plan(plan, src.mData.data(), dst.mData.data(), op);
+}
+
+/**
+ * \brief Materialize a transposed host tensor, the data counterpart of
+ * transpose_host_tensor_descriptor_given_new2old().
+ *
+ * \param src Source tensor.
+ * \param new2old Dimension new2old[i] of src becomes dimension i of the result.
+ * \return Packed tensor with the permuted lengths of src.
+ */
+template <typename T>
+Tensor<T> transpose_host_tensor_given_new2old(const Tensor<T>& src,
+                                              const std::vector<std::size_t>& new2old)
+{
+    if(new2old.size() != src.mDesc.GetNumOfDimension())
+    {
+        throw std::runtime_error("wrong! inconsistent number of dimensions for permute");
+    }
+
+    std::vector<std::size_t> lengths;
+    for(std::size_t i : new2old)
+    {
+        if(i >= src.mDesc.GetNumOfDimension())
+        {
+            throw std::runtime_error("wrong! new2old is not a permutation");
+        }
+
+        lengths.push_back(src.mDesc.GetLengths()[i]);
+    }
+
+    Tensor<T> dst(lengths);
+
+    permute_host_tensor(src, new2old, dst);
+
+    return dst;
+}
+
+/**
+ * \brief Permute a packed host tensor in place, following the cycles of the permutation.
+ *
+ * Needs one bit of extra memory per element instead of a second tensor, but visits memory in
+ * cycle order and runs on one thread, prefer the materializing functions if memory allows.
+ * Afterwards the tensor is packed with the permuted lengths.
+ *
+ * \param tensor Packed tensor.
+ * \param new2old Dimension new2old[i] of the tensor becomes dimension i.
+ */
+template <typename T>
+void permute_host_tensor_in_place(Tensor<T>& tensor, const std::vector<std::size_t>& new2old)
+{
+    const auto& old_desc = tensor.mDesc;
+
+    if(old_desc.GetStrides() != HostTensorDescriptor(old_desc.GetLengths()).GetStrides())
+    {
+        throw std::runtime_error("wrong! in place permute needs a packed tensor");
+    }
+
+    if(new2old.size() != old_desc.GetNumOfDimension())
+    {
+        throw std::runtime_error("wrong! inconsistent number of dimensions for permute");
+    }
+
+    std::vector<std::size_t> lengths;
+    for(std::size_t i : new2old)
+    {
+        if(i >= old_desc.GetNumOfDimension())
+        {
+            throw std::runtime_error("wrong! new2old is not a permutation");
+        }
+
+        lengths.push_back(old_desc.GetLengths()[i]);
+    }
+
+    HostTensorDescriptor new_desc(lengths);
+
+    const auto plan = make_host_permute_plan(old_desc, new_desc, new2old);
+
+    // after merging, a permutation that keeps the order of the dimensions is the identity
+    if(plan.GetNumOfDimension() > 1)
+    {
+        // element k of the result is element src_offset(k) of the tensor
+        const auto src_offset = [&](std::size_t k) {
+            std::size_t offset = 0;
+
+            for(std::size_t d = plan.GetNumOfDimension(); d > 0; --d)
+            {
+                offset += k % plan.lengths_[d - 1] * plan.src_strides_[d - 1];
+                k /= plan.lengths_[d - 1];
+            }
+
+            return offset;
+        };
+
+        std::vector<bool> done(plan.element_size_, false);
+
+        for(std::size_t start = 0; start < plan.element_size_; ++start)
+        {
+            if(done[start])
+            {
+                continue;
+            }
+
+            T first = tensor.mData[start];
+
+            std::size_t k = start;
+
+            for(std::size_t next = src_offset(k); next != start; next = src_offset(k))
+            {
+                tensor.mData[k] = tensor.mData[next];
+                done[k]         = true;
+                k               = next;
+            }
+
+            tensor.mData[k] = first;
+            done[k]         = true;
+        }
+    }
+
+    tensor.mDesc = new_desc;
+}
+
+} // namespace utils
+} // namespace ck
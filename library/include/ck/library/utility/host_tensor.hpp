@@ -16,6 +16,7 @@
 #include "ck/utility/type_convert.hpp"
 
 #include "ck/library/utility/algorithm.hpp"
+#include "ck/library/utility/caching_allocator.hpp"
 #include "ck/library/utility/ranges.hpp"
 
 template <typename Range>
@@ -236,11 +237,18 @@ auto make_ParallelTensorFunctor(F f, Xs... xs)
     return ParallelTensorFunctor<F, Xs...>(f, xs...);
 }
 
+// Constructor tag for a Tensor whose elements are default-initialized instead of zero-filled, for
+// tensors that are overwritten right away
+struct TensorUninitialized
+{
+    explicit TensorUninitialized() = default;
+};
+
 template <typename T>
 struct Tensor
 {
     using Descriptor = HostTensorDescriptor;
-    using Data       = std::vector<T>;
+    using Data       = std::vector<T, HostCachingAllocator<T>>;
 
     template <typename X>
     Tensor(std::initializer_list<X> lens) : mDesc(lens), mData(mDesc.GetElementSpaceSize())
@@ -266,10 +274,16 @@ struct Tensor
 
     Tensor(const Descriptor& desc) : mDesc(desc), mData(mDesc.GetElementSpaceSize()) {}
 
+    Tensor(const Descriptor& desc, TensorUninitialized)
+        : mDesc(desc),
+          mData(mDesc.GetElementSpaceSize(), HostCachingAllocator<T>{/*default_init=*/true})
+    {
+    }
+
     template <typename OutT>
     Tensor<OutT> CopyAsType() const
     {
-        Tensor<OutT> ret(mDesc);
+        Tensor<OutT> ret(mDesc, TensorUninitialized{});
 
         ck::ranges::transform(
             mData, ret.mData.begin(), [](auto value) { return ck::type_convert<OutT>(value); });
@@ -0,0 +1,519 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ck/utility/data_type.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+// Tensor files for replaying real inputs through the profiler and the examples.
+//
+// The format is NumPy's .npy: the magic string, a version and a header dictionary with the data
+// type, the lengths and the element order, padded so that the payload starts at a multiple of 64
+// bytes, followed by the elements. NumPy loads the files of the standard data types as is; the
+// data types NumPy does not have are written under the names of the ml_dtypes package (bfloat16,
+// float8_e4m3fnuz, float8_e5m2fnuz, int4).
+//
+// The element order is row major, or column major when "fortran_order" is set, which is what .npy
+// can express. save_host_tensor() picks the order that matches the strides of the tensor and
+// streams the elements out in chunks, leaving out the padding of strided tensors. HostTensorFile
+// maps a file instead of reading it, so that loading a tensor whose strides match the file is a
+// single memcpy from the mapping, and GetData() can be handed to DeviceMem::ToDevice() directly.
+
+namespace ck {
+namespace utils {
+
+// .npy "descr" of the element type, bhalf_t being unsigned short makes that bfloat16 too
+template <typename T>
+std::string get_host_tensor_file_data_type()
+{
+    if constexpr(std::is_same_v<T, float>)
+    {
+        return "<f4";
+    }
+    else if constexpr(std::is_same_v<T, double>)
+    {
+        return "<f8";
+    }
+    else if constexpr(std::is_same_v<T, half_t>)
+    {
+        return "<f2";
+    }
+    else if constexpr(std::is_same_v<T, bhalf_t>)
+    {
+        return "bfloat16";
+    }
+    else if constexpr(std::is_same_v<T, f8_t>)
+    {
+        return "float8_e4m3fnuz";
+    }
+    else if constexpr(std::is_same_v<T, bf8_t>)
+    {
+        return "float8_e5m2fnuz";
+    }
+    else if constexpr(std::is_same_v<T, int4_t>)
+    {
+        return "int4";
+    }
+    else if constexpr(std::is_same_v<T, int8_t>)
+    {
+        return "|i1";
+    }
+    else if constexpr(std::is_same_v<T, uint8_t>)
+    {
+        return "|u1";
+    }
+    else if constexpr(std::is_same_v<T, int32_t>)
+    {
+        return "<i4";
+    }
+    else if constexpr(std::is_same_v<T, int64_t>)
+    {
+        return "<i8";
+    }
+    else
+    {
+        static_assert(sizeof(T) == 0, "wrong! data type without a tensor file name");
+    }
+}
+
+namespace detail {
+
+inline constexpr std::size_t HostTensorFileAlignment  = 64;
+inline constexpr std::size_t HostTensorFileChunkBytes = std::size_t{1} << 20;
+inline constexpr char HostTensorFileMagic[]           = "\x93NUMPY";
+
+// dst = src for all indices of lengths, with the innermost dimension as the inner loop
+template <typename T>
+void copy_host_tensor_elements(const std::vector<std::size_t>& lengths,
+                               const T* p_src,
+                               const std::vector<std::size_t>& src_strides,
+                               T* p_dst,
+                               const std::vector<std::size_t>& dst_strides)
+{
+    const std::size_t num_dim = lengths.size();
+
+    if(num_dim == 0)
+    {
+        *p_dst = *p_src;
+        return;
+    }
+
+    if(std::find(lengths.begin(), lengths.end(), std::size_t{0}) != lengths.end())
+    {
+        return;
+    }
+
+    const std::size_t inner_length     = lengths[num_dim - 1];
+    const std::size_t inner_src_stride = src_strides[num_dim - 1];
+    const std::size_t inner_dst_stride = dst_strides[num_dim - 1];
+
+    std::vector<std::size_t> idx(num_dim, 0);
+
+    while(true)
+    {
+        std::size_t src_offset = 0;
+        std::size_t dst_offset = 0;
+
+        for(std::size_t d = 0; d + 1 < num_dim; ++d)
+        {
+            src_offset += idx[d] * src_strides[d];
+            dst_offset += idx[d] * dst_strides[d];
+        }
+
+        for(std::size_t i = 0; i < inner_length; ++i)
+        {
+            p_dst[dst_offset + i * inner_dst_stride] = p_src[src_offset + i * inner_src_stride];
+        }
+
+        // next index of the outer dimensions
+        std::size_t d = num_dim - 1;
+
+        while(d > 0 && ++idx[d - 1] == lengths[d - 1])
+        {
+            idx[d - 1] = 0;
+            --d;
+        }
+
+        if(d == 0)
+        {
+            return;
+        }
+    }
+}
+
+inline std::vector<std::size_t>
+get_host_tensor_file_strides(const std::vector<std::size_t>& lengths, bool fortran_order)
+{
+    std::vector<std::size_t> strides(lengths.size());
+
+    std::size_t stride = 1;
+
+    for(std::size_t i = 0; i < lengths.size(); ++i)
+    {
+        const std::size_t d = fortran_order ? i : lengths.size() - 1 - i;
+
+        strides[d] = stride;
+        stride *= lengths[d];
+    }
+
+    return strides;
+}
+
+} // namespace detail
+
+// Read-only mapping of a tensor file
+class HostTensorFile
+{
+    public:
+    explicit HostTensorFile(const std::string& path)
+    {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+
+        if(fd < 0)
+        {
+            throw std::runtime_error("wrong! can not open tensor file " + path);
+        }
+
+        struct stat file_stat;
+
+        if(::fstat(fd, &file_stat) != 0)
+        {
+            ::close(fd);
+            throw std::runtime_error("wrong! can not stat tensor file " + path);
+        }
+
+        mapping_size_ = static_cast<std::size_t>(file_stat.st_size);
+
+        if(mapping_size_ > 0)
+        {
+            void* p_mapping = ::mmap(nullptr, mapping_size_, PROT_READ, MAP_PRIVATE, fd, 0);
+
+            p_mapping_ = p_mapping == MAP_FAILED ? nullptr : static_cast<const char*>(p_mapping);
+        }
+
+        ::close(fd);
+
+        if(p_mapping_ == nullptr)
+        {
+            throw std::runtime_error("wrong! can not map tensor file " + path);
+        }
+
+        try
+        {
+            ParseHeader();
+        }
+        catch(...)
+        {
+            ::munmap(const_cast<char*>(p_mapping_), mapping_size_);
+            throw;
+        }
+    }
+
+    HostTensorFile(const HostTensorFile&) = delete;
+    HostTensorFile& operator=(const HostTensorFile&) = delete;
+
+    ~HostTensorFile() { ::munmap(const_cast<char*>(p_mapping_), mapping_size_); }
+
+    const std::string& GetDataType() const { return data_type_; }
+
+    const std::vector<std::size_t>& GetLengths() const { return lengths_; }
+
+    bool IsFortranOrder() const { return fortran_order_; }
+
+    std::vector<std::size_t> GetStrides() const
+    {
+        return detail::get_host_tensor_file_strides(lengths_, fortran_order_);
+    }
+
+    HostTensorDescriptor GetDescriptor() const
+    {
+        return HostTensorDescriptor(lengths_, GetStrides());
+    }
+
+    std::size_t GetElementSize() const
+    {
+        std::size_t size = 1;
+
+        for(std::size_t length : lengths_)
+        {
+            size *= length;
+        }
+
+        return size;
+    }
+
+    // elements in file order, the mapping keeps them 64 byte aligned
+    const void* GetData() const { return p_mapping_ + payload_offset_; }
+
+    std::size_t GetDataBytes() const { return mapping_size_ - payload_offset_; }
+
+    template <typename T>
+    const T* GetDataAs() const
+    {
+        if(data_type_ != get_host_tensor_file_data_type<T>())
+        {
+            throw std::runtime_error("wrong! tensor file holds " + data_type_ + ", not " +
+                                     get_host_tensor_file_data_type<T>());
+        }
+
+        if(GetDataBytes() < GetElementSize() * sizeof(T))
+        {
+            throw std::runtime_error("wrong! tensor file is truncated");
+        }
+
+        return static_cast<const T*>(GetData());
+    }
+
+    private:
+    // value of 'key': in the header dictionary, up to the next ',' outside of parentheses
+    static std::string GetHeaderValue(const std::string& header, const std::string& key)
+    {
+        const std::size_t key_pos = header.find("'" + key + "'");
+
+        if(key_pos == std::string::npos)
+        {
+            throw std::runtime_error("wrong! tensor file header without " + key);
+        }
+
+        std::size_t begin = header.find(':', key_pos);
+        std::size_t end   = begin;
+        int depth         = 0;
+
+        while(++end < header.size() && !(depth == 0 && (header[end] == ',' || header[end] == '}')))
+        {
+            depth += header[end] == '(' ? 1 : header[end] == ')' ? -1 : 0;
+        }
+
+        std::string value = header.substr(begin + 1, end - begin - 1);
+
+        value.erase(0, value.find_first_not_of(" '"));
+        value.erase(value.find_last_not_of(" '") + 1);
+
+        return value;
+    }
+
+    void ParseHeader()
+    {
+        const std::size_t magic_size = sizeof(detail::HostTensorFileMagic) - 1;
+
+        if(mapping_size_ < magic_size + 4 ||
+           std::memcmp(p_mapping_, detail::HostTensorFileMagic, magic_size) != 0)
+        {
+            throw std::runtime_error("wrong! not a tensor file");
+        }
+
+        const auto* p_bytes    = reinterpret_cast<const unsigned char*>(p_mapping_);
+        const int major        = p_bytes[magic_size];
+        std::size_t header_len = 0;
+        std::size_t header_pos = 0;
+
+        if(major == 1)
+        {
+            header_pos = magic_size + 4;
+            header_len = p_bytes[magic_size + 2] | std::size_t{p_bytes[magic_size + 3]} << 8;
+        }
+        else if((major == 2 || major == 3) && mapping_size_ >= magic_size + 6)
+        {
+            header_pos = magic_size + 6;
+
+            for(std::size_t i = 0; i < 4; ++i)
+            {
+                header_len |= std::size_t{p_bytes[magic_size + 2 + i]} << (8 * i);
+            }
+        }
+        else
+        {
+            throw std::runtime_error("wrong! unsupported tensor file version");
+        }
+
+        if(header_pos + header_len > mapping_size_)
+        {
+            throw std::runtime_error("wrong! tensor file is truncated");
+        }
+
+        const std::string header(p_mapping_ + header_pos, header_len);
+
+        data_type_     = GetHeaderValue(header, "descr");
+        fortran_order_ = GetHeaderValue(header, "fortran_order") == "True";
+
+        const std::string shape = GetHeaderValue(header, "shape");
+
+        std::size_t pos = shape.find_first_of("0123456789");
+
+        while(pos != std::string::npos)
+        {
+            std::size_t count = 0;
+
+            lengths_.push_back(std::stoull(shape.substr(pos), &count));
+            pos = shape.find_first_of("0123456789", pos + count);
+        }
+
+        payload_offset_ = header_pos + header_len;
+    }
+
+    const char* p_mapping_      = nullptr;
+    std::size_t mapping_size_   = 0;
+    std::size_t payload_offset_ = 0;
+
+    std::string data_type_;
+    bool fortran_order_ = false;
+    std::vector<std::size_t> lengths_;
+};
+
+// Copies a tensor file into a tensor of the same lengths and any strides
+template <typename T>
+void load_host_tensor(const HostTensorFile& file, Tensor<T>& tensor)
+{
+    if(file.GetLengths() != tensor.mDesc.GetLengths())
+    {
+        throw std::runtime_error("wrong! tensor file lengths do not match the tensor");
+    }
+
+    const T* p_file = file.GetDataAs<T>();
+
+    const auto file_strides = file.GetStrides();
+
+    if(file_strides == tensor.mDesc.GetStrides())
+    {
+        std::memcpy(tensor.mData.data(), p_file, file.GetElementSize() * sizeof(T));
+    }
+    else
+    {
+        detail::copy_host_tensor_elements(tensor.mDesc.GetLengths(),
+                                          p_file,
+                                          file_strides,
+                                          tensor.mData.data(),
+                                          tensor.mDesc.GetStrides());
+    }
+}
+
+// Tensor with the lengths and the element order of a tensor file
+template <typename T>
+Tensor<T> load_host_tensor(const std::string& path)
+{
+    HostTensorFile file(path);
+
+    Tensor<T> tensor(file.GetDescriptor(), TensorUninitialized{});
+
+    load_host_tensor(file, tensor);
+
+    return tensor;
+}
+
+template <typename T>
+void save_host_tensor(const std::string& path, const Tensor<T>& tensor)
+{
+    const auto& lengths = tensor.mDesc.GetLengths();
+    const auto& strides = tensor.mDesc.GetStrides();
+
+    // column major if the strides grow from the first to the last dimension, e.g. a K x N
+    // tensor B stored N x K
+    bool fortran_order = lengths.size() > 1;
+
+    for(std::size_t d = 1; d < lengths.size(); ++d)
+    {
+        fortran_order = fortran_order && strides[d - 1] <= strides[d];
+    }
+
+    std::string header = "{'descr': '" + get_host_tensor_file_data_type<T>() +
+                         "', 'fortran_order': " + (fortran_order ? "True" : "False") +
+                         ", 'shape': (";
+
+    for(std::size_t d = 0; d < lengths.size(); ++d)
+    {
+        header += std::to_string(lengths[d]) + (lengths.size() == 1 ? "," : "") +
+                  (d + 1 < lengths.size() ? ", " : "");
+    }
+
+    header += "), }";
+
+    // magic, version 1.0, header length, header, padding, '\n'
+    const std::size_t magic_size = sizeof(detail::HostTensorFileMagic) - 1;
+    const std::size_t unpadded   = magic_size + 4 + header.size() + 1;
+
+    header.append((detail::HostTensorFileAlignment - unpadded % detail::HostTensorFileAlignment) %
+                      detail::HostTensorFileAlignment,
+                  ' ');
+    header += '\n';
+
+    if(header.size() > 0xffff)
+    {
+        throw std::runtime_error("wrong! tensor file header too long");
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+    if(!file)
+    {
+        throw std::runtime_error("wrong! can not open tensor file " + path);
+    }
+
+    const char version_and_length[4] = {1,
+                                        0,
+                                        static_cast<char>(header.size() & 0xff),
+                                        static_cast<char>(header.size() >> 8)};
+
+    file.write(detail::HostTensorFileMagic, magic_size);
+    file.write(version_and_length, sizeof(version_and_length));
+    file.write(header.data(), header.size());
+
+    const auto file_strides = detail::get_host_tensor_file_strides(lengths, fortran_order);
+
+    const std::size_t element_size = tensor.mDesc.GetElementSize();
+
+    if(file_strides == strides)
+    {
+        file.write(reinterpret_cast<const char*>(tensor.mData.data()), element_size * sizeof(T));
+    }
+    else if(!lengths.empty())
+    {
+        // the outermost dimension of the file order in chunks, so the padding is never written
+        const std::size_t outer_dim    = fortran_order ? lengths.size() - 1 : 0;
+        const std::size_t outer_length = lengths[outer_dim];
+        const std::size_t slice_size   = outer_length == 0 ? 0 : element_size / outer_length;
+        const std::size_t chunk_length = std::max<std::size_t>(
+            1, detail::HostTensorFileChunkBytes / std::max<std::size_t>(1, slice_size * sizeof(T)));
+
+        std::vector<T> chunk;
+
+        for(std::size_t begin = 0; begin < outer_length; begin += chunk_length)
+        {
+            auto chunk_lengths       = lengths;
+            chunk_lengths[outer_dim] = std::min(chunk_length, outer_length - begin);
+
+            chunk.resize(chunk_lengths[outer_dim] * slice_size);
+
+            detail::copy_host_tensor_elements(
+                chunk_lengths,
+                tensor.mData.data() + begin * strides[outer_dim],
+                strides,
+                chunk.data(),
+                detail::get_host_tensor_file_strides(chunk_lengths, fortran_order));
+
+            file.write(reinterpret_cast<const char*>(chunk.data()), chunk.size() * sizeof(T));
+        }
+    }
+
+    if(!file)
+    {
+        throw std::runtime_error("wrong! can not write tensor file " + path);
+    }
+}
+
+} // namespace utils
+} // namespace ck
@@ -0,0 +1,209 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ck {
+namespace utils {
+
+// Process wide pool of host worker threads, started on first use.
+//
+// Host references that run many small jobs back to back, e.g. the groups of a grouped GEMM, share
+// these workers instead of creating and joining hardware_concurrency() threads per job.
+// ParallelFor() hands out task indices through an atomic counter, so a thread that finishes a cheap
+// task picks up the next one immediately. The calling thread works along, and a ParallelFor()
+// issued from inside a task runs serially on the thread that issued it.
+class HostThreadPool
+{
+    public:
+    static HostThreadPool& GetInstance()
+    {
+        static HostThreadPool pool(std::max(1u, std::thread::hardware_concurrency()));
+
+        return pool;
+    }
+
+    explicit HostThreadPool(std::size_t num_thread)
+    {
+        // the calling thread is one of the num_thread
+        for(std::size_t i = 1; i < num_thread; ++i)
+        {
+            workers_.emplace_back([this] { WorkerLoop(); });
+        }
+    }
+
+    HostThreadPool(const HostThreadPool&) = delete;
+    HostThreadPool& operator=(const HostThreadPool&) = delete;
+
+    ~HostThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+
+        wake_.notify_all();
+
+        for(auto& worker : workers_)
+        {
+            worker.join();
+        }
+    }
+
+    std::size_t GetNumThread() const { return workers_.size() + 1; }
+
+    // f(i) for i in [0, num_task), rethrows the first exception a task threw
+    template <typename F>
+    void ParallelFor(std::size_t num_task, F&& f)
+    {
+        if(num_task == 0)
+        {
+            return;
+        }
+
+        if(num_task == 1 || workers_.empty() || InsideTask())
+        {
+            for(std::size_t i = 0; i < num_task; ++i)
+            {
+                f(i);
+            }
+
+            return;
+        }
+
+        // one job at a time, the workers share its counter
+        std::lock_guard<std::mutex> job_lock(job_mutex_);
+
+        Job job;
+        job.task_     = [&f](std::size_t i) { f(i); };
+        job.num_task_ = num_task;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            job_ = &job;
+            ++generation_;
+        }
+
+        wake_.notify_all();
+
+        RunTasks(job);
+
+        // wait for the workers still inside the job
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [&] { return job.num_active_ == 0; });
+        job_ = nullptr;
+        lock.unlock();
+
+        if(job.exception_)
+        {
+            std::rethrow_exception(job.exception_);
+        }
+    }
+
+    private:
+    struct Job
+    {
+        std::function<void(std::size_t)> task_;
+        std::size_t num_task_ = 0;
+        std::atomic<std::size_t> next_task_{0};
+        // workers that joined the job and did not leave it yet, guarded by mutex_
+        std::size_t num_active_ = 0;
+        std::exception_ptr exception_;
+        std::mutex exception_mutex_;
+    };
+
+    static bool& InsideTask()
+    {
+        static thread_local bool inside = false;
+
+        return inside;
+    }
+
+    void RunTasks(Job& job)
+    {
+        InsideTask() = true;
+
+        for(std::size_t i = job.next_task_++; i < job.num_task_; i = job.next_task_++)
+        {
+            try
+            {
+                job.task_(i);
+            }
+            catch(...)
+            {
+                std::lock_guard<std::mutex> lock(job.exception_mutex_);
+
+                if(!job.exception_)
+                {
+                    job.exception_ = std::current_exception();
+                }
+
+                // skip the remaining tasks
+                job.next_task_ = job.num_task_;
+            }
+        }
+
+        InsideTask() = false;
+    }
+
+    void WorkerLoop()
+    {
+        std::size_t seen_generation = 0;
+
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        while(true)
+        {
+            wake_.wait(lock, [&] { return stop_ || generation_ != seen_generation; });
+
+            if(stop_)
+            {
+                return;
+            }
+
+            seen_generation = generation_;
+
+            // the job may be over already
+            if(job_ == nullptr)
+            {
+                continue;
+            }
+
+            Job& job = *job_;
+            ++job.num_active_;
+            lock.unlock();
+
+            RunTasks(job);
+
+            lock.lock();
+
+            if(--job.num_active_ == 0)
+            {
+                done_.notify_all();
+            }
+        }
+    }
+
+    std::vector<std::thread> workers_;
+
+    std::mutex job_mutex_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    Job* job_               = nullptr;
+    std::size_t generation_ = 0;
+    bool stop_              = false;
+};
+
+} // namespace utils
+} // namespace ck
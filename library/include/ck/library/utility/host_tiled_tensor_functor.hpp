@@ -0,0 +1,334 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "ck/library/utility/host_tensor.hpp"
+
+// Order in which TiledParallelTensorFunctor visits the tiles of the curve dimensions
+enum struct HostTileOrder
+{
+    RowMajor,
+    Morton,
+    Hilbert,
+};
+
+// Drop-in alternative to ParallelTensorFunctor for host references with strided operands.
+//
+// The index space is split into tiles of mTileLens. The two innermost dimensions that are tiled
+// (tile length > 1, by default the last two dimensions) are ordered along a Morton or Hilbert
+// curve, all other dimensions are visited row-major on the outside, and elements inside a tile are
+// visited row-major. Every thread gets a contiguous run of tiles along the curve, so consecutive tiles of
+// one thread share most of the rows/columns of the operands they read, e.g. the B columns of a NN
+// GEMM, instead of streaming the whole operand for every output row. If there are fewer tiles
+// than threads, e.g. for a small output with a long reduction per element, the longest tile
+// dimension is halved until every thread gets a tile or the tiles are single elements.
+template <typename F, typename... Xs>
+struct TiledParallelTensorFunctor
+{
+    F mF;
+    static constexpr std::size_t NDIM = sizeof...(Xs);
+    std::array<std::size_t, NDIM> mLens;
+    std::array<std::size_t, NDIM> mTileLens;
+    HostTileOrder mOrder;
+
+    TiledParallelTensorFunctor(F f, Xs... xs)
+        : mF(f), mLens({static_cast<std::size_t>(xs)...}), mOrder(HostTileOrder::Hilbert)
+    {
+        mTileLens.fill(1);
+
+        for(std::size_t idim = NDIM - std::min<std::size_t>(NDIM, 2); idim < NDIM; ++idim)
+        {
+            mTileLens[idim] = 32;
+        }
+    }
+
+    TiledParallelTensorFunctor& SetTileLengths(const std::array<std::size_t, NDIM>& tile_lens)
+    {
+        for(std::size_t idim = 0; idim < NDIM; ++idim)
+        {
+            mTileLens[idim] = std::max<std::size_t>(tile_lens[idim], 1);
+        }
+
+        return *this;
+    }
+
+    TiledParallelTensorFunctor& SetTileOrder(HostTileOrder order)
+    {
+        mOrder = order;
+
+        return *this;
+    }
+
+    std::array<std::size_t, NDIM> GetNumTiles() const
+    {
+        std::array<std::size_t, NDIM> num_tiles;
+
+        for(std::size_t idim = 0; idim < NDIM; ++idim)
+        {
+            num_tiles[idim] = (mLens[idim] + mTileLens[idim] - 1) / mTileLens[idim];
+        }
+
+        return num_tiles;
+    }
+
+    // tile lengths that give at least num_thread tiles, if there are that many elements
+    std::array<std::size_t, NDIM> GetTileLengths(std::size_t num_thread) const
+    {
+        auto tile_lens = mTileLens;
+
+        for(std::size_t idim = 0; idim < NDIM; ++idim)
+        {
+            tile_lens[idim] = std::min(tile_lens[idim], std::max<std::size_t>(mLens[idim], 1));
+        }
+
+        while(true)
+        {
+            std::size_t num_tile_total = 1;
+            std::size_t longest_dim    = 0;
+
+            for(std::size_t idim = 0; idim < NDIM; ++idim)
+            {
+                num_tile_total *= (mLens[idim] + tile_lens[idim] - 1) / tile_lens[idim];
+
+                if(tile_lens[idim] > tile_lens[longest_dim])
+                {
+                    longest_dim = idim;
+                }
+            }
+
+            if(num_tile_total >= num_thread || tile_lens[longest_dim] == 1)
+            {
+                return tile_lens;
+            }
+
+            tile_lens[longest_dim] = (tile_lens[longest_dim] + 1) / 2;
+        }
+    }
+
+    static uint64_t MortonKey(uint64_t x, uint64_t y)
+    {
+        auto spread = [](uint64_t v) {
+            v &= 0xffffffff;
+            v = (v | (v << 16)) & 0x0000ffff0000ffff;
+            v = (v | (v << 8)) & 0x00ff00ff00ff00ff;
+            v = (v | (v << 4)) & 0x0f0f0f0f0f0f0f0f;
+            v = (v | (v << 2)) & 0x3333333333333333;
+            v = (v | (v << 1)) & 0x5555555555555555;
+            return v;
+        };
+
+        return (spread(x) << 1) | spread(y);
+    }
+
+    // distance of (x, y) along the Hilbert curve filling a n x n square, n a power of two
+    static uint64_t HilbertKey(uint64_t n, uint64_t x, uint64_t y)
+    {
+        uint64_t d = 0;
+
+        for(uint64_t s = n / 2; s > 0; s /= 2)
+        {
+            const uint64_t rx = (x & s) > 0;
+            const uint64_t ry = (y & s) > 0;
+
+            d += s * s * ((3 * rx) ^ ry);
+
+            // rotate the quadrant
+            if(ry == 0)
+            {
+                if(rx == 1)
+                {
+                    x = s - 1 - x;
+                    y = s - 1 - y;
+                }
+
+                std::swap(x, y);
+            }
+        }
+
+        return d;
+    }
+
+    // multi-dimensional tile indices in visiting order
+    std::vector<std::array<std::size_t, NDIM>> GetTileOrder() const
+    {
+        const auto num_tiles = GetNumTiles();
+
+        const std::size_t num_tile_total = std::accumulate(
+            num_tiles.begin(), num_tiles.end(), std::size_t{1}, std::multiplies<std::size_t>());
+
+        // innermost two tiled dimensions form the curve
+        std::array<std::size_t, 2> curve_dims{NDIM, NDIM};
+        std::size_t num_curve_dim = 0;
+
+        for(std::size_t idim = NDIM; idim > 0 && num_curve_dim < 2; --idim)
+        {
+            if(mTileLens[idim - 1] > 1)
+            {
+                curve_dims[1 - num_curve_dim++] = idim - 1;
+            }
+        }
+
+        std::size_t curve_size = 1;
+
+        for(std::size_t i = 0; i < 2; ++i)
+        {
+            if(curve_dims[i] < NDIM)
+            {
+                while(curve_size < num_tiles[curve_dims[i]])
+                {
+                    curve_size *= 2;
+                }
+            }
+        }
+
+        struct KeyedTile
+        {
+            std::size_t outer_;
+            uint64_t key_;
+            std::array<std::size_t, NDIM> tile_;
+        };
+
+        std::vector<KeyedTile> tiles(num_tile_total);
+
+        for(std::size_t i = 0; i < num_tile_total; ++i)
+        {
+            auto& t = tiles[i];
+
+            std::size_t r = i;
+
+            for(std::size_t idim = NDIM; idim > 0; --idim)
+            {
+                t.tile_[idim - 1] = r % num_tiles[idim - 1];
+                r /= num_tiles[idim - 1];
+            }
+
+            // row-major position among the non-curve dimensions
+            t.outer_ = 0;
+
+            for(std::size_t idim = 0; idim < NDIM; ++idim)
+            {
+                if(idim != curve_dims[0] && idim != curve_dims[1])
+                {
+                    t.outer_ = t.outer_ * num_tiles[idim] + t.tile_[idim];
+                }
+            }
+
+            const uint64_t x = curve_dims[0] < NDIM ? t.tile_[curve_dims[0]] : 0;
+            const uint64_t y = curve_dims[1] < NDIM ? t.tile_[curve_dims[1]] : 0;
+
+            // a single curve dimension is already ordered
+            switch(num_curve_dim == 2 ? mOrder : HostTileOrder::RowMajor)
+            {
+            case HostTileOrder::Morton: t.key_ = MortonKey(x, y); break;
+            case HostTileOrder::Hilbert: t.key_ = HilbertKey(curve_size, x, y); break;
+            default: t.key_ = y; break;
+            }
+        }
+
+        if(mOrder != HostTileOrder::RowMajor)
+        {
+            std::stable_sort(
+                tiles.begin(), tiles.end(), [](const KeyedTile& a, const KeyedTile& b) {
+                    return a.outer_ < b.outer_ || (a.outer_ == b.outer_ && a.key_ < b.key_);
+                });
+        }
+
+        std::vector<std::array<std::size_t, NDIM>> order(num_tile_total);
+
+        std::transform(tiles.begin(), tiles.end(), order.begin(), [](const KeyedTile& t) {
+            return t.tile_;
+        });
+
+        return order;
+    }
+
+    void RunTile(const std::array<std::size_t, NDIM>& tile) const
+    {
+        std::array<std::size_t, NDIM> begin;
+        std::array<std::size_t, NDIM> end;
+
+        for(std::size_t idim = 0; idim < NDIM; ++idim)
+        {
+            begin[idim] = tile[idim] * mTileLens[idim];
+            end[idim]   = std::min(begin[idim] + mTileLens[idim], mLens[idim]);
+        }
+
+        auto idx = begin;
+
+        while(true)
+        {
+            call_f_unpack_args(mF, idx);
+
+            // row-major increment within the tile
+            std::size_t idim = NDIM;
+
+            while(idim > 0)
+            {
+                --idim;
+
+                if(++idx[idim] < end[idim])
+                {
+                    break;
+                }
+
+                idx[idim] = begin[idim];
+
+                if(idim == 0)
+                {
+                    return;
+                }
+            }
+        }
+    }
+
+    void operator()(std::size_t num_thread = 1) const
+    {
+        for(std::size_t idim = 0; idim < NDIM; ++idim)
+        {
+            if(mLens[idim] == 0)
+            {
+                return;
+            }
+        }
+
+        auto functor = *this;
+
+        functor.mTileLens = GetTileLengths(num_thread);
+
+        const auto tiles = functor.GetTileOrder();
+
+        num_thread = std::max<std::size_t>(1, std::min(num_thread, tiles.size()));
+
+        std::size_t work_per_thread = (tiles.size() + num_thread - 1) / num_thread;
+
+        std::vector<joinable_thread> threads(num_thread);
+
+        for(std::size_t it = 0; it < num_thread; ++it)
+        {
+            std::size_t iw_begin = std::min(it * work_per_thread, tiles.size());
+            std::size_t iw_end   = std::min((it + 1) * work_per_thread, tiles.size());
+
+            auto f = [=, &functor, &tiles] {
+                for(std::size_t iw = iw_begin; iw < iw_end; ++iw)
+                {
+                    functor.RunTile(tiles[iw]);
+                }
+            };
+            threads[it] = joinable_thread(f);
+        }
+    }
+};
+
+template <typename F, typename... Xs>
+auto make_TiledParallelTensorFunctor(F f, Xs... xs)
+{
+    return TiledParallelTensorFunctor<F, Xs...>(f, xs...);
+}
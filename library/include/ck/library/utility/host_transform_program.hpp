@@ -0,0 +1,1023 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/utility/magic_division.hpp"
+#include "ck/tensor_description/multi_index_transform.hpp"
+#include "ck/tensor_description/tensor_descriptor.hpp"
+#include "ck/tensor_description/tensor_adaptor.hpp"
+
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace utils {
+
+// Host-side evaluation of tensor descriptor / tensor adaptor transform chains.
+//
+// make_host_transform_program() flattens the compile-time transform chain of a runtime
+// TensorDescriptor or TensorAdaptor into a small program over integer registers (one register per
+// hidden dimension). Each transformation becomes one instruction with its runtime parameters
+// baked in, divisions of Merge are strength-reduced to magic-number multiplications, and the
+// program is analysed for the part that is affine in the innermost top dimension, so that whole
+// rows of offsets can be produced with a single multiply-add per element.
+//
+// Offsets that map into padding (IsValidUpperIndexMappedToValidLowerIndex() is false for one of
+// the transformations) are reported as HostTransformProgram::InvalidOffset.
+
+enum struct HostTransformOpCode
+{
+    Move,     // low = up + constant: PassThrough, Pad, LeftPad, RightPad, Slice
+    Linear,   // low = sum(up[i] * coefficient[i]): Embed, UnMerge, Vectorize
+    Merge,    // low[i] = up / scan(low_lengths)[i] % low_lengths[i]: all Merge variants
+    Modulo,   // low = up % constant
+    Constant, // low = constant: Freeze
+    Generic,  // any other transformation, evaluated through CalculateLowerIndex()
+};
+
+struct HostMagicDivisor
+{
+    HostMagicDivisor() = default;
+
+    // dividends are known to lie in [0, max_dividend]
+    HostMagicDivisor(long_index_t divisor, long_index_t max_dividend) : divisor_{divisor}
+    {
+        use_magic_ = divisor >= 1 && divisor <= INT32_MAX && max_dividend >= 0 &&
+                     max_dividend <= INT32_MAX;
+
+        if(use_magic_)
+        {
+            const auto magic = MagicDivision::CalculateMagicNumbers(static_cast<uint32_t>(divisor));
+
+            multiplier_ = magic[Number<0>{}];
+            shift_      = magic[Number<1>{}];
+        }
+    }
+
+    long_index_t Div(long_index_t dividend) const
+    {
+        if(use_magic_)
+        {
+            return MagicDivision::DoMagicDivision(
+                static_cast<uint32_t>(dividend), multiplier_, shift_);
+        }
+
+        return dividend / divisor_;
+    }
+
+    long_index_t divisor_ = 1;
+    uint32_t multiplier_  = 0;
+    uint32_t shift_       = 0;
+    bool use_magic_       = false;
+};
+
+struct HostTransformOp
+{
+    HostTransformOpCode code_;
+
+    index_t num_up_;
+    index_t num_low_;
+
+    // registers: operands_[operand_begin_, +num_up_) are upper, the following num_low_ are lower
+    index_t operand_begin_;
+
+    // Move/Modulo/Constant: constants_[constant_begin_]
+    // Linear: constants_[constant_begin_, +num_up_)
+    // Merge: divisors_[constant_begin_, +num_low_ - 1) for low dimensions 1 ... num_low_ - 1
+    // Generic: generics_[constant_begin_]
+    index_t constant_begin_;
+
+    // validity of the upper index: up[0] in [valid_begin_, valid_end_) for 1-d transformations,
+    // or through the generic validity check
+    bool check_valid_;
+    long_index_t valid_begin_;
+    long_index_t valid_end_;
+
+    // whether any upper register depends on the innermost top dimension
+    bool row_dependent_;
+};
+
+struct HostTransformProgram
+{
+    static constexpr long_index_t InvalidOffset = -1;
+
+    using GenericLowerIndexFunction = std::function<void(const long_index_t*, long_index_t*)>;
+    using GenericValidityFunction   = std::function<bool(const long_index_t*)>;
+
+    struct Generic
+    {
+        GenericLowerIndexFunction calculate_lower_index_;
+        GenericValidityFunction is_valid_;
+    };
+
+    index_t GetNumOfTopDimension() const { return static_cast<index_t>(top_registers_.size()); }
+
+    index_t GetNumOfBottomDimension() const
+    {
+        return static_cast<index_t>(bottom_registers_.size());
+    }
+
+    const std::vector<long_index_t>& GetTopLengths() const { return top_lengths_; }
+
+    std::size_t GetTopElementSize() const
+    {
+        return std::accumulate(top_lengths_.begin(),
+                               top_lengths_.end(),
+                               std::size_t{1},
+                               std::multiplies<std::size_t>{});
+    }
+
+    // the offset is an affine function of the innermost top index and every padding check along
+    // the innermost dimension can be solved in closed form
+    bool IsRowAffine() const { return row_affine_; }
+
+    // Evaluate a single top index into bottom, returns false if the index maps into padding.
+    // registers must hold at least GetNumOfRegister() elements.
+    bool Run(const long_index_t* top, long_index_t* bottom, long_index_t* registers) const
+    {
+        for(index_t i = 0; i < GetNumOfTopDimension(); ++i)
+        {
+            registers[top_registers_[i]] = top[i];
+        }
+
+        bool valid = true;
+
+        for(const auto& op : ops_)
+        {
+            valid &= RunOp(op, registers);
+        }
+
+        for(index_t i = 0; i < GetNumOfBottomDimension(); ++i)
+        {
+            bottom[i] = registers[bottom_registers_[i]];
+        }
+
+        return valid;
+    }
+
+    // offset of a top index for programs with a single bottom dimension (tensor descriptors)
+    long_index_t CalculateOffset(const std::vector<long_index_t>& top) const
+    {
+        CheckSingleBottomDimension();
+
+        std::vector<long_index_t> registers(num_register_);
+
+        long_index_t offset;
+
+        return Run(top.data(), &offset, registers.data()) ? offset : InvalidOffset;
+    }
+
+    // Offsets of top index {top_outer..., begin + i} for i in [0, count). The top index of the
+    // innermost dimension passed in is ignored.
+    void CalculateRowOffsets(const long_index_t* top,
+                             long_index_t begin,
+                             long_index_t count,
+                             long_index_t* offsets,
+                             long_index_t* registers) const
+    {
+        if(count <= 0)
+        {
+            return;
+        }
+
+        const index_t inner = GetNumOfTopDimension() - 1;
+
+        for(index_t i = 0; i < GetNumOfTopDimension(); ++i)
+        {
+            registers[top_registers_[i]] = top[i];
+        }
+
+        registers[top_registers_[inner]] = begin;
+
+        // run everything once; this is the complete result for the first element and the row
+        // invariant part for all others
+        bool row_invariant_valid = true;
+        bool first_valid         = true;
+
+        for(const auto& op : ops_)
+        {
+            const bool valid = RunOp(op, registers);
+
+            first_valid &= valid;
+
+            if(!op.row_dependent_)
+            {
+                row_invariant_valid &= valid;
+            }
+        }
+
+        if(!row_invariant_valid)
+        {
+            std::fill(offsets, offsets + count, InvalidOffset);
+            return;
+        }
+
+        const long_index_t base = registers[bottom_registers_[0]];
+
+        if(row_affine_)
+        {
+            // [i_begin, i_end) is the part of the row that is not in padding
+            long_index_t i_begin = 0;
+            long_index_t i_end   = count;
+
+            for(const auto& check : row_checks_)
+            {
+                ClipAffineRange(registers[check.register_],
+                                check.coefficient_,
+                                check.valid_begin_,
+                                check.valid_end_,
+                                i_begin,
+                                i_end);
+            }
+
+            for(long_index_t i = 0; i < count; ++i)
+            {
+                offsets[i] =
+                    (i >= i_begin && i < i_end) ? base + i * row_coefficient_ : InvalidOffset;
+            }
+
+            return;
+        }
+
+        offsets[0] = first_valid ? base : InvalidOffset;
+
+        for(long_index_t i = 1; i < count; ++i)
+        {
+            registers[top_registers_[inner]] = begin + i;
+
+            bool valid = true;
+
+            for(const auto& op_id : row_ops_)
+            {
+                valid &= RunOp(ops_[op_id], registers);
+            }
+
+            offsets[i] = valid ? registers[bottom_registers_[0]] : InvalidOffset;
+        }
+    }
+
+    // Offsets of the whole top index space in row-major order
+    std::vector<long_index_t> CalculateOffsets(std::size_t num_thread = 1) const
+    {
+        CheckSingleBottomDimension();
+
+        std::vector<long_index_t> offsets(GetTopElementSize());
+
+        if(offsets.empty())
+        {
+            return offsets;
+        }
+
+        const index_t ndim          = GetNumOfTopDimension();
+        const long_index_t row_size = top_lengths_[ndim - 1];
+        const std::size_t num_row   = offsets.size() / row_size;
+
+        num_thread = std::max<std::size_t>(1, std::min(num_thread, num_row));
+
+        const std::size_t row_per_thread = (num_row + num_thread - 1) / num_thread;
+
+        auto f = [&](std::size_t row_begin, std::size_t row_end) {
+            std::vector<long_index_t> top(ndim, 0);
+            std::vector<long_index_t> registers(num_register_);
+
+            for(std::size_t row = row_begin; row < row_end; ++row)
+            {
+                // decompose row into the outer top dimensions
+                std::size_t r = row;
+
+                for(index_t i = ndim - 2; i >= 0; --i)
+                {
+                    top[i] = static_cast<long_index_t>(r % top_lengths_[i]);
+                    r /= top_lengths_[i];
+                }
+
+                CalculateRowOffsets(top.data(),
+                                    0,
+                                    row_size,
+                                    offsets.data() + row * row_size,
+                                    registers.data());
+            }
+        };
+
+        std::vector<joinable_thread> threads(num_thread);
+
+        for(std::size_t it = 0; it < num_thread; ++it)
+        {
+            const std::size_t row_begin = std::min(it * row_per_thread, num_row);
+            const std::size_t row_end   = std::min(row_begin + row_per_thread, num_row);
+
+            threads[it] = joinable_thread(f, row_begin, row_end);
+        }
+
+        return offsets;
+    }
+
+    index_t GetNumOfRegister() const { return num_register_; }
+
+    // the register (hidden dimension) of an affine padding check along the innermost dimension
+    struct RowCheck
+    {
+        index_t register_;
+        long_index_t coefficient_;
+        long_index_t valid_begin_;
+        long_index_t valid_end_;
+    };
+
+    index_t num_register_ = 0;
+
+    std::vector<index_t> top_registers_;
+    std::vector<index_t> bottom_registers_;
+    std::vector<long_index_t> top_lengths_;
+
+    std::vector<HostTransformOp> ops_;
+    std::vector<index_t> operands_;
+    std::vector<long_index_t> constants_;
+    std::vector<HostMagicDivisor> divisors_;
+    std::vector<Generic> generics_;
+
+    // ops to re-run when only the innermost top index changes
+    std::vector<index_t> row_ops_;
+
+    bool row_affine_              = false;
+    long_index_t row_coefficient_ = 0;
+    std::vector<RowCheck> row_checks_;
+
+    private:
+    void CheckSingleBottomDimension() const
+    {
+        if(GetNumOfBottomDimension() != 1)
+        {
+            throw std::runtime_error("wrong! offset requires a single bottom dimension");
+        }
+    }
+
+    bool RunOp(const HostTransformOp& op, long_index_t* registers) const
+    {
+        const index_t* up  = operands_.data() + op.operand_begin_;
+        const index_t* low = up + op.num_up_;
+
+        const long_index_t* c = constants_.data() + op.constant_begin_;
+
+        switch(op.code_)
+        {
+        case HostTransformOpCode::Move: registers[low[0]] = registers[up[0]] + c[0]; break;
+        case HostTransformOpCode::Linear: {
+            long_index_t sum = 0;
+
+            for(index_t i = 0; i < op.num_up_; ++i)
+            {
+                sum += registers[up[i]] * c[i];
+            }
+
+            registers[low[0]] = sum;
+            break;
+        }
+        case HostTransformOpCode::Merge: {
+            const HostMagicDivisor* divisors = divisors_.data() + op.constant_begin_;
+
+            long_index_t q = registers[up[0]];
+
+            for(index_t i = op.num_low_ - 1; i > 0; --i)
+            {
+                const long_index_t q_next = divisors[i - 1].Div(q);
+
+                registers[low[i]] = q - q_next * divisors[i - 1].divisor_;
+                q                 = q_next;
+            }
+
+            registers[low[0]] = q;
+            break;
+        }
+        case HostTransformOpCode::Modulo: registers[low[0]] = registers[up[0]] % c[0]; break;
+        case HostTransformOpCode::Constant: registers[low[0]] = c[0]; break;
+        case HostTransformOpCode::Generic: {
+            const auto& generic = generics_[op.constant_begin_];
+
+            long_index_t up_values[8];
+            long_index_t low_values[8];
+
+            for(index_t i = 0; i < op.num_up_; ++i)
+            {
+                up_values[i] = registers[up[i]];
+            }
+
+            generic.calculate_lower_index_(up_values, low_values);
+
+            for(index_t i = 0; i < op.num_low_; ++i)
+            {
+                registers[low[i]] = low_values[i];
+            }
+
+            return !op.check_valid_ || generic.is_valid_(up_values);
+        }
+        }
+
+        if(op.check_valid_)
+        {
+            const long_index_t v = registers[up[0]];
+
+            return v >= op.valid_begin_ && v < op.valid_end_;
+        }
+
+        return true;
+    }
+
+    static long_index_t FloorDiv(long_index_t a, long_index_t b)
+    {
+        const long_index_t q = a / b;
+
+        return (a % b != 0 && ((a < 0) != (b < 0))) ? q - 1 : q;
+    }
+
+    static long_index_t CeilDiv(long_index_t a, long_index_t b) { return -FloorDiv(-a, b); }
+
+    // restrict [i_begin, i_end) to the i for which v0 + c * i lies in [lo, hi)
+    static void ClipAffineRange(long_index_t v0,
+                                long_index_t c,
+                                long_index_t lo,
+                                long_index_t hi,
+                                long_index_t& i_begin,
+                                long_index_t& i_end)
+    {
+        if(c == 0)
+        {
+            if(v0 < lo || v0 >= hi)
+            {
+                i_end = i_begin;
+            }
+        }
+        else if(c > 0)
+        {
+            if(lo != std::numeric_limits<long_index_t>::lowest())
+                i_begin = std::max(i_begin, CeilDiv(lo - v0, c));
+            if(hi != std::numeric_limits<long_index_t>::max())
+                i_end = std::min(i_end, CeilDiv(hi - v0, c));
+        }
+        else
+        {
+            if(hi != std::numeric_limits<long_index_t>::max())
+                i_begin = std::max(i_begin, CeilDiv(v0 - hi + 1, -c));
+            if(lo != std::numeric_limits<long_index_t>::lowest())
+                i_end = std::min(i_end, FloorDiv(v0 - lo, -c) + 1);
+        }
+
+        i_end = std::max(i_end, i_begin);
+    }
+};
+
+namespace detail {
+
+struct HostTransformProgramBuilder
+{
+    HostTransformProgram& program_;
+
+    // upper bound of every register value, used to decide on magic division
+    std::vector<long_index_t>& max_values_;
+
+    template <typename UpIds, typename LowIds>
+    HostTransformOp MakeOp(HostTransformOpCode code, UpIds, LowIds)
+    {
+        HostTransformOp op{};
+
+        op.code_           = code;
+        op.num_up_         = UpIds::Size();
+        op.num_low_        = LowIds::Size();
+        op.operand_begin_  = static_cast<index_t>(program_.operands_.size());
+        op.constant_begin_ = static_cast<index_t>(program_.constants_.size());
+        op.check_valid_    = false;
+        op.valid_begin_    = 0;
+        op.valid_end_      = 0;
+        op.row_dependent_  = false;
+
+        static_for<0, UpIds::Size(), 1>{}(
+            [&](auto i) { program_.operands_.push_back(UpIds::At(i)); });
+        static_for<0, LowIds::Size(), 1>{}(
+            [&](auto i) { program_.operands_.push_back(LowIds::At(i)); });
+
+        return op;
+    }
+
+    long_index_t MaxValue(index_t reg) const { return max_values_[reg]; }
+
+    void SetMaxValue(index_t reg, long_index_t v) { max_values_[reg] = v; }
+
+    // bounds saturate instead of overflowing, a saturated bound simply disables magic division
+    static long_index_t SaturatedAdd(long_index_t a, long_index_t b)
+    {
+        long_index_t r;
+
+        return __builtin_add_overflow(a, b, &r) ? std::numeric_limits<long_index_t>::max() : r;
+    }
+
+    static long_index_t SaturatedMul(long_index_t a, long_index_t b)
+    {
+        long_index_t r;
+
+        return __builtin_mul_overflow(a, b, &r) ? std::numeric_limits<long_index_t>::max() : r;
+    }
+
+    void Push(const HostTransformOp& op) { program_.ops_.push_back(op); }
+};
+
+// transformations whose lower index is the upper index shifted by a constant
+template <typename UpIds, typename LowIds>
+void emit_move(HostTransformProgramBuilder& b,
+               UpIds up,
+               LowIds low,
+               long_index_t shift,
+               bool check_valid,
+               long_index_t valid_begin,
+               long_index_t valid_end)
+{
+    auto op = b.MakeOp(HostTransformOpCode::Move, up, low);
+
+    b.program_.constants_.push_back(shift);
+
+    op.check_valid_ = check_valid;
+    op.valid_begin_ = valid_begin;
+    op.valid_end_   = valid_end;
+
+    b.SetMaxValue(LowIds::At(Number<0>{}),
+                  b.SaturatedAdd(b.MaxValue(UpIds::At(Number<0>{})), shift));
+    b.Push(op);
+}
+
+template <typename UpIds, typename LowIds, typename Coefficients>
+void emit_linear(HostTransformProgramBuilder& b,
+                 UpIds up,
+                 LowIds low,
+                 const Coefficients& coefficients)
+{
+    auto op = b.MakeOp(HostTransformOpCode::Linear, up, low);
+
+    long_index_t max_value = 0;
+
+    static_for<0, UpIds::Size(), 1>{}([&](auto i) {
+        const long_index_t c = coefficients[i];
+
+        b.program_.constants_.push_back(c);
+
+        max_value = b.SaturatedAdd(max_value, b.SaturatedMul(b.MaxValue(UpIds::At(i)), c < 0 ? -c : c));
+    });
+
+    b.SetMaxValue(LowIds::At(Number<0>{}), max_value);
+    b.Push(op);
+}
+
+template <typename LowLength, typename UpIds, typename LowIds>
+void emit(HostTransformProgramBuilder& b, const PassThrough<LowLength>&, UpIds up, LowIds low)
+{
+    emit_move(b, up, low, 0, false, 0, 0);
+}
+
+template <typename LowLength,
+          typename LeftPadLength,
+          typename RightPadLength,
+          bool SkipIsValidCheck,
+          typename UpIds,
+          typename LowIds>
+void emit(HostTransformProgramBuilder& b,
+          const Pad<LowLength, LeftPadLength, RightPadLength, SkipIsValidCheck>& t,
+          UpIds up,
+          LowIds low)
+{
+    const long_index_t left  = t.left_pad_length_;
+    const long_index_t right = t.right_pad_length_;
+    const long_index_t len   = t.up_lengths_[Number<0>{}];
+
+    emit_move(b, up, low, -left, !SkipIsValidCheck, left, len - right);
+}
+
+template <typename LowLength,
+          typename LeftPadLength,
+          bool SkipIsValidCheck,
+          typename UpIds,
+          typename LowIds>
+void emit(HostTransformProgramBuilder& b,
+          const LeftPad<LowLength, LeftPadLength, SkipIsValidCheck>& t,
+          UpIds up,
+          LowIds low)
+{
+    const long_index_t left = t.left_pad_length_;
+
+    emit_move(b, up, low, -left, !SkipIsValidCheck, left, std::numeric_limits<long_index_t>::max());
+}
+
+template <typename LowLength,
+          typename RightPadLength,
+          bool SkipIsValidCheck,
+          typename UpIds,
+          typename LowIds>
+void emit(HostTransformProgramBuilder& b,
+          const RightPad<LowLength, RightPadLength, SkipIsValidCheck>& t,
+          UpIds up,
+          LowIds low)
+{
+    const long_index_t low_length = t.low_length_;
+
+    emit_move(b, up, low, 0, !SkipIsValidCheck, std::numeric_limits<long_index_t>::lowest(), low_length);
+}
+
+template <typename LowLength, typename SliceBegin, typename SliceEnd, typename UpIds, typename LowIds>
+void emit(HostTransformProgramBuilder& b,
+          const Slice<LowLength, SliceBegin, SliceEnd>& t,
+          UpIds up,
+          LowIds low)
+{
+    emit_move(b, up, low, static_cast<long_index_t>(t.slice_begin_), false, 0, 0);
+}
+
+template <typename UpLengths, typename Coefficients, bool B, typename UpIds, typename LowIds>
+void emit(HostTransformProgramBuilder& b,
+          const Embed<UpLengths, Coefficients, B>& t,
+          UpIds up,
+          LowIds low)
+{
+    emit_linear(b, up, low, t.coefficients_);
+}
+
+template <typename UpLengths, bool Use24BitIntegerCalculation, typename UpIds, typename LowIds>
+void emit(HostTransformProgramBuilder& b,
+          const UnMerge<UpLengths, Use24BitIntegerCalculation>& t,
+          UpIds up,
+          LowIds low)
+{
+    emit_linear(b, up, low, t.up_lengths_scan_);
+}
+
+template <typename VectorSize, typename UpLength, typename UpIds, typename LowIds>
+void emit(HostTransformProgramBuilder& b,
+          const Vectorize<VectorSize, UpLength>& t,
+          UpIds up,
+          LowIds low)
+{
+    emit_linear(b, up, low, make_tuple(t.vector_size_));
+}
+
+template <typename LowerIndex, typename UpIds, typename LowIds>
+void emit(HostTransformProgramBuilder& b, const Freeze<LowerIndex>& t, UpIds up, LowIds low)
+{
+    auto op = b.MakeOp(HostTransformOpCode::Constant, up, low);
+
+    const long_index_t value = t.low_idx_;
+
+    b.program_.constants_.push_back(value);
+    b.SetMaxValue(LowIds::At(Number<0>{}), value);
+    b.Push(op);
+}
+
+template <typename UpperLength, typename UpIds, typename LowIds>
+void emit(HostTransformProgramBuilder&, const Insert<UpperLength>&, UpIds, LowIds)
+{
+    // no lower dimension
+}
+
+template <typename Modulus, typename UpLength, typename UpIds, typename LowIds>
+void emit(HostTransformProgramBuilder& b, const Modulo<Modulus, UpLength>& t, UpIds up, LowIds low)
+{
+    auto op = b.MakeOp(HostTransformOpCode::Modulo, up, low);
+
+    const long_index_t modulus = t.modulus_;
+
+    b.program_.constants_.push_back(modulus);
+    b.SetMaxValue(LowIds::At(Number<0>{}), modulus - 1);
+    b.Push(op);
+}
+
+template <typename MergeTransform, typename UpIds, typename LowIds>
+void emit_merge(HostTransformProgramBuilder& b, const MergeTransform& t, UpIds up, LowIds low)
+{
+    auto op = b.MakeOp(HostTransformOpCode::Merge, up, low);
+
+    op.constant_begin_ = static_cast<index_t>(b.program_.divisors_.size());
+
+    constexpr index_t NDimLow = LowIds::Size();
+
+    // dividend of the division by low_lengths[i] is bounded by up / prod(low_lengths[i+1:])
+    std::array<long_index_t, NDimLow> max_dividends;
+
+    long_index_t max_dividend = b.MaxValue(UpIds::At(Number<0>{}));
+
+    static_for<NDimLow - 1, 0, -1>{}([&](auto i) {
+        const long_index_t len = t.low_lengths_[i];
+
+        max_dividends[i] = max_dividend;
+        max_dividend /= len;
+
+        b.SetMaxValue(LowIds::At(i), len - 1);
+    });
+
+    static_for<1, NDimLow, 1>{}([&](auto i) {
+        b.program_.divisors_.emplace_back(static_cast<long_index_t>(t.low_lengths_[i]),
+                                          max_dividends[i]);
+    });
+
+    b.SetMaxValue(LowIds::At(Number<0>{}), max_dividend);
+    b.Push(op);
+}
+
+template <typename LowLengths, typename UpIds, typename LowIds>
+void emit(HostTransformProgramBuilder& b,
+          const Merge_v1_carry_check<LowLengths>& t,
+          UpIds up,
+          LowIds low)
+{
+    emit_merge(b, t, up, low);
+}
+
+template <typename LowLengths, typename UpIds, typename LowIds>
+void emit(HostTransformProgramBuilder& b,
+          const Merge_v2_magic_division<LowLengths>& t,
+          UpIds up,
+          LowIds low)
+{
+    emit_merge(b, t, up, low);
+}
+
+template <typename LowLengths, typename UpIds, typename LowIds>
+void emit(HostTransformProgramBuilder& b,
+          const Merge_v2r2_magic_division<LowLengths>& t,
+          UpIds up,
+          LowIds low)
+{
+    emit_merge(b, t, up, low);
+}
+
+template <typename LowLengths, typename UpIds, typename LowIds>
+void emit(HostTransformProgramBuilder& b,
+          const Merge_v3_division_mod<LowLengths>& t,
+          UpIds up,
+          LowIds low)
+{
+    emit_merge(b, t, up, low);
+}
+
+// fallback for transformations without a dedicated instruction
+template <typename Transform, typename UpIds, typename LowIds>
+void emit(HostTransformProgramBuilder& b, const Transform& t, UpIds up, LowIds low)
+{
+    constexpr index_t NDimUp  = UpIds::Size();
+    constexpr index_t NDimLow = LowIds::Size();
+
+    static_assert(NDimUp <= 8 && NDimLow <= 8, "wrong! too many dimensions for generic transform");
+
+    auto op = b.MakeOp(HostTransformOpCode::Generic, up, low);
+
+    op.constant_begin_ = static_cast<index_t>(b.program_.generics_.size());
+    op.check_valid_    = !Transform::IsValidUpperIndexAlwaysMappedToValidLowerIndex();
+
+    auto to_up_index = [](const long_index_t* up_values) {
+        MultiIndex<NDimUp> idx_up;
+
+        static_for<0, NDimUp, 1>{}(
+            [&](auto i) { idx_up(i) = static_cast<index_t>(up_values[i]); });
+
+        return idx_up;
+    };
+
+    HostTransformProgram::Generic generic;
+
+    generic.calculate_lower_index_ = [t, to_up_index](const long_index_t* up_values,
+                                                      long_index_t* low_values) {
+        MultiIndex<NDimLow> idx_low;
+
+        t.CalculateLowerIndex(idx_low, to_up_index(up_values));
+
+        static_for<0, NDimLow, 1>{}([&](auto i) { low_values[i] = idx_low[i]; });
+    };
+
+    generic.is_valid_ = [t, to_up_index](const long_index_t* up_values) {
+        return t.IsValidUpperIndexMappedToValidLowerIndex(to_up_index(up_values));
+    };
+
+    b.program_.generics_.push_back(std::move(generic));
+
+    static_for<0, NDimLow, 1>{}([&](auto i) {
+        b.SetMaxValue(LowIds::At(i), std::numeric_limits<long_index_t>::max());
+    });
+
+    b.Push(op);
+}
+
+template <typename UpperDimensionIdss, typename TopIds, typename Transforms>
+std::vector<long_index_t> get_top_lengths(const Transforms& transforms)
+{
+    std::vector<long_index_t> lengths(TopIds::Size(), 0);
+
+    static_for<0, TopIds::Size(), 1>{}([&](auto itop) {
+        static_for<0, Transforms::Size(), 1>{}([&](auto itran) {
+            using UpIds = remove_cvref_t<decltype(UpperDimensionIdss{}.At(itran))>;
+
+            static_for<0, UpIds::Size(), 1>{}([&](auto iup) {
+                if constexpr(UpIds::At(iup) == TopIds::At(itop))
+                {
+                    lengths[itop] = transforms.At(itran).GetUpperLengths()[iup];
+                }
+            });
+        });
+    });
+
+    return lengths;
+}
+
+// Classify every register by its dependence on the innermost top register: invariant, affine with
+// a known coefficient, or anything else. Fills in the row related members of the program.
+inline void analyse_row_dependence(HostTransformProgram& p)
+{
+    enum struct Dependence
+    {
+        Invariant,
+        Affine,
+        Varying,
+    };
+
+    std::vector<Dependence> dep(p.num_register_, Dependence::Invariant);
+    std::vector<long_index_t> coef(p.num_register_, 0);
+
+    const index_t inner = p.top_registers_.back();
+
+    dep[inner]  = Dependence::Affine;
+    coef[inner] = 1;
+
+    p.row_affine_ = true;
+    p.row_ops_.clear();
+    p.row_checks_.clear();
+
+    for(index_t iop = 0; iop < static_cast<index_t>(p.ops_.size()); ++iop)
+    {
+        auto& op = p.ops_[iop];
+
+        const index_t* up  = p.operands_.data() + op.operand_begin_;
+        const index_t* low = up + op.num_up_;
+
+        Dependence up_dep = Dependence::Invariant;
+
+        for(index_t i = 0; i < op.num_up_; ++i)
+        {
+            up_dep = std::max(up_dep, dep[up[i]]);
+        }
+
+        op.row_dependent_ = up_dep != Dependence::Invariant;
+
+        if(!op.row_dependent_)
+        {
+            continue;
+        }
+
+        p.row_ops_.push_back(iop);
+
+        switch(op.code_)
+        {
+        case HostTransformOpCode::Move:
+            dep[low[0]]  = dep[up[0]];
+            coef[low[0]] = coef[up[0]];
+            break;
+        case HostTransformOpCode::Linear:
+            dep[low[0]]  = up_dep;
+            coef[low[0]] = 0;
+
+            for(index_t i = 0; i < op.num_up_; ++i)
+            {
+                coef[low[0]] += coef[up[i]] * p.constants_[op.constant_begin_ + i];
+            }
+            break;
+        default:
+            for(index_t i = 0; i < op.num_low_; ++i)
+            {
+                dep[low[i]] = Dependence::Varying;
+            }
+            break;
+        }
+
+        if(op.check_valid_)
+        {
+            if(op.code_ != HostTransformOpCode::Generic && dep[up[0]] == Dependence::Affine)
+            {
+                p.row_checks_.push_back(
+                    {up[0], coef[up[0]], op.valid_begin_, op.valid_end_});
+            }
+            else
+            {
+                p.row_affine_ = false;
+            }
+        }
+    }
+
+    const index_t bottom = p.bottom_registers_[0];
+
+    p.row_affine_      = p.row_affine_ && p.bottom_registers_.size() == 1 &&
+                    dep[bottom] != Dependence::Varying;
+    p.row_coefficient_ = coef[bottom];
+}
+
+template <typename Transforms,
+          typename LowerDimensionIdss,
+          typename UpperDimensionIdss,
+          typename BottomIds,
+          typename TopIds>
+HostTransformProgram make_host_transform_program_impl(const Transforms& transforms,
+                                                      LowerDimensionIdss,
+                                                      UpperDimensionIdss,
+                                                      BottomIds,
+                                                      TopIds)
+{
+    static_assert(TopIds::Size() > 0, "wrong! no top dimension");
+
+    HostTransformProgram program;
+
+    index_t num_register = 0;
+
+    static_for<0, Transforms::Size(), 1>{}([&](auto itran) {
+        using LowIds = remove_cvref_t<decltype(LowerDimensionIdss{}.At(itran))>;
+        using UpIds  = remove_cvref_t<decltype(UpperDimensionIdss{}.At(itran))>;
+
+        static_for<0, LowIds::Size(), 1>{}(
+            [&](auto i) { num_register = math::max(num_register, LowIds::At(i) + 1); });
+        static_for<0, UpIds::Size(), 1>{}(
+            [&](auto i) { num_register = math::max(num_register, UpIds::At(i) + 1); });
+    });
+
+    program.num_register_ = num_register;
+    program.top_lengths_  = get_top_lengths<UpperDimensionIdss, TopIds>(transforms);
+
+    static_for<0, TopIds::Size(), 1>{}(
+        [&](auto i) { program.top_registers_.push_back(TopIds::At(i)); });
+    static_for<0, BottomIds::Size(), 1>{}(
+        [&](auto i) { program.bottom_registers_.push_back(BottomIds::At(i)); });
+
+    std::vector<long_index_t> max_values(num_register, std::numeric_limits<long_index_t>::max());
+
+    for(index_t i = 0; i < static_cast<index_t>(program.top_registers_.size()); ++i)
+    {
+        max_values[program.top_registers_[i]] = program.top_lengths_[i] - 1;
+    }
+
+    HostTransformProgramBuilder builder{program, max_values};
+
+    // transformations are stored bottom-up, evaluate them top-down
+    static_for<Transforms::Size(), 0, -1>{}([&](auto itran_p1) {
+        constexpr auto itran = itran_p1 - Number<1>{};
+
+        emit(builder,
+             transforms.At(itran),
+             UpperDimensionIdss{}.At(itran),
+             LowerDimensionIdss{}.At(itran));
+    });
+
+    analyse_row_dependence(program);
+
+    return program;
+}
+
+} // namespace detail
+
+template <typename Transforms,
+          typename LowerDimensionIdss,
+          typename UpperDimensionIdss,
+          typename VisibleDimensionIds,
+          typename ElementSpaceSize>
+HostTransformProgram
+make_host_transform_program(const TensorDescriptor<Transforms,
+                                                   LowerDimensionIdss,
+                                                   UpperDimensionIdss,
+                                                   VisibleDimensionIds,
+                                                   ElementSpaceSize>& desc)
+{
+    return detail::make_host_transform_program_impl(desc.GetTransforms(),
+                                                    LowerDimensionIdss{},
+                                                    UpperDimensionIdss{},
+                                                    Sequence<0>{},
+                                                    VisibleDimensionIds{});
+}
+
+template <typename Transforms,
+          typename LowerDimensionHiddenIdss,
+          typename UpperDimensionHiddenIdss,
+          typename BottomDimensionHiddenIds,
+          typename TopDimensionHiddenIds>
+HostTransformProgram
+make_host_transform_program(const TensorAdaptor<Transforms,
+                                                LowerDimensionHiddenIdss,
+                                                UpperDimensionHiddenIdss,
+                                                BottomDimensionHiddenIds,
+                                                TopDimensionHiddenIds>& adaptor)
+{
+    return detail::make_host_transform_program_impl(adaptor.GetTransforms(),
+                                                    LowerDimensionHiddenIdss{},
+                                                    UpperDimensionHiddenIdss{},
+                                                    BottomDimensionHiddenIds{},
+                                                    TopDimensionHiddenIds{});
+}
+
+} // namespace utils
+} // namespace ck
@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <stdexcept>
+
+#include "ck/ck.hpp"
+#include "ck/stream_config.hpp"
+#include "ck/host_utility/kernel_timer.hpp"
+#include "ck/wrapper/layout.hpp"
+#include "ck/wrapper/tensor.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
+
+// Host execution target for ck::wrapper: wrapper tensors over host Tensor<T> storage and a
+// launcher running wrapper kernels on host threads, so that algorithms written with
+// make_local_tile/make_local_partition/copy can be run, tested and benchmarked without a GPU.
+
+namespace ck {
+namespace wrapper {
+
+/**
+ * \brief Make wrapper tensor over the storage of a host tensor.
+ *
+ * \param tensor Host tensor.
+ * \param layout Layout, must not exceed the host tensor storage.
+ * \return Wrapper tensor in Generic memory.
+ */
+template <typename ElementType, typename Shape, typename UnrolledDescriptorType>
+auto make_host_tensor(::Tensor<ElementType>& tensor,
+                      const Layout<Shape, UnrolledDescriptorType>& layout)
+{
+    if(static_cast<std::size_t>(layout.GetElementSpaceSize()) > tensor.mData.size())
+    {
+        throw std::runtime_error("wrong! layout exceeds the host tensor storage");
+    }
+
+    return make_tensor<MemoryTypeEnum::Generic>(tensor.mData.data(), layout);
+}
+
+/**
+ * \brief Make wrapper tensor with the lengths and strides of a host tensor.
+ *
+ * \tparam NumDim Number of dimensions of the host tensor.
+ * \param tensor Host tensor.
+ * \return Wrapper tensor in Generic memory with runtime layout.
+ */
+template <index_t NumDim, typename ElementType>
+auto make_host_tensor(::Tensor<ElementType>& tensor)
+{
+    if(tensor.mDesc.GetNumOfDimension() != static_cast<std::size_t>(NumDim))
+    {
+        throw std::runtime_error("wrong! wrong number of dimensions of the host tensor");
+    }
+
+    const auto& lengths = tensor.mDesc.GetLengths();
+    const auto& strides = tensor.mDesc.GetStrides();
+
+    const auto shape = generate_tuple(
+        [&](auto i) { return static_cast<index_t>(lengths[i.value]); }, Number<NumDim>{});
+    const auto stride_tuple = generate_tuple(
+        [&](auto i) { return static_cast<index_t>(strides[i.value]); }, Number<NumDim>{});
+
+    return make_host_tensor(tensor, make_layout(shape, stride_tuple));
+}
+
+/**
+ * \brief Run a wrapper kernel on host threads.
+ *
+ * Blocks are distributed over the threads of HostThreadPool, the threads of
+ * a block run one after another on the host thread of the block, in thread id
+ * order. Thread ids passed to make_local_partition therefore keep their
+ * meaning, but the kernel must not synchronize the threads of a block.
+ * Tensors shared by the threads of a block (LDS on device) can be allocated
+ * per block by the caller, indexed with block_id.
+ *
+ * \param stream_config Timing configuration, time_kernel_ as for device kernels.
+ * \param kernel Called as kernel(block_id, thread_id).
+ * \param grid_size Number of blocks.
+ * \param block_size Number of threads per block.
+ * \return Mean time per launch in ms if timed, 0 otherwise.
+ */
+template <typename Kernel>
+float launch_host_kernel(const StreamConfig& stream_config,
+                         Kernel kernel,
+                         const index_t grid_size,
+                         const index_t block_size)
+{
+    const auto run = [&] {
+        ck::utils::HostThreadPool::GetInstance().ParallelFor(
+            static_cast<std::size_t>(grid_size), [&](std::size_t block_id) {
+                for(index_t thread_id = 0; thread_id < block_size; ++thread_id)
+                {
+                    kernel(static_cast<index_t>(block_id), thread_id);
+                }
+            });
+    };
+
+    if(!stream_config.time_kernel_)
+    {
+        run();
+
+        return 0;
+    }
+
+    HostTimer host_timer;
+
+    StreamConfig host_stream_config = stream_config;
+
+    if(host_stream_config.timer_ == nullptr)
+    {
+        host_stream_config.timer_ = &host_timer;
+    }
+
+    return time_kernel_runs(host_stream_config, run, [] {});
+}
+
+} // namespace wrapper
+} // namespace ck
@@ -0,0 +1,106 @@
+# Generates the instance plugin manifest and the trampolines of device_operations_lazy from the
+# add_device_*_instances functions the plugins define, see instance_plugin.hpp.
+#
+#   cmake -DPLUGIN_LIST=<file> -DMANIFEST=<file> -DTRAMPOLINES=<file> -DNM=<nm> -DCXXFILT=<c++filt>
+#         -P generate_instance_plugins.cmake
+#
+# PLUGIN_LIST has one "<plugin path>\t<family>\t<data type>" line per plugin.
+
+file(STRINGS ${PLUGIN_LIST} plugins)
+
+set(manifest "#ck-instance-plugins v1\n")
+set(trampolines "// generated by generate_instance_plugins.cmake, do not edit\n\n")
+string(APPEND trampolines "#include \"ck/library/tensor_operation_instance/instance_plugin.hpp\"\n\n")
+string(APPEND trampolines "using ck::tensor_operation::device::instance::InstanceAdder;\n")
+string(APPEND trampolines "using ck::tensor_operation::device::instance::get_instance_plugin_adder;\n")
+
+set(seen_symbols)
+set(num_adder 0)
+
+foreach(plugin IN LISTS plugins)
+    string(REPLACE "\t" ";" fields "${plugin}")
+    list(GET fields 0 plugin_path)
+    list(GET fields 1 family)
+    list(GET fields 2 data_type)
+    get_filename_component(plugin_file ${plugin_path} NAME)
+
+    string(APPEND manifest "plugin\t${plugin_file}\t${family}\t${data_type}\n")
+
+    execute_process(
+        COMMAND ${NM} -D --defined-only --format=posix ${plugin_path}
+        OUTPUT_VARIABLE nm_output
+        RESULT_VARIABLE nm_result)
+    if(NOT nm_result EQUAL 0)
+        message(FATAL_ERROR "cannot list the symbols of ${plugin_path}")
+    endif()
+
+    # defined text symbols (weak ones are template instantiations) of functions in
+    # ck::tensor_operation::device::instance
+    string(REPLACE "\n" ";" nm_lines "${nm_output}")
+    set(symbols)
+    foreach(nm_line IN LISTS nm_lines)
+        if(nm_line MATCHES "^(_ZN2ck16tensor_operation6device8instance[0-9]+add_device_[^ ]*) [TW] ")
+            list(FIND seen_symbols ${CMAKE_MATCH_1} seen)
+            if(seen EQUAL -1)
+                list(APPEND symbols ${CMAKE_MATCH_1})
+                list(APPEND seen_symbols ${CMAKE_MATCH_1})
+            endif()
+        endif()
+    endforeach()
+
+    if(NOT symbols)
+        continue()
+    endif()
+
+    execute_process(
+        COMMAND ${CXXFILT} ${symbols}
+        OUTPUT_VARIABLE demangled_output
+        RESULT_VARIABLE cxxfilt_result)
+    if(NOT cxxfilt_result EQUAL 0)
+        message(FATAL_ERROR "cannot demangle the symbols of ${plugin_path}")
+    endif()
+
+    string(STRIP "${demangled_output}" demangled_output)
+    string(REPLACE "\n" ";" demangled_symbols "${demangled_output}")
+
+    list(LENGTH symbols num_symbol)
+    math(EXPR last_symbol "${num_symbol} - 1")
+
+    foreach(i RANGE ${last_symbol})
+        list(GET symbols ${i} symbol)
+        list(GET demangled_symbols ${i} demangled)
+
+        # only adders taking std::vector<std::unique_ptr<DeviceOp>>& can be forwarded
+        if(NOT demangled MATCHES "^(void )?ck::tensor_operation::device::instance::add_device_[A-Za-z0-9_]*(<[^()]*>)?\\(std::vector<std::unique_ptr<.*>&\\)$" OR
+           demangled MATCHES "&, ")
+            continue()
+        endif()
+
+        # DeviceOp interface, the first template argument of the unique_ptr
+        string(FIND "${demangled}" "std::unique_ptr<" begin)
+        string(FIND "${demangled}" ", std::default_delete<" end)
+        math(EXPR begin "${begin} + 16")
+        math(EXPR length "${end} - ${begin}")
+        if(end GREATER begin)
+            string(SUBSTRING "${demangled}" ${begin} ${length} interface)
+        else()
+            set(interface "${demangled}")
+        endif()
+
+        string(APPEND manifest "adder\t${plugin_file}\t${symbol}\t${interface}\n")
+
+        set(name ck_instance_plugin_adder_${num_adder})
+        string(APPEND trampolines "\n// ${demangled}\n")
+        string(APPEND trampolines "extern \"C\" void ${name}(void* instances) __asm__(\"${symbol}\");\n")
+        string(APPEND trampolines "void ${name}(void* instances)\n{\n")
+        string(APPEND trampolines "    static const InstanceAdder adder = get_instance_plugin_adder(\"${symbol}\");\n")
+        string(APPEND trampolines "    adder(instances);\n}\n")
+
+        math(EXPR num_adder "${num_adder} + 1")
+    endforeach()
+endforeach()
+
+file(WRITE ${MANIFEST} "${manifest}")
+file(WRITE ${TRAMPOLINES} "${trampolines}")
+
+message(STATUS "${num_adder} instance adders in ${PLUGIN_LIST}")
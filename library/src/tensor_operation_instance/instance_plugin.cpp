@@ -0,0 +1,207 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <dlfcn.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+
+#include "ck/library/tensor_operation_instance/instance_plugin.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+namespace {
+
+constexpr const char* ManifestName   = "ck_instance_plugins.manifest";
+constexpr const char* ManifestHeader = "#ck-instance-plugins v1";
+
+struct InstancePlugin
+{
+    InstancePluginInfo info_;
+    std::once_flag load_flag_;
+    std::atomic<bool> loaded_{false};
+    // never closed, the instances it creates refer to its code
+    void* handle_ = nullptr;
+};
+
+struct InstancePluginManifest
+{
+    std::string directory_;
+    std::vector<std::unique_ptr<InstancePlugin>> plugins_;
+    // mangled add_device_*_instances symbol -> plugin
+    std::map<std::string, InstancePlugin*> adders_;
+};
+
+std::string get_plugin_directory()
+{
+    if(const char* path = std::getenv("CK_INSTANCE_PLUGIN_PATH"); path != nullptr && *path != 0)
+    {
+        return path;
+    }
+
+    // the directory this library was loaded from
+    Dl_info dl_info;
+
+    if(dladdr(reinterpret_cast<void*>(&get_instance_plugin_adder), &dl_info) != 0 &&
+       dl_info.dli_fname != nullptr)
+    {
+        const std::string file = dl_info.dli_fname;
+        const auto slash       = file.rfind('/');
+
+        return slash == std::string::npos ? "." : file.substr(0, slash);
+    }
+
+    return ".";
+}
+
+std::vector<std::string> split_manifest_line(const std::string& line)
+{
+    std::vector<std::string> fields;
+    std::string field;
+    std::istringstream is(line);
+
+    while(std::getline(is, field, '\t'))
+    {
+        fields.push_back(field);
+    }
+
+    return fields;
+}
+
+InstancePluginManifest read_manifest()
+{
+    InstancePluginManifest manifest;
+
+    manifest.directory_ = get_plugin_directory();
+
+    const std::string path = manifest.directory_ + "/" + ManifestName;
+
+    std::ifstream is(path);
+
+    if(!is)
+    {
+        throw std::runtime_error("wrong! cannot open instance plugin manifest " + path);
+    }
+
+    std::string line;
+
+    if(!std::getline(is, line) || line != ManifestHeader)
+    {
+        throw std::runtime_error("wrong! " + path + " is not an instance plugin manifest");
+    }
+
+    std::map<std::string, InstancePlugin*> plugins_by_file;
+
+    while(std::getline(is, line))
+    {
+        const auto fields = split_manifest_line(line);
+
+        if(fields.size() == 4 && fields[0] == "plugin")
+        {
+            auto plugin = std::make_unique<InstancePlugin>();
+
+            plugin->info_.file_      = fields[1];
+            plugin->info_.family_    = fields[2];
+            plugin->info_.data_type_ = fields[3];
+
+            plugins_by_file[fields[1]] = plugin.get();
+            manifest.plugins_.push_back(std::move(plugin));
+        }
+        else if(fields.size() == 4 && fields[0] == "adder")
+        {
+            const auto found = plugins_by_file.find(fields[1]);
+
+            if(found == plugins_by_file.end())
+            {
+                throw std::runtime_error("wrong! adder of unknown plugin " + fields[1] + " in " +
+                                         path);
+            }
+
+            auto& interfaces = found->second->info_.interfaces_;
+
+            if(std::find(interfaces.begin(), interfaces.end(), fields[3]) == interfaces.end())
+            {
+                interfaces.push_back(fields[3]);
+            }
+
+            manifest.adders_.emplace(fields[2], found->second);
+        }
+    }
+
+    return manifest;
+}
+
+InstancePluginManifest& get_manifest()
+{
+    static InstancePluginManifest manifest = read_manifest();
+
+    return manifest;
+}
+
+} // namespace
+
+InstanceAdder get_instance_plugin_adder(const char* symbol)
+{
+    auto& manifest = get_manifest();
+
+    const auto found = manifest.adders_.find(symbol);
+
+    if(found == manifest.adders_.end())
+    {
+        throw std::runtime_error(std::string("wrong! no instance plugin provides ") + symbol);
+    }
+
+    InstancePlugin& plugin = *found->second;
+
+    std::call_once(plugin.load_flag_, [&] {
+        const std::string path = manifest.directory_ + "/" + plugin.info_.file_;
+
+        plugin.handle_ = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+
+        if(plugin.handle_ == nullptr)
+        {
+            throw std::runtime_error("wrong! cannot load instance plugin " + path + ": " +
+                                     dlerror());
+        }
+
+        plugin.loaded_ = true;
+    });
+
+    void* adder = dlsym(plugin.handle_, symbol);
+
+    if(adder == nullptr)
+    {
+        throw std::runtime_error("wrong! instance plugin " + plugin.info_.file_ +
+                                 " does not define " + symbol);
+    }
+
+    return reinterpret_cast<InstanceAdder>(adder);
+}
+
+std::vector<InstancePluginInfo> get_instance_plugins()
+{
+    std::vector<InstancePluginInfo> infos;
+
+    for(const auto& plugin : get_manifest().plugins_)
+    {
+        infos.push_back(plugin->info_);
+        infos.back().loaded_ = plugin->loaded_;
+    }
+
+    return infos;
+}
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
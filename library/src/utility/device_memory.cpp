@@ -1,23 +1,66 @@
 // SPDX-License-Identifier: MIT
 // Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
 
+#include <cstdlib>
+#include <memory>
+
 #include "ck/host_utility/hip_check_error.hpp"
 
 #include "ck/library/utility/device_memory.hpp"
 
-DeviceMem::DeviceMem(std::size_t mem_size) : mMemSize(mem_size)
+namespace {
+
+struct HipDeviceMemoryBackend : public CachingAllocatorBackend
+{
+    void* Allocate(std::size_t size) override
+    {
+        void* p = nullptr;
+        hip_check_error(hipMalloc(&p, size));
+        return p;
+    }
+
+    void Free(void* p) override { hip_check_error(hipFree(p)); }
+
+    // hipFree waits for the device, a cached block must not be reused while kernels still use it
+    void Synchronize() override { hip_check_error(hipDeviceSynchronize()); }
+};
+
+// cached device memory is not available to hipMalloc from other code, e.g. for the workspaces of
+// kernels, so freed DeviceMem buffers are only cached with CK_DEVICE_MEM_CACHE_MB=<MiB>
+std::size_t GetDeviceMemMaxCachedBytes()
+{
+    if(const char* mib = std::getenv("CK_DEVICE_MEM_CACHE_MB"); mib != nullptr && *mib != 0)
+    {
+        return static_cast<std::size_t>(std::strtoull(mib, nullptr, 10)) << 20;
+    }
+
+    return 0;
+}
+
+} // namespace
+
+CachingAllocator& GetDeviceMemAllocator()
+{
+    static CachingAllocator allocator(std::make_unique<HipDeviceMemoryBackend>(),
+                                      GetDeviceMemMaxCachedBytes());
+
+    return allocator;
+}
+
+DeviceMem::DeviceMem(std::size_t mem_size)
+    : mpDeviceBuf(GetDeviceMemAllocator().Allocate(mem_size)), mMemSize(mem_size)
 {
-    hip_check_error(hipMalloc(static_cast<void**>(&mpDeviceBuf), mMemSize));
 }
 
 void DeviceMem::Realloc(std::size_t mem_size)
 {
     if(mpDeviceBuf)
     {
-        hip_check_error(hipFree(mpDeviceBuf));
+        GetDeviceMemAllocator().Free(mpDeviceBuf);
+        mpDeviceBuf = nullptr;
     }
-    mMemSize = mem_size;
-    hip_check_error(hipMalloc(static_cast<void**>(&mpDeviceBuf), mMemSize));
+    mMemSize    = mem_size;
+    mpDeviceBuf = GetDeviceMemAllocator().Allocate(mMemSize);
 }
 
 void* DeviceMem::GetDeviceBuffer() const { return mpDeviceBuf; }
@@ -71,6 +114,6 @@ DeviceMem::~DeviceMem()
 {
     if(mpDeviceBuf)
     {
-        hip_check_error(hipFree(mpDeviceBuf));
+        GetDeviceMemAllocator().Free(mpDeviceBuf);
     }
 }
@@ -21,6 +21,8 @@
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_batched_gemm.hpp"
 
+#include "profiler/profile_timing_options.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -206,8 +208,10 @@ bool profile_batched_gemm_impl(int do_verification,
 
             std::string op_name = op_ptr->GetTypeString();
 
-            float ave_time =
-                invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+            ck::TimingStats timing_stats;
+
+            float ave_time = invoker_ptr->Run(
+                argument_ptr.get(), make_profiler_stream_config(time_kernel, &timing_stats));
 
             std::size_t flop = std::size_t(2) * BatchCount * M * N * K;
 
@@ -222,6 +226,8 @@ bool profile_batched_gemm_impl(int do_verification,
             std::cout << "Perf: " << ave_time << " ms, " << tflops << " TFlops, " << gb_per_sec
                       << " GB/s, " << op_name << std::endl;
 
+            report_profiler_result(op_name, ave_time, tflops, gb_per_sec, timing_stats);
+
             if(tflops > best_tflops)
             {
                 best_op_name    = op_name;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <iomanip>
 #include <iostream>
 #include <typeinfo>
@@ -182,6 +183,10 @@ bool profile_conv_tensor_rearrange_impl(int do_verification,
 
     in_device_buf.ToDevice(input.mData.data());
 
+    // every element of the column matrix is read or written once
+    const std::size_t num_btype =
+        conv_param.G_ * NDoHoWo * CZYX * (sizeof(OutputDataType) + sizeof(InputDataType));
+
     // run reference op
     if(do_verification)
     {
@@ -204,7 +209,15 @@ bool profile_conv_tensor_rearrange_impl(int do_verification,
         // init host output to zero
         host_output.SetZero();
 
+        const auto time_begin = std::chrono::steady_clock::now();
         ref_invoker.Run(ref_argument);
+        const auto time_end = std::chrono::steady_clock::now();
+
+        const double ref_time =
+            std::chrono::duration<double, std::milli>(time_end - time_begin).count();
+
+        std::cout << "Reference: " << std::setw(10) << ref_time << " ms, "
+                  << num_btype / 1.E6 / ref_time << " GB/s" << std::endl;
     }
 
     using DeviceOp = ck::tensor_operation::device::DeviceConvTensorRearrange<NDimSpatial,
@@ -254,8 +267,6 @@ bool profile_conv_tensor_rearrange_impl(int do_verification,
             auto invoker_ptr    = op_ptr->MakeInvokerPointer();
             float avg_time =
                 invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
-            std::size_t num_btype =
-                conv_param.G_ * NDoHoWo * CZYX * (sizeof(OutputDataType) + sizeof(InputDataType));
             float gb_per_sec = num_btype / 1.E6 / avg_time;
             std::cout << "Perf: " << std::setw(10) << avg_time << " ms, " << gb_per_sec << " GB/s, "
                       << op_name << std::endl;
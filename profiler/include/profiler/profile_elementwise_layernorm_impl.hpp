@@ -13,6 +13,7 @@
 #include "ck/library/utility/device_memory.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/utility/host_element_wise_batch.hpp"
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_layernorm.hpp"
 
@@ -28,6 +29,19 @@ void host_elementwise2D(HostTensorC& C,
 {
     using ctype = ck::remove_reference_t<decltype(C(0, 0))>;
 
+    // whole rows at once if they are contiguous
+    if(shape[1] > 0 && A.mDesc.GetStrides()[1] == 1 && B.mDesc.GetStrides()[1] == 1 &&
+       C.mDesc.GetStrides()[1] == 1)
+    {
+        for(std::size_t m = 0; m < shape[0]; ++m)
+        {
+            ck::tensor_operation::host::apply_element_wise(
+                functor, &C(m, 0), &A(m, 0), &B(m, 0), shape[1]);
+        }
+
+        return;
+    }
+
     for(std::size_t m = 0; m < shape[0]; ++m)
         for(std::size_t n = 0; n < shape[1]; ++n)
         {
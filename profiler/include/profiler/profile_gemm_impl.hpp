@@ -11,6 +11,7 @@
 #include "ck/ck.hpp"
 #include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
 #include "ck/tensor_operation/gpu/device/device_gemm.hpp"
+#include "ck/tensor_operation/gpu/device/device_base_trace.hpp"
 #include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
 
 #include "ck/library/tensor_operation_instance/gpu/gemm.hpp"
@@ -23,6 +24,9 @@
 #include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
 #include "ck/library/utility/fill.hpp"
 
+#include "profiler/profile_input_options.hpp"
+#include "profiler/profile_timing_options.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -62,10 +66,14 @@ int profile_gemm_impl(int do_verification,
             }
         };
 
-    Tensor<ADataType> a_m_k(f_host_tensor_descriptor(M, K, StrideA, ALayout{}));
-    Tensor<BDataType> b_k_n(f_host_tensor_descriptor(K, N, StrideB, BLayout{}));
+    // A and B are filled below and the device result is copied back in full
+    Tensor<ADataType> a_m_k(f_host_tensor_descriptor(M, K, StrideA, ALayout{}),
+                            TensorUninitialized{});
+    Tensor<BDataType> b_k_n(f_host_tensor_descriptor(K, N, StrideB, BLayout{}),
+                            TensorUninitialized{});
     Tensor<CDataType> c_m_n_host_result(f_host_tensor_descriptor(M, N, StrideC, CLayout{}));
-    Tensor<CDataType> c_m_n_device_result(f_host_tensor_descriptor(M, N, StrideC, CLayout{}));
+    Tensor<CDataType> c_m_n_device_result(f_host_tensor_descriptor(M, N, StrideC, CLayout{}),
+                                          TensorUninitialized{});
 
     std::cout << "a_m_k: " << a_m_k.mDesc << std::endl;
     std::cout << "b_k_n: " << b_k_n.mDesc << std::endl;
@@ -86,6 +94,9 @@ int profile_gemm_impl(int do_verification,
         ck::utils::FillUniformDistribution<BDataType>{-1.f, 1.f}(b_k_n);
     }
 
+    replay_profiler_input(0, a_m_k);
+    replay_profiler_input(1, b_k_n);
+
     using AElementOp = ck::tensor_operation::element_wise::PassThrough;
     using BElementOp = ck::tensor_operation::element_wise::PassThrough;
     using CElementOp = ck::tensor_operation::element_wise::PassThrough;
@@ -137,6 +148,33 @@ int profile_gemm_impl(int do_verification,
         ref_invoker.Run(ref_argument);
     }
 
+    // the problem in the codes of "ckProfiler gemm", for invocation traces
+    using Col = tensor_layout::gemm::ColumnMajor;
+
+    int data_type_code = 4;
+
+    if constexpr(is_same_v<ADataType, float>)
+    {
+        data_type_code = 0;
+    }
+    else if constexpr(is_same_v<ADataType, half_t>)
+    {
+        data_type_code = 1;
+    }
+    else if constexpr(is_same_v<ADataType, bhalf_t>)
+    {
+        data_type_code = 2;
+    }
+    else if constexpr(is_same_v<ADataType, int8_t>)
+    {
+        data_type_code = 3;
+    }
+
+    const int layout_code = (is_same_v<ALayout, Col> ? 2 : 0) + (is_same_v<BLayout, Col> ? 1 : 0);
+
+    const InvocationProblem problem{
+        "gemm", data_type_code, layout_code, {M, N, K, StrideA, StrideB, StrideC}};
+
     float best_tflops    = 0;
     int best_instance_id = 0;
 
@@ -144,19 +182,21 @@ int profile_gemm_impl(int do_verification,
     // profile device op instances
     for(auto& op_ptr : op_ptrs)
     {
-        auto argument_ptr =
-            op_ptr->MakeArgumentPointer(static_cast<ADataType*>(a_device_buf.GetDeviceBuffer()),
-                                        static_cast<BDataType*>(b_device_buf.GetDeviceBuffer()),
-                                        static_cast<CDataType*>(c_device_buf.GetDeviceBuffer()),
-                                        M,
-                                        N,
-                                        K,
-                                        StrideA,
-                                        StrideB,
-                                        StrideC,
-                                        a_element_op,
-                                        b_element_op,
-                                        c_element_op);
+        auto argument_ptr = tensor_operation::device::make_traced_argument_pointer(
+            *op_ptr,
+            problem,
+            static_cast<ADataType*>(a_device_buf.GetDeviceBuffer()),
+            static_cast<BDataType*>(b_device_buf.GetDeviceBuffer()),
+            static_cast<CDataType*>(c_device_buf.GetDeviceBuffer()),
+            M,
+            N,
+            K,
+            StrideA,
+            StrideB,
+            StrideC,
+            a_element_op,
+            b_element_op,
+            c_element_op);
 
         auto invoker_ptr = op_ptr->MakeInvokerPointer();
 
@@ -167,8 +207,13 @@ int profile_gemm_impl(int do_verification,
 
             std::string op_name = op_ptr->GetTypeString();
 
-            float avg_time = invoker_ptr->Run(
-                argument_ptr.get(), StreamConfig{nullptr, time_kernel, 0, n_warmup, n_iter});
+            ck::TimingStats timing_stats;
+
+            float avg_time = tensor_operation::device::run_traced(
+                *op_ptr,
+                *invoker_ptr,
+                argument_ptr.get(),
+                make_profiler_stream_config(time_kernel, &timing_stats, n_warmup, n_iter));
 
             std::size_t flop = std::size_t(2) * M * N * K;
 
@@ -182,6 +227,8 @@ int profile_gemm_impl(int do_verification,
             std::cout << "Perf: " << std::setw(10) << avg_time << " ms, " << tflops << " TFlops, "
                       << gb_per_sec << " GB/s, " << op_name << std::endl;
 
+            report_profiler_result(op_name, avg_time, tflops, gb_per_sec, timing_stats);
+
             if(tflops > best_tflops)
             {
                 best_instance_id = instance_id;
@@ -218,19 +265,21 @@ int profile_gemm_impl(int do_verification,
     // Run the best instance again
     {
         auto& op_ptr = op_ptrs[best_instance_id];
-        auto argument_ptr =
-            op_ptr->MakeArgumentPointer(static_cast<ADataType*>(a_device_buf.GetDeviceBuffer()),
-                                        static_cast<BDataType*>(b_device_buf.GetDeviceBuffer()),
-                                        static_cast<CDataType*>(c_device_buf.GetDeviceBuffer()),
-                                        M,
-                                        N,
-                                        K,
-                                        StrideA,
-                                        StrideB,
-                                        StrideC,
-                                        a_element_op,
-                                        b_element_op,
-                                        c_element_op);
+        auto argument_ptr = tensor_operation::device::make_traced_argument_pointer(
+            *op_ptr,
+            problem,
+            static_cast<ADataType*>(a_device_buf.GetDeviceBuffer()),
+            static_cast<BDataType*>(b_device_buf.GetDeviceBuffer()),
+            static_cast<CDataType*>(c_device_buf.GetDeviceBuffer()),
+            M,
+            N,
+            K,
+            StrideA,
+            StrideB,
+            StrideC,
+            a_element_op,
+            b_element_op,
+            c_element_op);
 
         auto invoker_ptr = op_ptr->MakeInvokerPointer();
 
@@ -238,8 +287,11 @@ int profile_gemm_impl(int do_verification,
         {
             std::string op_name = op_ptr->GetTypeString();
 
-            float avg_time = invoker_ptr->Run(argument_ptr.get(),
-                                              StreamConfig{nullptr, time_kernel, 0, 50, 200});
+            ck::TimingStats timing_stats;
+
+            float avg_time = invoker_ptr->Run(
+                argument_ptr.get(),
+                make_profiler_stream_config(time_kernel, &timing_stats, 50, 200));
 
             std::size_t flop = std::size_t(2) * M * N * K;
 
@@ -295,6 +347,8 @@ int profile_gemm_impl(int do_verification,
                       << " StrideB = " << StrideB << " StrideC = " << StrideC << " : " << avg_time
                       << " ms, " << tflops << " TFlops, " << gb_per_sec << " GB/s, " << op_name
                       << std::endl;
+
+            report_timing_stats(timing_stats);
         }
     }
 
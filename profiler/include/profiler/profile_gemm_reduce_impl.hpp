@@ -16,6 +16,7 @@
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_multiple_reduce.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -134,9 +135,6 @@ bool profile_gemm_reduce_impl(int do_verification,
     auto c_element_op                     = CElementOp{};
     std::array<void*, 3> gemm_element_ops = {&a_element_op, &b_element_op, &c_element_op};
 
-    const auto reduce0_op = ReduceOp0{};
-    const auto reduce1_op = ReduceOp1{};
-
     auto passthrough                            = UnaryIdenticElementOp{};
     auto square                                 = UnarySquareElementOp{};
     auto div                                    = UnaryDivElementOp{N};
@@ -163,27 +161,39 @@ bool profile_gemm_reduce_impl(int do_verification,
 
         ref_invoker.Run(ref_argument);
 
-        for(int m = 0; m < M; ++m)
-        {
-            auto reduce0_acc = reduce0_op.GetIdentityValue<ReduceAccDataType>();
-            auto reduce1_acc = reduce1_op.GetIdentityValue<ReduceAccDataType>();
-
-            for(int n = 0; n < N; ++n)
-            {
-                ReduceAccDataType d0_val =
-                    ck::type_convert<ReduceAccDataType>(c_m_n_host_result(m, n));
-                ReduceAccDataType d1_val;
-
-                square(d1_val, d0_val);
-                reduce0_op(reduce0_acc, d0_val);
-                reduce1_op(reduce1_acc, d1_val);
-            }
-
-            div(reduce0_acc, reduce0_acc);
-            div(reduce1_acc, reduce1_acc);
-            reduce0_m_host_result(m) = ck::type_convert<ReduceDataType>(reduce0_acc);
-            reduce1_m_host_result(m) = ck::type_convert<ReduceDataType>(reduce1_acc);
-        }
+        using ReferenceReduceInstance = ck::tensor_operation::host::ReferenceMultipleReduce<
+            CDataType,
+            ReduceAccDataType,
+            ck::Tuple<ReduceDataType, ReduceDataType>,
+            2,
+            1,
+            ck::Tuple<ReduceOp0, ReduceOp1>,
+            ck::Tuple<UnaryIdenticElementOp, UnarySquareElementOp>,
+            ck::Tuple<UnaryDivElementOp, UnaryDivElementOp>,
+            false,
+            false>;
+
+        const auto& c_strides = c_m_n_host_result.mDesc.GetStrides();
+
+        // both reductions of every row of c in one pass
+        auto ref_reduce         = ReferenceReduceInstance{};
+        auto ref_reduce_invoker = ref_reduce.MakeInvoker();
+
+        auto ref_reduce_argument = ref_reduce.MakeArgument(
+            {M, N},
+            {static_cast<ck::index_t>(c_strides[0]), static_cast<ck::index_t>(c_strides[1])},
+            {M},
+            {{{1}, {1}}},
+            {1},
+            {1.0, 1.0},
+            {0.0, 0.0},
+            c_m_n_host_result.mData.data(),
+            {reduce0_m_host_result.mData.data(), reduce1_m_host_result.mData.data()},
+            {nullptr, nullptr},
+            ck::make_tuple(passthrough, square),
+            ck::make_tuple(div, div));
+
+        ref_reduce_invoker.Run(ref_reduce_argument);
     }
 
     DeviceMem a_device_buf(sizeof(ADataType) * a_m_k.mDesc.GetElementSpaceSize());
@@ -21,6 +21,8 @@
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
 
+#include "profiler/profile_timing_options.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -203,8 +205,11 @@ bool profile_gemm_splitk_impl(int do_verification,
 
                 std::string op_name = op_ptr->GetTypeString();
 
+                ck::TimingStats timing_stats;
+
                 float ave_time = invoker_ptr->Run(
-                    argument_ptr.get(), StreamConfig{nullptr, time_kernel, 0, n_warmup, n_iter});
+                    argument_ptr.get(),
+                    make_profiler_stream_config(time_kernel, &timing_stats, n_warmup, n_iter));
 
                 std::size_t flop = std::size_t(2) * M * N * K;
 
@@ -219,6 +224,12 @@ bool profile_gemm_splitk_impl(int do_verification,
                           << " TFlops, " << gb_per_sec << " GB/s, " << op_name << ", KBatch "
                           << kbatch_curr << std::endl;
 
+                report_profiler_result(op_name + ", KBatch " + std::to_string(kbatch_curr),
+                                       ave_time,
+                                       tflops,
+                                       gb_per_sec,
+                                       timing_stats);
+
 #if defined CK_ENABLE_FP8
                 // set softer tolerances for fp8
                 if constexpr(is_same_v<ADataType, f8_t> || is_same_v<BDataType, f8_t> ||
@@ -24,6 +24,8 @@
 #include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_conv_bwd_weight.hpp"
 
+#include "profiler/profile_timing_options.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -194,8 +196,10 @@ bool profile_grouped_conv_bwd_weight_impl(int do_verification,
 
             auto invoker_ptr = op_ptr->MakeInvokerPointer();
 
-            float avg_time =
-                invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+            ck::TimingStats timing_stats;
+
+            float avg_time = invoker_ptr->Run(
+                argument_ptr.get(), make_profiler_stream_config(time_kernel, &timing_stats));
 
             std::size_t flop      = conv_param.GetFlops();
             std::size_t num_btype = conv_param.GetByte<InDataType, WeiDataType, OutDataType>();
@@ -206,6 +210,8 @@ bool profile_grouped_conv_bwd_weight_impl(int do_verification,
             std::cout << "Perf: " << std::setw(10) << avg_time << " ms, " << tflops << " TFlops, "
                       << gb_per_sec << " GB/s, " << op_name << std::endl;
 
+            report_profiler_result(op_name, avg_time, tflops, gb_per_sec, timing_stats);
+
             if(tflops > best_tflops)
             {
                 best_op_name    = op_name;
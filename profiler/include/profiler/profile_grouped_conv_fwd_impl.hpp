@@ -11,6 +11,7 @@
 #include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
 #include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
 
+#include "ck/library/tensor_operation_instance/gpu/batched_gemm.hpp"
 #include "ck/library/tensor_operation_instance/gpu/grouped_convolution_forward.hpp"
 
 #include "ck/library/utility/algorithm.hpp"
@@ -19,9 +20,12 @@
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/utility/convolution_parameter.hpp"
+#include "ck/library/utility/convolution_gemm_canonicalization.hpp"
 #include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd.hpp"
 
+#include "profiler/profile_timing_options.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -31,7 +35,8 @@ template <ck::index_t NDimSpatial,
           typename OutLayout,
           typename InDataType,
           typename WeiDataType,
-          typename OutDataType>
+          typename OutDataType,
+          bool ProfileGemmInstances = false>
 bool profile_grouped_conv_fwd_impl(int do_verification,
                                    int init_method,
                                    bool do_log,
@@ -154,8 +159,10 @@ bool profile_grouped_conv_fwd_impl(int do_verification,
 
             auto invoker_ptr = op_ptr->MakeInvokerPointer();
 
-            float avg_time =
-                invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+            ck::TimingStats timing_stats;
+
+            float avg_time = invoker_ptr->Run(
+                argument_ptr.get(), make_profiler_stream_config(time_kernel, &timing_stats));
 
             std::size_t flop      = conv_param.GetFlops();
             std::size_t num_btype = conv_param.GetByte<InDataType, WeiDataType, OutDataType>();
@@ -167,6 +174,8 @@ bool profile_grouped_conv_fwd_impl(int do_verification,
             std::cout << "Perf: " << std::setw(10) << avg_time << " ms, " << tflops << " TFlops, "
                       << gb_per_sec << " GB/s, " << op_name << std::endl;
 
+            report_profiler_result(op_name, avg_time, tflops, gb_per_sec, timing_stats);
+
             if(tflops > best_tflops)
             {
                 best_op_name    = op_name;
@@ -242,6 +251,66 @@ bool profile_grouped_conv_fwd_impl(int do_verification,
         run_impl(op_ptr, argument_ptr);
     }
 
+    // with ProfileGemmInstances, a convolution that is a GEMM on the memory of its tensors (e.g.
+    // 1x1 stride 1 filters without padding) also runs the batched GEMM instances and the best of
+    // both is reported; only then are the batched GEMM instances needed
+    if constexpr(ProfileGemmInstances)
+    {
+        using Row = ck::tensor_layout::gemm::RowMajor;
+        using Col = ck::tensor_layout::gemm::ColumnMajor;
+
+        using GemmDeviceOp = ck::tensor_operation::device::DeviceBatchedGemm<Row,
+                                                                             Col,
+                                                                             Row,
+                                                                             InDataType,
+                                                                             WeiDataType,
+                                                                             OutDataType,
+                                                                             InElementOp,
+                                                                             WeiElementOp,
+                                                                             OutElementOp>;
+
+        ck::utils::conv::ConvFwdGemmProblem gemm_problem;
+
+        if(!ck::utils::conv::get_conv_fwd_gemm_problem(
+               conv_param, in_g_n_c_wis_desc, wei_g_k_c_xs_desc, out_g_n_k_wos_desc, gemm_problem))
+        {
+            std::cout << "convolution is not a batched gemm" << std::endl;
+        }
+        else
+        {
+            const auto gemm_op_ptrs = ck::tensor_operation::device::instance::
+                DeviceOperationInstanceFactory<GemmDeviceOp>::GetInstances();
+
+            std::cout << "convolution is a batched gemm (G " << gemm_problem.G_ << ", M "
+                      << gemm_problem.M_ << ", N " << gemm_problem.N_ << ", K "
+                      << gemm_problem.K_ << "), ckProfiler found " << gemm_op_ptrs.size()
+                      << " gemm instances" << std::endl;
+
+            for(auto& op_ptr : gemm_op_ptrs)
+            {
+                auto argument_ptr =
+                    op_ptr->MakeArgumentPointer(in_device_buf.GetDeviceBuffer(),
+                                                wei_device_buf.GetDeviceBuffer(),
+                                                out_device_buf.GetDeviceBuffer(),
+                                                gemm_problem.M_,
+                                                gemm_problem.N_,
+                                                gemm_problem.K_,
+                                                gemm_problem.StrideA_,
+                                                gemm_problem.StrideB_,
+                                                gemm_problem.StrideE_,
+                                                gemm_problem.BatchStrideA_,
+                                                gemm_problem.BatchStrideB_,
+                                                gemm_problem.BatchStrideE_,
+                                                gemm_problem.G_,
+                                                in_element_op,
+                                                wei_element_op,
+                                                out_element_op);
+
+                run_impl(op_ptr, argument_ptr);
+            }
+        }
+    }
+
     std::cout << "Best configuration parameters:"
               << "\nname: " << best_op_name << "\navg_time: " << best_avg_time
               << "\ntflops: " << best_tflops << "\nGB/s: " << best_gb_per_sec << std::endl;
@@ -20,7 +20,9 @@
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/utility/fill.hpp"
-#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_grouped_gemm.hpp"
+
+#include "profiler/profile_timing_options.hpp"
 
 namespace ck {
 namespace profiler {
@@ -181,28 +183,21 @@ bool profile_grouped_gemm_impl(int do_verification,
 
     if(do_verification)
     {
-        for(std::size_t i = 0; i < gemm_descs.size(); i++)
-        {
-            using ReferenceGemmInstance = ck::tensor_operation::host::ReferenceGemm<ADataType,
-                                                                                    BDataType,
-                                                                                    CDataType,
-                                                                                    AccDataType,
-                                                                                    AElementOp,
-                                                                                    BElementOp,
-                                                                                    CElementOp>;
-
-            auto ref_gemm    = ReferenceGemmInstance{};
-            auto ref_invoker = ref_gemm.MakeInvoker();
-
-            auto ref_argument = ref_gemm.MakeArgument(a_m_k[i],
-                                                      b_k_n[i],
-                                                      c_m_n_host_results[i],
-                                                      a_element_op,
-                                                      b_element_op,
-                                                      c_element_op);
-
-            ref_invoker.Run(ref_argument);
-        }
+        using ReferenceGemmInstance = ck::tensor_operation::host::ReferenceGroupedGemm<ADataType,
+                                                                                      BDataType,
+                                                                                      CDataType,
+                                                                                      AccDataType,
+                                                                                      AElementOp,
+                                                                                      BElementOp,
+                                                                                      CElementOp>;
+
+        auto ref_gemm    = ReferenceGemmInstance{};
+        auto ref_invoker = ref_gemm.MakeInvoker();
+
+        auto ref_argument = ref_gemm.MakeArgument(
+            a_m_k, b_k_n, c_m_n_host_results, a_element_op, b_element_op, c_element_op);
+
+        ref_invoker.Run(ref_argument);
     }
 
     // profile device GEMM instances
@@ -310,8 +305,11 @@ bool profile_grouped_gemm_impl(int do_verification,
                     pass = pass && instance_pass;
                 }
 
+                ck::TimingStats timing_stats;
+
                 float ave_time = invoker_ptr->Run(
-                    argument_ptr.get(), StreamConfig{nullptr, time_kernel, 0, n_warmup, n_iter});
+                    argument_ptr.get(),
+                    make_profiler_stream_config(time_kernel, &timing_stats, n_warmup, n_iter));
 
                 if(time_kernel)
                 {
@@ -332,6 +330,12 @@ bool profile_grouped_gemm_impl(int do_verification,
                               << " TFlops, " << gb_per_sec << " GB/s, " << gemm_name << ", KBatch "
                               << kbatch_curr << std::endl;
 
+                    report_profiler_result(gemm_name + ", KBatch " + std::to_string(kbatch_curr),
+                                           ave_time,
+                                           tflops,
+                                           gb_per_sec,
+                                           timing_stats);
+
                     if(tflops > best_tflops)
                     {
                         best_gemm_name  = gemm_name;
@@ -0,0 +1,428 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/host_utility/device_prop.hpp"
+#include "ck/host_utility/io.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/device/device_gemm.hpp"
+#include "ck/tensor_operation/gpu/device/device_reduce.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/tensor_operation/gpu/device/reduction_operator_mapping.hpp"
+
+#include "ck/library/tensor_operation_instance/gpu/gemm.hpp"
+#include "ck/library/tensor_operation_instance/gpu/grouped_convolution_forward.hpp"
+#include "ck/library/tensor_operation_instance/gpu/reduce/reduce.hpp"
+
+#include "ck/library/utility/algorithm.hpp"
+#include "ck/library/utility/convolution_parameter.hpp"
+#include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
+
+namespace ck {
+namespace profiler {
+
+// Number of heap allocations made by the process so far. Counted by the replaceable global
+// operator new of ckHostDispatch (host_allocation_counter.cpp), only defined there.
+std::size_t get_host_allocation_count();
+
+struct HostDispatchCallStats
+{
+    double us_per_call     = 0;
+    double allocs_per_call = 0;
+
+    void Accumulate(const HostDispatchCallStats& other)
+    {
+        us_per_call += other.us_per_call;
+        allocs_per_call += other.allocs_per_call;
+    }
+};
+
+struct HostDispatchStats
+{
+    std::string name;
+
+    HostDispatchCallStats make_argument;
+    HostDispatchCallStats is_supported;
+    HostDispatchCallStats make_invoker;
+    HostDispatchCallStats get_workspace_size;
+
+    bool supported = false;
+};
+
+template <typename F>
+HostDispatchCallStats time_host_call(F&& f, int nrepeat)
+{
+    const std::size_t allocs_begin = get_host_allocation_count();
+    const auto time_begin          = std::chrono::steady_clock::now();
+
+    for(int i = 0; i < nrepeat; ++i)
+    {
+        f();
+    }
+
+    const auto time_end          = std::chrono::steady_clock::now();
+    const std::size_t allocs_end = get_host_allocation_count();
+
+    HostDispatchCallStats stats;
+
+    stats.us_per_call =
+        std::chrono::duration<double, std::micro>(time_end - time_begin).count() / nrepeat;
+    stats.allocs_per_call = static_cast<double>(allocs_end - allocs_begin) / nrepeat;
+
+    return stats;
+}
+
+// Measure the host cost of the instance API for every instance in op_ptrs. make_argument(op_ptr)
+// has to return the std::unique_ptr<BaseArgument> of the problem under test.
+template <typename OpPtrs, typename MakeArgument>
+std::vector<HostDispatchStats>
+profile_host_dispatch_instances(const OpPtrs& op_ptrs, MakeArgument&& make_argument, int nrepeat)
+{
+    std::vector<HostDispatchStats> results;
+
+    for(auto& op_ptr : op_ptrs)
+    {
+        HostDispatchStats stats;
+
+        stats.name = op_ptr->GetTypeString();
+
+        stats.make_argument = time_host_call([&]() { make_argument(op_ptr); }, nrepeat);
+
+        auto argument_ptr = make_argument(op_ptr);
+
+        stats.supported = op_ptr->IsSupportedArgument(argument_ptr.get());
+
+        stats.is_supported = time_host_call(
+            [&]() {
+                volatile bool supported = op_ptr->IsSupportedArgument(argument_ptr.get());
+                (void)supported;
+            },
+            nrepeat);
+
+        stats.make_invoker = time_host_call([&]() { op_ptr->MakeInvokerPointer(); }, nrepeat);
+
+        stats.get_workspace_size = time_host_call(
+            [&]() {
+                volatile std::size_t size = op_ptr->GetWorkSpaceSize(argument_ptr.get());
+                (void)size;
+            },
+            nrepeat);
+
+        results.push_back(stats);
+    }
+
+    return results;
+}
+
+inline void report_host_dispatch(const std::string& family,
+                                 const std::string& problem,
+                                 const std::vector<HostDispatchStats>& results,
+                                 bool do_log)
+{
+    auto print_row = [](const std::string& name, const HostDispatchStats& s) {
+        std::cout << std::setw(14) << s.make_argument.us_per_call << std::setw(8)
+                  << s.make_argument.allocs_per_call << std::setw(14)
+                  << s.is_supported.us_per_call << std::setw(8) << s.is_supported.allocs_per_call
+                  << std::setw(14) << s.make_invoker.us_per_call << std::setw(8)
+                  << s.make_invoker.allocs_per_call << std::setw(14)
+                  << s.get_workspace_size.us_per_call << std::setw(8)
+                  << s.get_workspace_size.allocs_per_call << "  " << name << std::endl;
+    };
+
+    std::cout << "family: " << family << ", problem: " << problem
+              << ", instances: " << results.size() << std::endl;
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << std::setw(14) << "MakeArg us" << std::setw(8) << "allocs" << std::setw(14)
+              << "IsSupp us" << std::setw(8) << "allocs" << std::setw(14) << "MakeInv us"
+              << std::setw(8) << "allocs" << std::setw(14) << "WsSize us" << std::setw(8)
+              << "allocs" << std::endl;
+
+    HostDispatchStats total;
+    int num_supported = 0;
+
+    for(const auto& s : results)
+    {
+        if(do_log)
+        {
+            print_row((s.supported ? "[supported] " : "") + s.name, s);
+        }
+
+        total.make_argument.Accumulate(s.make_argument);
+        total.is_supported.Accumulate(s.is_supported);
+        total.make_invoker.Accumulate(s.make_invoker);
+        total.get_workspace_size.Accumulate(s.get_workspace_size);
+
+        num_supported += s.supported ? 1 : 0;
+    }
+
+    if(!results.empty())
+    {
+        const double n = static_cast<double>(results.size());
+
+        HostDispatchStats mean;
+
+        mean.make_argument      = {total.make_argument.us_per_call / n,
+                              total.make_argument.allocs_per_call / n};
+        mean.is_supported       = {total.is_supported.us_per_call / n,
+                             total.is_supported.allocs_per_call / n};
+        mean.make_invoker       = {total.make_invoker.us_per_call / n,
+                             total.make_invoker.allocs_per_call / n};
+        mean.get_workspace_size = {total.get_workspace_size.us_per_call / n,
+                                   total.get_workspace_size.allocs_per_call / n};
+
+        print_row("mean per instance", mean);
+        print_row("sum over all instances (one dispatch)", total);
+    }
+
+    std::cout << "supported instances: " << num_supported << std::endl;
+    std::cout.unsetf(std::ios_base::floatfield);
+}
+
+// Calls f(op_ptrs, make_argument) with the instances of the fp16 gemm with A[M, K] row-major,
+// B[N, K] column-major and C[M, N] row-major, and the argument maker of the problem
+template <typename F>
+decltype(auto) visit_host_dispatch_gemm(int M, int N, int K, F&& f)
+{
+    using Row         = tensor_layout::gemm::RowMajor;
+    using Col         = tensor_layout::gemm::ColumnMajor;
+    using PassThrough = tensor_operation::element_wise::PassThrough;
+
+    using DeviceOp = tensor_operation::device::
+        DeviceGemm<Row, Col, Row, half_t, half_t, half_t, PassThrough, PassThrough, PassThrough>;
+
+    const auto op_ptrs =
+        tensor_operation::device::instance::DeviceOperationInstanceFactory<DeviceOp>::GetInstances();
+
+    auto make_argument = [&](auto& op_ptr) {
+        return op_ptr->MakeArgumentPointer(nullptr,
+                                           nullptr,
+                                           nullptr,
+                                           M,
+                                           N,
+                                           K,
+                                           K,
+                                           K,
+                                           N,
+                                           PassThrough{},
+                                           PassThrough{},
+                                           PassThrough{});
+    };
+
+    return f(op_ptrs, make_argument);
+}
+
+// A[M, K] row-major, B[N, K] column-major, C[M, N] row-major, fp16
+inline bool
+profile_host_dispatch_gemm_impl(int M, int N, int K, int nrepeat, bool do_log)
+{
+    const auto results =
+        visit_host_dispatch_gemm(M, N, K, [&](const auto& op_ptrs, auto& make_argument) {
+            return profile_host_dispatch_instances(op_ptrs, make_argument, nrepeat);
+        });
+
+    report_host_dispatch("gemm (f16, MK_NK_MN)",
+                         std::to_string(M) + "x" + std::to_string(N) + "x" + std::to_string(K),
+                         results,
+                         do_log);
+
+    return true;
+}
+
+// Calls f(op_ptrs, make_argument) with the instances of the fp16 grouped convolution forward
+// with the given layouts, and the argument maker of the problem
+template <ck::index_t NDimSpatial,
+          typename InLayout,
+          typename WeiLayout,
+          typename OutLayout,
+          typename F>
+decltype(auto) visit_host_dispatch_grouped_conv_fwd(const ck::utils::conv::ConvParam& conv_param,
+                                                    F&& f)
+{
+    using PassThrough = tensor_operation::element_wise::PassThrough;
+
+    using DeviceOp = tensor_operation::device::DeviceGroupedConvFwdMultipleABD<NDimSpatial,
+                                                                               InLayout,
+                                                                               WeiLayout,
+                                                                               ck::Tuple<>,
+                                                                               OutLayout,
+                                                                               half_t,
+                                                                               half_t,
+                                                                               ck::Tuple<>,
+                                                                               half_t,
+                                                                               PassThrough,
+                                                                               PassThrough,
+                                                                               PassThrough>;
+
+    const auto in_g_n_c_wis_desc =
+        ck::utils::conv::make_input_host_tensor_descriptor_g_n_c_wis_packed<InLayout>(conv_param);
+
+    const auto wei_g_k_c_xs_desc =
+        ck::utils::conv::make_weight_host_tensor_descriptor_g_k_c_xs_packed<WeiLayout>(conv_param);
+
+    const auto out_g_n_k_wos_desc =
+        ck::utils::conv::make_output_host_tensor_descriptor_g_n_k_wos_packed<OutLayout>(conv_param);
+
+    std::array<ck::index_t, NDimSpatial + 3> a_g_n_c_wis_lengths{};
+    std::array<ck::index_t, NDimSpatial + 3> a_g_n_c_wis_strides{};
+    std::array<ck::index_t, NDimSpatial + 3> b_g_k_c_xs_lengths{};
+    std::array<ck::index_t, NDimSpatial + 3> b_g_k_c_xs_strides{};
+    std::array<ck::index_t, NDimSpatial + 3> e_g_n_k_wos_lengths{};
+    std::array<ck::index_t, NDimSpatial + 3> e_g_n_k_wos_strides{};
+    std::array<ck::index_t, NDimSpatial> conv_filter_strides{};
+    std::array<ck::index_t, NDimSpatial> conv_filter_dilations{};
+    std::array<ck::index_t, NDimSpatial> input_left_pads{};
+    std::array<ck::index_t, NDimSpatial> input_right_pads{};
+
+    auto copy = [](const auto& x, auto& y) { ck::ranges::copy(x, y.begin()); };
+
+    copy(in_g_n_c_wis_desc.GetLengths(), a_g_n_c_wis_lengths);
+    copy(in_g_n_c_wis_desc.GetStrides(), a_g_n_c_wis_strides);
+    copy(wei_g_k_c_xs_desc.GetLengths(), b_g_k_c_xs_lengths);
+    copy(wei_g_k_c_xs_desc.GetStrides(), b_g_k_c_xs_strides);
+    copy(out_g_n_k_wos_desc.GetLengths(), e_g_n_k_wos_lengths);
+    copy(out_g_n_k_wos_desc.GetStrides(), e_g_n_k_wos_strides);
+    copy(conv_param.conv_filter_strides_, conv_filter_strides);
+    copy(conv_param.conv_filter_dilations_, conv_filter_dilations);
+    copy(conv_param.input_left_pads_, input_left_pads);
+    copy(conv_param.input_right_pads_, input_right_pads);
+
+    const auto op_ptrs =
+        tensor_operation::device::instance::DeviceOperationInstanceFactory<DeviceOp>::GetInstances();
+
+    auto make_argument = [&](auto& op_ptr) {
+        return op_ptr->MakeArgumentPointer(nullptr,
+                                           nullptr,
+                                           {},
+                                           nullptr,
+                                           a_g_n_c_wis_lengths,
+                                           a_g_n_c_wis_strides,
+                                           b_g_k_c_xs_lengths,
+                                           b_g_k_c_xs_strides,
+                                           {},
+                                           {},
+                                           e_g_n_k_wos_lengths,
+                                           e_g_n_k_wos_strides,
+                                           conv_filter_strides,
+                                           conv_filter_dilations,
+                                           input_left_pads,
+                                           input_right_pads,
+                                           PassThrough{},
+                                           PassThrough{},
+                                           PassThrough{});
+    };
+
+    return f(op_ptrs, make_argument);
+}
+
+// Grouped convolution forward of fp16 tensors in the given layouts
+template <ck::index_t NDimSpatial, typename InLayout, typename WeiLayout, typename OutLayout>
+bool profile_host_dispatch_grouped_conv_fwd_impl(const ck::utils::conv::ConvParam& conv_param,
+                                                 int nrepeat,
+                                                 bool do_log)
+{
+    const auto results =
+        visit_host_dispatch_grouped_conv_fwd<NDimSpatial, InLayout, WeiLayout, OutLayout>(
+            conv_param, [&](const auto& op_ptrs, auto& make_argument) {
+                return profile_host_dispatch_instances(op_ptrs, make_argument, nrepeat);
+            });
+
+    std::ostringstream problem;
+    problem << "G " << conv_param.G_ << ", N " << conv_param.N_ << ", K " << conv_param.K_
+            << ", C " << conv_param.C_ << ", filter " << conv_param.filter_spatial_lengths_
+            << ", input " << conv_param.input_spatial_lengths_;
+
+    std::ostringstream op_name;
+    op_name << "grouped_conv_fwd" << NDimSpatial << "d (f16, " << InLayout::name << "_"
+            << WeiLayout::name << "_" << OutLayout::name << ")";
+
+    report_host_dispatch(op_name.str(), problem.str(), results, do_log);
+
+    return true;
+}
+
+// ADD reduction of a rank-4 fp16 tensor over dims {1, 2, 3}, fp32 accumulation
+inline bool profile_host_dispatch_reduce_impl(const std::array<index_t, 4>& in_lengths,
+                                              int nrepeat,
+                                              bool do_log)
+{
+    constexpr index_t Rank         = 4;
+    constexpr index_t NumReduceDim = 3;
+
+    constexpr auto ReduceOpId = ReduceTensorOp::ADD;
+
+    using InElementwiseOperation =
+        typename reduce_unary_operator<ReduceOpId, true, true>::InElementwiseOperation;
+    using AccElementwiseOperation =
+        typename reduce_unary_operator<ReduceOpId, true, true>::AccElementwiseOperation;
+    using ReduceOperation = typename reduce_binary_operator<ReduceOpId>::opType;
+
+    using DeviceOp = tensor_operation::device::DeviceReduce<half_t,
+                                                            float,
+                                                            half_t,
+                                                            Rank,
+                                                            NumReduceDim,
+                                                            ReduceOperation,
+                                                            InElementwiseOperation,
+                                                            AccElementwiseOperation,
+                                                            false,
+                                                            false>;
+
+    const index_t reduce_total_length = in_lengths[1] * in_lengths[2] * in_lengths[3];
+
+    InElementwiseOperation in_elementwise_op;
+    AccElementwiseOperation acc_elementwise_op;
+
+    std::tie(in_elementwise_op, acc_elementwise_op) =
+        reduce_unary_operator<ReduceOpId, true, true>::GetElementwiseOperator(
+            static_cast<int32_t>(reduce_total_length));
+
+    const std::array<index_t, Rank> in_strides{
+        in_lengths[1] * in_lengths[2] * in_lengths[3], in_lengths[2] * in_lengths[3], in_lengths[3], 1};
+    const std::array<index_t, 1> out_lengths{in_lengths[0]};
+    const std::array<index_t, 1> out_strides{1};
+    const std::array<int, NumReduceDim> reduce_dims{1, 2, 3};
+
+    const auto op_ptrs =
+        tensor_operation::device::instance::DeviceOperationInstanceFactory<DeviceOp>::GetInstances();
+
+    auto make_argument = [&](auto& op_ptr) {
+        return op_ptr->MakeArgumentPointer(in_lengths,
+                                           in_strides,
+                                           out_lengths,
+                                           out_strides,
+                                           reduce_dims,
+                                           1.0,
+                                           0.0,
+                                           nullptr,
+                                           nullptr,
+                                           nullptr,
+                                           nullptr,
+                                           in_elementwise_op,
+                                           acc_elementwise_op);
+    };
+
+    const auto results = profile_host_dispatch_instances(op_ptrs, make_argument, nrepeat);
+
+    report_host_dispatch("reduce (f16 -> f16, ADD, rank 4, reduce {1, 2, 3})",
+                         std::to_string(in_lengths[0]) + "x" + std::to_string(in_lengths[1]) +
+                             "x" + std::to_string(in_lengths[2]) + "x" +
+                             std::to_string(in_lengths[3]),
+                         results,
+                         do_log);
+
+    return true;
+}
+
+} // namespace profiler
+} // namespace ck
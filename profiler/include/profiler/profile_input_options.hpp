@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_file.hpp"
+
+namespace ck {
+namespace profiler {
+
+// Input options of the operations that can load their inputs, given before the operation name:
+//   ckProfiler [--replay=<a>,<b>[,<d0>...]] op ...
+struct ProfilerInputOptions
+{
+    // tensor files that replace the generated A, B and D inputs, an empty entry keeps the generated
+    // input, see replay_profiler_input()
+    std::vector<std::string> replay_paths_;
+};
+
+inline ProfilerInputOptions& get_profiler_input_options()
+{
+    static ProfilerInputOptions options;
+
+    return options;
+}
+
+inline void print_profiler_input_options_help()
+{
+    std::cout << "input options (before the tensor operation):\n"
+              << "  --replay=<a>,<b>[,<d0>...]\n"
+              << "                         load the A, B and D inputs from .npy tensor files\n"
+              << "                         instead of generating them (gemm, gemm_bilinear,\n"
+              << "                         gemm_multiply_add)" << std::endl;
+}
+
+// apply one input option, returns false if arg is not an input option
+inline bool parse_profiler_input_option(const std::string& arg)
+{
+    auto& options = get_profiler_input_options();
+
+    if(arg.rfind("--replay=", 0) != 0)
+    {
+        return false;
+    }
+
+    const std::string paths = arg.substr(std::strlen("--replay="));
+
+    options.replay_paths_.clear();
+
+    for(std::size_t begin = 0, end = 0; end != std::string::npos; begin = end + 1)
+    {
+        end = paths.find(',', begin);
+        options.replay_paths_.push_back(paths.substr(begin, end - begin));
+    }
+
+    return true;
+}
+
+// Replaces input i of the operation (0: A, 1: B, 2 and up: the Ds) by the i-th --replay file,
+// which must have the lengths of the input; returns whether there was one
+template <typename T>
+bool replay_profiler_input(std::size_t i, Tensor<T>& tensor)
+{
+    const auto& paths = get_profiler_input_options().replay_paths_;
+
+    if(i >= paths.size() || paths[i].empty())
+    {
+        return false;
+    }
+
+    ck::utils::HostTensorFile file(paths[i]);
+
+    ck::utils::load_host_tensor(file, tensor);
+
+    std::cout << "input " << i << " replayed from " << paths[i] << std::endl;
+
+    return true;
+}
+
+} // namespace profiler
+} // namespace ck
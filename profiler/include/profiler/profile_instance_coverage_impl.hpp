@@ -0,0 +1,286 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "profiler/profile_host_dispatch_impl.hpp"
+
+namespace ck {
+namespace profiler {
+
+// How well the instances of a family serve a problem:
+//   Full:        an instance without padding and, if the problem allows one, with the most
+//                specific convolution specialization supports it
+//   PaddedOnly:  only instances that pad M, N or K (GemmSpecialization::*Padding) support it
+//   GenericOnly: the problem allows a convolution specialization (e.g. Filter1x1Stride1Pad0),
+//                but only instances with a less specific one (e.g. Default or Filter1x1Pad0)
+//                support it
+//   Unknown:     no instance known to be unpadded supports it, but some of the supporting
+//                instances do not report their GemmSpecialization
+//   None:        no instance supports it
+enum struct InstanceCoverage
+{
+    Full,
+    PaddedOnly,
+    GenericOnly,
+    Unknown,
+    None,
+};
+
+inline const char* get_instance_coverage_string(InstanceCoverage coverage)
+{
+    switch(coverage)
+    {
+    case InstanceCoverage::Full: return "full";
+    case InstanceCoverage::PaddedOnly: return "padded only";
+    case InstanceCoverage::GenericOnly: return "generic only";
+    case InstanceCoverage::Unknown: return "unknown";
+    case InstanceCoverage::None: return "none";
+    default: return "unknown";
+    }
+}
+
+struct InstanceCoverageResult
+{
+    std::string problem;
+    std::string allowed_specialization; // most specific convolution specialization, if any
+    std::size_t num_instance = 0;
+    std::vector<std::string> supported; // GetTypeString() of the supporting instances
+
+    InstanceCoverage coverage = InstanceCoverage::None;
+};
+
+// Whether the type string of an instance contains token as a whole word. The specialization of
+// a type erased instance is only visible in its type string.
+inline bool has_type_string_token(const std::string& type_string, const std::string& token)
+{
+    auto is_word = [](char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '_'; };
+
+    for(auto pos = type_string.find(token); pos != std::string::npos;
+        pos      = type_string.find(token, pos + 1))
+    {
+        const auto end = pos + token.size();
+
+        if((pos == 0 || !is_word(type_string[pos - 1])) &&
+           (end == type_string.size() || !is_word(type_string[end])))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// GetTypeString() of every instance in op_ptrs whose IsSupportedArgument() accepts the problem,
+// f(op_ptr) is called for each of them
+template <typename OpPtrs, typename MakeArgument, typename F>
+std::vector<std::string>
+get_supported_instances(const OpPtrs& op_ptrs, MakeArgument&& make_argument, F&& f)
+{
+    std::vector<std::string> supported;
+
+    for(auto& op_ptr : op_ptrs)
+    {
+        auto argument_ptr = make_argument(op_ptr);
+
+        if(op_ptr->IsSupportedArgument(argument_ptr.get()))
+        {
+            supported.push_back(op_ptr->GetTypeString());
+            f(op_ptr);
+        }
+    }
+
+    return supported;
+}
+
+// fp16 gemm with A[M, K] row-major, B[N, K] column-major and C[M, N] row-major
+inline InstanceCoverageResult get_instance_coverage_gemm(int M, int N, int K)
+{
+    InstanceCoverageResult result;
+
+    result.problem = "gemm " + std::to_string(M) + " " + std::to_string(N) + " " +
+                     std::to_string(K);
+
+    bool any_unpadded = false;
+    bool any_unknown  = false;
+
+    // not every instance prints its GemmSpecialization, so it is queried from the instance
+    visit_host_dispatch_gemm(M, N, K, [&](const auto& op_ptrs, auto& make_argument) {
+        result.num_instance = op_ptrs.size();
+        result.supported    = get_supported_instances(op_ptrs, make_argument, [&](auto& op_ptr) {
+            const auto gemm_spec = op_ptr->GetGemmSpecialization();
+
+            any_unpadded = any_unpadded ||
+                           gemm_spec == tensor_operation::device::GemmSpecialization::Default;
+            any_unknown  = any_unknown || !gemm_spec.has_value();
+        });
+    });
+
+    if(any_unpadded)
+    {
+        result.coverage = InstanceCoverage::Full;
+    }
+    else if(any_unknown)
+    {
+        result.coverage = InstanceCoverage::Unknown;
+    }
+    else if(!result.supported.empty())
+    {
+        result.coverage = InstanceCoverage::PaddedOnly;
+    }
+
+    return result;
+}
+
+// fp16 grouped convolution forward with channels last layouts
+template <ck::index_t NDimSpatial, typename InLayout, typename WeiLayout, typename OutLayout>
+InstanceCoverageResult
+get_instance_coverage_grouped_conv_fwd(const ck::utils::conv::ConvParam& conv_param)
+{
+    InstanceCoverageResult result;
+
+    std::ostringstream problem;
+    problem << "grouped_conv_fwd " << NDimSpatial << " " << conv_param.G_ << " " << conv_param.N_
+            << " " << conv_param.K_ << " " << conv_param.C_;
+
+    for(const auto* values : {&conv_param.filter_spatial_lengths_,
+                              &conv_param.input_spatial_lengths_,
+                              &conv_param.conv_filter_strides_,
+                              &conv_param.conv_filter_dilations_,
+                              &conv_param.input_left_pads_,
+                              &conv_param.input_right_pads_})
+    {
+        for(const auto value : *values)
+        {
+            problem << " " << value;
+        }
+    }
+
+    result.problem = problem.str();
+
+    auto all_equal = [](const std::vector<ck::index_t>& values, ck::index_t value) {
+        return std::all_of(values.begin(), values.end(), [&](auto v) { return v == value; });
+    };
+
+    if(all_equal(conv_param.filter_spatial_lengths_, 1) &&
+       all_equal(conv_param.input_left_pads_, 0) && all_equal(conv_param.input_right_pads_, 0))
+    {
+        result.allowed_specialization = all_equal(conv_param.conv_filter_strides_, 1)
+                                            ? "Filter1x1Stride1Pad0"
+                                            : "Filter1x1Pad0";
+    }
+
+    visit_host_dispatch_grouped_conv_fwd<NDimSpatial, InLayout, WeiLayout, OutLayout>(
+        conv_param, [&](const auto& op_ptrs, auto& make_argument) {
+            result.num_instance = op_ptrs.size();
+            result.supported    = get_supported_instances(op_ptrs, make_argument, [](auto&) {});
+        });
+
+    // OddC does not depend on the filter, so only the allowed specialization itself counts
+    const bool any_specialized =
+        std::any_of(result.supported.begin(), result.supported.end(), [&](const auto& name) {
+            return has_type_string_token(name, result.allowed_specialization);
+        });
+
+    if(result.supported.empty())
+    {
+        result.coverage = InstanceCoverage::None;
+    }
+    else if(!result.allowed_specialization.empty() && !any_specialized)
+    {
+        result.coverage = InstanceCoverage::GenericOnly;
+    }
+    else
+    {
+        result.coverage = InstanceCoverage::Full;
+    }
+
+    return result;
+}
+
+// Per problem coverage and its supporting instances (do_log), then the problems of every family
+// that are not fully covered. Returns the number of problems without any instance.
+inline std::size_t report_instance_coverage(const std::string& arch,
+                                            const std::vector<InstanceCoverageResult>& results,
+                                            bool do_log)
+{
+    std::vector<std::string> families;
+
+    auto get_family = [](const InstanceCoverageResult& result) {
+        return result.problem.substr(0, result.problem.find(' '));
+    };
+
+    std::cout << "arch: " << arch << ", problems: " << results.size() << std::endl;
+
+    for(const auto& result : results)
+    {
+        std::cout << result.problem << "  # " << get_instance_coverage_string(result.coverage)
+                  << ", " << result.supported.size() << " of " << result.num_instance
+                  << " instances";
+
+        if(!result.allowed_specialization.empty())
+        {
+            std::cout << ", allows " << result.allowed_specialization;
+        }
+
+        std::cout << std::endl;
+
+        if(do_log)
+        {
+            for(const auto& name : result.supported)
+            {
+                std::cout << "    " << name << std::endl;
+            }
+        }
+
+        if(std::find(families.begin(), families.end(), get_family(result)) == families.end())
+        {
+            families.push_back(get_family(result));
+        }
+    }
+
+    std::size_t num_none = 0;
+
+    for(const auto& family : families)
+    {
+        std::size_t counts[5] = {};
+        std::vector<const InstanceCoverageResult*> gaps;
+
+        for(const auto& result : results)
+        {
+            if(get_family(result) == family)
+            {
+                counts[static_cast<int>(result.coverage)] += 1;
+
+                if(result.coverage != InstanceCoverage::Full)
+                {
+                    gaps.push_back(&result);
+                }
+            }
+        }
+
+        std::cout << family << ": " << counts[0] << " full, " << counts[1] << " padded only, "
+                  << counts[2] << " generic only, " << counts[3] << " unknown, " << counts[4]
+                  << " none" << std::endl;
+
+        for(const auto* gap : gaps)
+        {
+            std::cout << "  " << get_instance_coverage_string(gap->coverage) << ": "
+                      << gap->problem << std::endl;
+        }
+
+        num_none += counts[static_cast<int>(InstanceCoverage::None)];
+    }
+
+    return num_none;
+}
+
+} // namespace profiler
+} // namespace ck
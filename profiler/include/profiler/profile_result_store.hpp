@@ -0,0 +1,236 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ck {
+namespace profiler {
+
+// One timed instance. The problem is the shape arguments of the operation, see
+// set_profiler_problem(), the instance is the type string of the device op, times are in ms.
+struct ProfilerResultRecord
+{
+    long long timestamp_ = 0;
+    std::string operation_;
+    std::string problem_;
+    std::string instance_;
+    float ave_time_   = 0;
+    float tflops_     = 0;
+    float gb_per_sec_ = 0;
+    std::vector<float> samples_;
+
+    std::string Key() const { return operation_ + '\t' + problem_ + '\t' + instance_; }
+};
+
+// Results are kept in a single append-only text file, one record per line with tab separated
+// fields:
+//   timestamp operation problem instance ave_time tflops gb_per_sec sample,sample,...
+// Appending never rewrites existing records, so several runs (or several processes) can share one
+// store, and records of the same problem and instance from different runs are pooled on reading.
+inline constexpr const char* ProfilerResultStoreHeader = "#ck-profiler-results v1";
+
+namespace detail {
+
+inline std::string sanitize_result_field(std::string field)
+{
+    std::replace_if(
+        field.begin(), field.end(), [](char c) { return c == '\t' || c == '\n' || c == '\r'; }, ' ');
+
+    return field.empty() ? "-" : field;
+}
+
+inline std::vector<std::string> split_result_line(const std::string& line, char delimiter)
+{
+    std::vector<std::string> fields;
+    std::string field;
+    std::istringstream is(line);
+
+    while(std::getline(is, field, delimiter))
+    {
+        fields.push_back(field);
+    }
+
+    return fields;
+}
+
+} // namespace detail
+
+inline void append_profiler_result(const std::string& path, const ProfilerResultRecord& record)
+{
+    bool is_new = false;
+
+    {
+        std::ifstream probe(path);
+
+        is_new = !probe.good() || probe.peek() == std::ifstream::traits_type::eof();
+    }
+
+    std::ofstream os(path, std::ios::app);
+
+    if(!os)
+    {
+        throw std::runtime_error("wrong! cannot open result store " + path);
+    }
+
+    if(is_new)
+    {
+        os << ProfilerResultStoreHeader << '\n';
+    }
+
+    os << record.timestamp_ << '\t' << detail::sanitize_result_field(record.operation_) << '\t'
+       << detail::sanitize_result_field(record.problem_) << '\t'
+       << detail::sanitize_result_field(record.instance_) << '\t' << record.ave_time_ << '\t'
+       << record.tflops_ << '\t' << record.gb_per_sec_ << '\t';
+
+    for(std::size_t i = 0; i < record.samples_.size(); ++i)
+    {
+        os << (i > 0 ? "," : "") << record.samples_[i];
+    }
+
+    os << '\n';
+}
+
+inline std::vector<ProfilerResultRecord> read_profiler_results(const std::string& path)
+{
+    std::ifstream is(path);
+
+    if(!is)
+    {
+        throw std::runtime_error("wrong! cannot open result store " + path);
+    }
+
+    std::vector<ProfilerResultRecord> records;
+    std::string line;
+
+    if(!std::getline(is, line) || line != ProfilerResultStoreHeader)
+    {
+        throw std::runtime_error("wrong! " + path + " is not a ckProfiler result store");
+    }
+
+    while(std::getline(is, line))
+    {
+        if(line.empty() || line[0] == '#')
+        {
+            continue;
+        }
+
+        const auto fields = detail::split_result_line(line, '\t');
+
+        // a record cut short by an interrupted run is skipped
+        if(fields.size() < 7)
+        {
+            continue;
+        }
+
+        ProfilerResultRecord record;
+
+        record.timestamp_  = std::stoll(fields[0]);
+        record.operation_  = fields[1];
+        record.problem_    = fields[2];
+        record.instance_   = fields[3];
+        record.ave_time_   = std::stof(fields[4]);
+        record.tflops_     = std::stof(fields[5]);
+        record.gb_per_sec_ = std::stof(fields[6]);
+
+        if(fields.size() > 7)
+        {
+            for(const auto& sample : detail::split_result_line(fields[7], ','))
+            {
+                if(!sample.empty())
+                {
+                    record.samples_.push_back(std::stof(sample));
+                }
+            }
+        }
+
+        records.push_back(std::move(record));
+    }
+
+    return records;
+}
+
+// Two-sided p-value of the Mann-Whitney U test that x and y come from the same distribution,
+// using the normal approximation with tie and continuity correction. Unlike a t-test it does not
+// assume normally distributed times, which kernel timings with their long right tail are not.
+inline double mann_whitney_p_value(const std::vector<float>& x, const std::vector<float>& y)
+{
+    const std::size_t n1 = x.size();
+    const std::size_t n2 = y.size();
+    const std::size_t n  = n1 + n2;
+
+    if(n1 == 0 || n2 == 0)
+    {
+        return 1;
+    }
+
+    // (value, belongs to x)
+    std::vector<std::pair<float, bool>> all;
+
+    all.reserve(n);
+
+    for(float v : x)
+    {
+        all.emplace_back(v, true);
+    }
+
+    for(float v : y)
+    {
+        all.emplace_back(v, false);
+    }
+
+    std::sort(all.begin(), all.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    double rank_sum_x = 0;
+    double tie_term   = 0;
+
+    for(std::size_t i = 0; i < n;)
+    {
+        std::size_t j = i;
+
+        while(j < n && all[j].first == all[i].first)
+        {
+            ++j;
+        }
+
+        // tied values share the average of their 1-based ranks
+        const double rank = 0.5 * (i + 1 + j);
+        const double t    = static_cast<double>(j - i);
+
+        for(std::size_t k = i; k < j; ++k)
+        {
+            if(all[k].second)
+            {
+                rank_sum_x += rank;
+            }
+        }
+
+        tie_term += t * t * t - t;
+
+        i = j;
+    }
+
+    const double u1   = rank_sum_x - 0.5 * n1 * (n1 + 1);
+    const double mean = 0.5 * n1 * n2;
+    const double var  = n1 * n2 / 12.0 * ((n + 1) - tie_term / (static_cast<double>(n) * (n - 1)));
+
+    if(var <= 0)
+    {
+        return 1;
+    }
+
+    const double z = std::max(0.0, std::abs(u1 - mean) - 0.5) / std::sqrt(var);
+
+    return std::erfc(z / std::sqrt(2.0));
+}
+
+} // namespace profiler
+} // namespace ck
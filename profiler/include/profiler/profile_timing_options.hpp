@@ -0,0 +1,195 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <ctime>
+#include <initializer_list>
+#include <string>
+#include <utility>
+
+#include "ck/stream_config.hpp"
+#include "ck/host_utility/kernel_timer.hpp"
+
+#include "profiler/profile_result_store.hpp"
+
+namespace ck {
+namespace profiler {
+
+// Timing options shared by all operations, given before the operation name:
+//   ckProfiler [--stats] [--flush-cache=<MiB>] [--reject-outliers] [--warmup-until-stable]
+//              [--store=<file>] op ...
+struct ProfilerTimingOptions
+{
+    bool stats_                    = false;
+    std::size_t flush_cache_bytes_ = 0;
+    bool reject_outliers_          = false;
+    bool warmup_until_stable_      = false;
+
+    // result store that every timed instance is appended to, see profile_result_store.hpp
+    std::string store_path_;
+
+    // operation name and its shape arguments, identify the problem of the stored records
+    std::string operation_;
+    std::string problem_;
+
+    // the store keeps the per-iteration samples, so storing implies per-iteration timing
+    bool Enabled() const
+    {
+        return stats_ || flush_cache_bytes_ > 0 || reject_outliers_ || warmup_until_stable_ ||
+               !store_path_.empty();
+    }
+};
+
+inline ProfilerTimingOptions& get_profiler_timing_options()
+{
+    static ProfilerTimingOptions options;
+
+    return options;
+}
+
+inline void print_profiler_timing_options_help()
+{
+    std::cout << "timing options (before the tensor operation):\n"
+              << "  --stats                per-iteration min/median/p90/p99/stddev\n"
+              << "  --flush-cache=<MiB>    overwrite a scratch buffer before every iteration\n"
+              << "  --reject-outliers      drop samples outside Tukey's fences\n"
+              << "  --warmup-until-stable  keep warming up until iteration times settle\n"
+              << "  --store=<file>         append every timed instance to a result store, see\n"
+              << "                         \"ckProfiler compare\"" << std::endl;
+}
+
+// apply one timing option, returns false if arg is not a timing option
+inline bool parse_profiler_timing_option(const std::string& arg)
+{
+    auto& options = get_profiler_timing_options();
+
+    if(arg == "--stats")
+    {
+        options.stats_ = true;
+    }
+    else if(arg.rfind("--flush-cache=", 0) == 0)
+    {
+        options.flush_cache_bytes_ =
+            std::stoull(arg.substr(std::strlen("--flush-cache="))) * 1024 * 1024;
+    }
+    else if(arg == "--reject-outliers")
+    {
+        options.reject_outliers_ = true;
+    }
+    else if(arg == "--warmup-until-stable")
+    {
+        options.warmup_until_stable_ = true;
+    }
+    else if(arg.rfind("--store=", 0) == 0)
+    {
+        options.store_path_ = arg.substr(std::strlen("--store="));
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+// remember the operation being profiled, argv without the timing options; all its arguments are
+// the problem until the operation calls set_profiler_problem()
+inline void set_profiler_invocation(int argc, char* argv[])
+{
+    auto& options = get_profiler_timing_options();
+
+    options.operation_ = argc > 1 ? argv[1] : "";
+    options.problem_.clear();
+
+    for(int i = 2; i < argc; ++i)
+    {
+        options.problem_ += (i > 2 ? " " : "") + std::string(argv[i]);
+    }
+}
+
+// Makes the arguments in the ranges [first, last) of argv, e.g. data type, layout and sizes, the
+// problem of the stored records. Runs that only differ in verification, initialization, logging,
+// kernel timing or iteration counts then compare as the same problem.
+inline void set_profiler_problem(int argc,
+                                 char* argv[],
+                                 std::initializer_list<std::pair<int, int>> ranges)
+{
+    auto& options = get_profiler_timing_options();
+
+    options.problem_.clear();
+
+    for(const auto& [first, last] : ranges)
+    {
+        for(int i = first; i < std::min(last, argc); ++i)
+        {
+            options.problem_ += (options.problem_.empty() ? "" : " ") + std::string(argv[i]);
+        }
+    }
+}
+
+// StreamConfig for timing one instance, stats receives per-iteration statistics if any timing
+// option is enabled
+inline StreamConfig make_profiler_stream_config(bool time_kernel,
+                                                TimingStats* stats,
+                                                int n_warmup = 5,
+                                                int n_iter   = 50)
+{
+    const auto& options = get_profiler_timing_options();
+
+    StreamConfig stream_config{nullptr, time_kernel, 0, n_warmup, n_iter};
+
+    if(options.Enabled())
+    {
+        stream_config.stats_               = stats;
+        stream_config.flush_cache_bytes_   = options.flush_cache_bytes_;
+        stream_config.reject_outliers_     = options.reject_outliers_;
+        stream_config.warmup_until_stable_ = options.warmup_until_stable_;
+    }
+
+    return stream_config;
+}
+
+inline void report_timing_stats(const TimingStats& stats)
+{
+    if(!stats.Empty())
+    {
+        std::cout << "      " << stats << std::endl;
+    }
+}
+
+// print the statistics of one timed instance and append it to the result store, if any
+inline void report_profiler_result(const std::string& instance,
+                                   float ave_time,
+                                   float tflops,
+                                   float gb_per_sec,
+                                   const TimingStats& stats)
+{
+    report_timing_stats(stats);
+
+    const auto& options = get_profiler_timing_options();
+
+    if(options.store_path_.empty() || ave_time <= 0)
+    {
+        return;
+    }
+
+    ProfilerResultRecord record;
+
+    record.timestamp_  = static_cast<long long>(std::time(nullptr));
+    record.operation_  = options.operation_;
+    record.problem_    = options.problem_;
+    record.instance_   = instance;
+    record.ave_time_   = ave_time;
+    record.tflops_     = tflops;
+    record.gb_per_sec_ = gb_per_sec;
+    record.samples_    = stats.samples_;
+
+    append_profiler_result(options.store_path_, record);
+}
+
+} // namespace profiler
+} // namespace ck
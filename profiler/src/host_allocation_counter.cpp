@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<std::size_t> host_allocation_count{0};
+
+void* counted_allocate(std::size_t size)
+{
+    host_allocation_count.fetch_add(1, std::memory_order_relaxed);
+
+    // as the default operator new: retry after every call of the installed new handler
+    for(;;)
+    {
+        if(void* p = std::malloc(size == 0 ? 1 : size))
+        {
+            return p;
+        }
+
+        const std::new_handler handler = std::get_new_handler();
+
+        if(handler == nullptr)
+        {
+            throw std::bad_alloc{};
+        }
+
+        handler();
+    }
+}
+
+} // namespace
+
+namespace ck {
+namespace profiler {
+
+std::size_t get_host_allocation_count()
+{
+    return host_allocation_count.load(std::memory_order_relaxed);
+}
+
+} // namespace profiler
+} // namespace ck
+
+// Replaceable global allocation functions of ckHostDispatch, the aligned overloads are left to the
+// default implementation. Not linked into ckProfiler, whose allocations stay uncounted.
+void* operator new(std::size_t size) { return counted_allocate(size); }
+
+void* operator new[](std::size_t size) { return counted_allocate(size); }
+
+void operator delete(void* p) noexcept { std::free(p); }
+
+void operator delete[](void* p) noexcept { std::free(p); }
+
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
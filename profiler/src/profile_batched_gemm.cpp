@@ -72,6 +72,9 @@ int profile_batched_gemm(int argc, char* argv[])
 
     const int BatchCount = std::stoi(argv[17]);
 
+    // data type, layout and sizes identify the problem in the result store
+    ck::profiler::set_profiler_problem(argc, argv, {{2, 4}, {8, 18}});
+
     using F32  = float;
     using F16  = ck::half_t;
     using BF16 = ck::bhalf_t;
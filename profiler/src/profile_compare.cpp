@@ -0,0 +1,217 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "profiler/profile_result_store.hpp"
+#include "profiler_operation_registry.hpp"
+
+namespace {
+
+#define OP_NAME "compare"
+#define OP_DESC "Compare two result stores written with --store"
+
+static void print_helper_msg()
+{
+    std::cout
+        // clang-format off
+        << "arg1: tensor operation (" OP_NAME ": " OP_DESC ")\n"
+        << "arg2: baseline result store\n"
+        << "arg3: candidate result store\n"
+        << "arg4: minimum change of the median time in percent to report (default 2)\n"
+        << "arg5: significance level of the Mann-Whitney U test (default 0.05)\n"
+        << "arg6: print unchanged instances (0: no; 1: yes, default 0)\n"
+        << "returns non zero if any instance regressed" << std::endl;
+    // clang-format on
+}
+
+// all records of one (operation, problem, instance) in a store, samples of repeated runs pooled
+struct PooledResult
+{
+    std::string operation_;
+    std::string problem_;
+    std::string instance_;
+    std::vector<float> samples_;
+};
+
+std::map<std::string, PooledResult> pool_results(const std::string& path)
+{
+    std::map<std::string, PooledResult> pooled;
+
+    for(const auto& record : ck::profiler::read_profiler_results(path))
+    {
+        auto& result = pooled[record.Key()];
+
+        result.operation_ = record.operation_;
+        result.problem_   = record.problem_;
+        result.instance_  = record.instance_;
+
+        // records without samples contribute their mean
+        if(record.samples_.empty())
+        {
+            result.samples_.push_back(record.ave_time_);
+        }
+        else
+        {
+            result.samples_.insert(
+                result.samples_.end(), record.samples_.begin(), record.samples_.end());
+        }
+    }
+
+    return pooled;
+}
+
+float get_median(std::vector<float> samples)
+{
+    std::sort(samples.begin(), samples.end());
+
+    const std::size_t n = samples.size();
+
+    return n % 2 == 1 ? samples[n / 2] : 0.5f * (samples[n / 2 - 1] + samples[n / 2]);
+}
+
+struct Comparison
+{
+    const PooledResult* candidate_;
+    float base_median_;
+    float cand_median_;
+    float change_; // in percent, positive is slower
+    double p_value_;
+};
+
+struct FamilySummary
+{
+    std::vector<Comparison> regressions_;
+    std::vector<Comparison> improvements_;
+    std::vector<Comparison> unchanged_;
+    int num_baseline_only_  = 0;
+    int num_candidate_only_ = 0;
+};
+
+void print_comparison(const Comparison& c)
+{
+    const auto& r = *c.candidate_;
+
+    std::cout << "    " << std::showpos << std::fixed << std::setprecision(2) << std::setw(8)
+              << c.change_ << "%" << std::noshowpos << std::defaultfloat << std::setprecision(6)
+              << "  " << c.base_median_ << " -> " << c.cand_median_ << " ms, p " << c.p_value_
+              << ", " << r.problem_ << ", " << r.instance_ << std::endl;
+}
+
+} // namespace
+
+int profile_compare(int argc, char* argv[])
+{
+    if(argc < 4 || argc > 7)
+    {
+        print_helper_msg();
+        return 1;
+    }
+
+    const std::string baseline_path  = argv[2];
+    const std::string candidate_path = argv[3];
+    const float threshold            = argc > 4 ? std::stof(argv[4]) : 2.f;
+    const double alpha               = argc > 5 ? std::stod(argv[5]) : 0.05;
+    const bool print_unchanged       = argc > 6 ? std::stoi(argv[6]) != 0 : false;
+
+    const auto baseline  = pool_results(baseline_path);
+    const auto candidate = pool_results(candidate_path);
+
+    std::map<std::string, FamilySummary> families;
+
+    for(const auto& [key, base] : baseline)
+    {
+        const auto found = candidate.find(key);
+
+        if(found == candidate.end())
+        {
+            families[base.operation_].num_baseline_only_++;
+            continue;
+        }
+
+        const auto& cand = found->second;
+
+        Comparison c;
+
+        c.candidate_   = &cand;
+        c.base_median_ = get_median(base.samples_);
+        c.cand_median_ = get_median(cand.samples_);
+        c.change_      = c.base_median_ > 0 ? 100.f * (c.cand_median_ / c.base_median_ - 1.f) : 0.f;
+        c.p_value_     = ck::profiler::mann_whitney_p_value(base.samples_, cand.samples_);
+
+        auto& family = families[base.operation_];
+
+        // a change has to be both large enough to matter and unlikely to be noise
+        if(std::abs(c.change_) >= threshold && c.p_value_ < alpha)
+        {
+            (c.change_ > 0 ? family.regressions_ : family.improvements_).push_back(c);
+        }
+        else
+        {
+            family.unchanged_.push_back(c);
+        }
+    }
+
+    for(const auto& [key, cand] : candidate)
+    {
+        if(baseline.count(key) == 0)
+        {
+            families[cand.operation_].num_candidate_only_++;
+        }
+    }
+
+    std::cout << "baseline: " << baseline_path << ", candidate: " << candidate_path
+              << ", threshold: " << threshold << "%, alpha: " << alpha << std::endl;
+
+    std::size_t num_regression = 0;
+
+    for(auto& [operation, family] : families)
+    {
+        auto by_change = [](const Comparison& a, const Comparison& b) {
+            return std::abs(a.change_) > std::abs(b.change_);
+        };
+
+        std::sort(family.regressions_.begin(), family.regressions_.end(), by_change);
+        std::sort(family.improvements_.begin(), family.improvements_.end(), by_change);
+
+        std::cout << operation << ": " << family.regressions_.size() << " regressed, "
+                  << family.improvements_.size() << " improved, " << family.unchanged_.size()
+                  << " unchanged, " << family.num_baseline_only_ << " only in baseline, "
+                  << family.num_candidate_only_ << " only in candidate" << std::endl;
+
+        if(!family.regressions_.empty())
+        {
+            std::cout << "  regressions:" << std::endl;
+
+            std::for_each(
+                family.regressions_.begin(), family.regressions_.end(), print_comparison);
+        }
+
+        if(!family.improvements_.empty())
+        {
+            std::cout << "  improvements:" << std::endl;
+
+            std::for_each(
+                family.improvements_.begin(), family.improvements_.end(), print_comparison);
+        }
+
+        if(print_unchanged && !family.unchanged_.empty())
+        {
+            std::cout << "  unchanged:" << std::endl;
+
+            std::for_each(family.unchanged_.begin(), family.unchanged_.end(), print_comparison);
+        }
+
+        num_regression += family.regressions_.size();
+    }
+
+    return num_regression > 0 ? 1 : 0;
+}
+
+REGISTER_PROFILER_OPERATION(OP_NAME, OP_DESC, profile_compare);
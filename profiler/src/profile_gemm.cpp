@@ -71,6 +71,9 @@ int profile_gemm(int argc, char* argv[])
     const int StrideB = std::stoi(argv[12]);
     const int StrideC = std::stoi(argv[13]);
 
+    // data type, layout and sizes identify the problem in the result store
+    ck::profiler::set_profiler_problem(argc, argv, {{2, 4}, {8, 14}});
+
     int n_warmup = 1;
     int n_iter   = 10;
     if(argc == 16)
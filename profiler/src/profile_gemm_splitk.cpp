@@ -70,6 +70,9 @@ int profile_gemm_splitk(int argc, char* argv[])
     const int StrideC = std::stoi(argv[13]);
     const int KBatch  = std::stoi(argv[14]);
 
+    // data type, layout and sizes identify the problem in the result store
+    ck::profiler::set_profiler_problem(argc, argv, {{2, 4}, {8, 15}});
+
     int n_warmup = 1;
     int n_iter   = 10;
     if(argc == 17)
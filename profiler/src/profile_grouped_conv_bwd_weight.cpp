@@ -83,6 +83,9 @@ int profile_grouped_conv_bwd_weight(int argc, char* argv[])
     ck::index_t split_k = std::stoi(argv[8 + 1 + 4 + 6 * num_dim_spatial]);
     split_k             = std::max(1, split_k);
 
+    // data type, layout and sizes identify the problem in the result store
+    ck::profiler::set_profiler_problem(argc, argv, {{2, 4}, {8, argc}});
+
     using F32  = float;
     using F16  = ck::half_t;
     using BF16 = ck::bhalf_t;
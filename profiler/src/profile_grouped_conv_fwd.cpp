@@ -28,11 +28,15 @@ enum struct ConvDataType
 #define OP_NAME "grouped_conv_fwd"
 #define OP_DESC "Grouped Convolution Forward"
 
+#define GEMM_OP_NAME "grouped_conv_fwd_gemm"
+#define GEMM_OP_DESC "Grouped Convolution Forward, also as Batched GEMM if equivalent"
+
 static void print_helper_msg()
 {
     std::cout
         // clang-format off
-        << "arg1: tensor operation (" OP_NAME ": " OP_DESC ")\n"
+        << "arg1: tensor operation (" OP_NAME ": " OP_DESC "\n"
+        << "                        " GEMM_OP_NAME ": " GEMM_OP_DESC ")\n"
         << "arg2: data type (0: Input fp32, Weight fp32, Output fp32\n"
         << "                 1: Input fp16, Weight fp16, Output fp16\n"
         << "                 2: Input bf16, Weight bf16, Output bf16\n"
@@ -47,8 +51,9 @@ static void print_helper_msg()
     // clang-format on
 }
 
-} // namespace
-
+// ProfileGemmInstances: also profile the batched GEMM instances if the convolution is a GEMM on the
+// memory of its tensors, see profile_grouped_conv_fwd_impl()
+template <bool ProfileGemmInstances>
 int profile_grouped_conv_fwd(int argc, char* argv[])
 {
     // 8 for control, 1 for num_dim_spatial
@@ -75,6 +80,9 @@ int profile_grouped_conv_fwd(int argc, char* argv[])
 
     const auto params = ck::utils::conv::parse_conv_param(num_dim_spatial, 9, argv);
 
+    // data type, layout and sizes identify the problem in the result store
+    ck::profiler::set_profiler_problem(argc, argv, {{2, 4}, {8, argc}});
+
     using F32  = float;
     using F16  = ck::half_t;
     using BF16 = ck::bhalf_t;
@@ -129,7 +137,8 @@ int profile_grouped_conv_fwd(int argc, char* argv[])
                                                                 OutLayout,
                                                                 InDataType,
                                                                 WeiDataType,
-                                                                OutDataType>(
+                                                                OutDataType,
+                                                                ProfileGemmInstances>(
             do_verification, init_method, do_log, time_kernel, params);
 
         return pass ? 0 : 1;
@@ -257,4 +266,7 @@ int profile_grouped_conv_fwd(int argc, char* argv[])
     return 1;
 }
 
-REGISTER_PROFILER_OPERATION(OP_NAME, OP_DESC, profile_grouped_conv_fwd);
+} // namespace
+
+REGISTER_PROFILER_OPERATION(OP_NAME, OP_DESC, profile_grouped_conv_fwd<false>);
+REGISTER_PROFILER_OPERATION(GEMM_OP_NAME, GEMM_OP_DESC, profile_grouped_conv_fwd<true>);
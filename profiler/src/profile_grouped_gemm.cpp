@@ -94,6 +94,9 @@ int profile_grouped_gemm(int argc, char* argv[])
     const auto StrideCs = argToIntArray(argv[13]);
     const int kbatch    = argc == 15 ? std::stoi(argv[14]) : 1;
 
+    // data type, layout and sizes identify the problem in the result store
+    ck::profiler::set_profiler_problem(argc, argv, {{2, 4}, {8, 15}});
+
     int n_warmup = 1;
     int n_iter   = 10;
     if(argc == 17)
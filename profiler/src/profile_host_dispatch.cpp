@@ -0,0 +1,125 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "profiler/profile_host_dispatch_impl.hpp"
+
+namespace {
+
+enum struct HostDispatchFamily
+{
+    GEMM,             // 0
+    GROUPED_CONV_FWD, // 1
+    REDUCE,           // 2
+};
+
+static void print_helper_msg()
+{
+    std::cout
+        // clang-format off
+        << "Host overhead of MakeArgumentPointer/IsSupportedArgument/MakeInvokerPointer\n"
+        << "arg1: device arch reported to IsSupportedArgument, e.g. gfx90a (\"native\": query the device)\n"
+        << "arg2: number of calls per measurement\n"
+        << "arg3: print per instance result (0: no; 1: yes)\n"
+        << "arg4: instance family (0: gemm f16 MK_NK_MN\n"
+        << "                       1: grouped_conv_fwd f16 NHWGC_GKYXC_NHWGK\n"
+        << "                       2: reduce f16 ADD rank 4 over dims {1, 2, 3})\n"
+        << "gemm: arg5 to 7: M, N, K\n"
+        << "grouped_conv_fwd: arg5: number of spatial dims, followed by\n"
+        << ck::utils::conv::get_conv_param_parser_helper_msg()
+        << "reduce: arg5 to 8: input lengths\n" << std::endl;
+    // clang-format on
+}
+
+} // namespace
+
+// ckHostDispatch, a separate executable so that only it links the allocation counting operator
+// new of host_allocation_counter.cpp
+int main(int argc, char* argv[])
+{
+    if(argc < 5)
+    {
+        print_helper_msg();
+        return 1;
+    }
+
+    const std::string arch = argv[1];
+    const int nrepeat      = std::stoi(argv[2]);
+    const bool do_log      = std::stoi(argv[3]);
+    const auto family      = static_cast<HostDispatchFamily>(std::stoi(argv[4]));
+
+    if(arch != "native")
+    {
+        ck::set_device_name_override(arch);
+    }
+
+    if(family == HostDispatchFamily::GEMM && argc == 8)
+    {
+        const int M = std::stoi(argv[5]);
+        const int N = std::stoi(argv[6]);
+        const int K = std::stoi(argv[7]);
+
+        return ck::profiler::profile_host_dispatch_gemm_impl(M, N, K, nrepeat, do_log) ? 0 : 1;
+    }
+    else if(family == HostDispatchFamily::GROUPED_CONV_FWD && argc > 5)
+    {
+        using NWGC   = ck::tensor_layout::convolution::NWGC;
+        using NHWGC  = ck::tensor_layout::convolution::NHWGC;
+        using NDHWGC = ck::tensor_layout::convolution::NDHWGC;
+
+        using GKXC   = ck::tensor_layout::convolution::GKXC;
+        using GKYXC  = ck::tensor_layout::convolution::GKYXC;
+        using GKZYXC = ck::tensor_layout::convolution::GKZYXC;
+
+        using NWGK   = ck::tensor_layout::convolution::NWGK;
+        using NHWGK  = ck::tensor_layout::convolution::NHWGK;
+        using NDHWGK = ck::tensor_layout::convolution::NDHWGK;
+
+        const int num_dim_spatial = std::stoi(argv[5]);
+
+        // 5 for control, 1 for num_dim_spatial, 4 for G/N/K/C, and 6 * num_dim_spatial
+        if(argc != 5 + 1 + 4 + 6 * num_dim_spatial)
+        {
+            print_helper_msg();
+            return 1;
+        }
+
+        const auto params = ck::utils::conv::parse_conv_param(num_dim_spatial, 6, argv);
+
+        bool pass = false;
+
+        if(num_dim_spatial == 1)
+        {
+            pass = ck::profiler::profile_host_dispatch_grouped_conv_fwd_impl<1, NWGC, GKXC, NWGK>(
+                params, nrepeat, do_log);
+        }
+        else if(num_dim_spatial == 2)
+        {
+            pass =
+                ck::profiler::profile_host_dispatch_grouped_conv_fwd_impl<2, NHWGC, GKYXC, NHWGK>(
+                    params, nrepeat, do_log);
+        }
+        else if(num_dim_spatial == 3)
+        {
+            pass = ck::profiler::
+                profile_host_dispatch_grouped_conv_fwd_impl<3, NDHWGC, GKZYXC, NDHWGK>(
+                    params, nrepeat, do_log);
+        }
+
+        return pass ? 0 : 1;
+    }
+    else if(family == HostDispatchFamily::REDUCE && argc == 9)
+    {
+        const std::array<ck::index_t, 4> in_lengths{
+            std::stoi(argv[5]), std::stoi(argv[6]), std::stoi(argv[7]), std::stoi(argv[8])};
+
+        return ck::profiler::profile_host_dispatch_reduce_impl(in_lengths, nrepeat, do_log) ? 0
+                                                                                            : 1;
+    }
+
+    print_helper_msg();
+    return 1;
+}
@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "profiler/profile_instance_coverage_impl.hpp"
+#include "profiler_operation_registry.hpp"
+
+namespace {
+
+#define OP_NAME "instance_coverage"
+#define OP_DESC "Instances that support each problem of a workload, for a given arch"
+
+static void print_helper_msg()
+{
+    std::cout
+        // clang-format off
+        << "arg1: tensor operation (" OP_NAME ": " OP_DESC ")\n"
+        << "arg2: device arch reported to IsSupportedArgument, e.g. gfx90a (\"native\": query the device)\n"
+        << "arg3: problem list, one problem per line, '#' starts a comment:\n"
+        << "      gemm M N K                        (f16 MK_NK_MN)\n"
+        << "      grouped_conv_fwd Ndims <conv>     (f16 NHWGC_GKYXC_NHWGK, see below)\n"
+        << "arg4: print the supporting instances of every problem (0: no; 1: yes)\n"
+        << "<conv>:\n"
+        << ck::utils::conv::get_conv_param_parser_helper_msg() << std::endl;
+    // clang-format on
+}
+
+// Coverage of the problem on one line of the problem list, false if the line is malformed
+bool get_line_coverage(const std::vector<std::string>& words,
+                       ck::profiler::InstanceCoverageResult& result)
+{
+    using NWGC   = ck::tensor_layout::convolution::NWGC;
+    using NHWGC  = ck::tensor_layout::convolution::NHWGC;
+    using NDHWGC = ck::tensor_layout::convolution::NDHWGC;
+
+    using GKXC   = ck::tensor_layout::convolution::GKXC;
+    using GKYXC  = ck::tensor_layout::convolution::GKYXC;
+    using GKZYXC = ck::tensor_layout::convolution::GKZYXC;
+
+    using NWGK   = ck::tensor_layout::convolution::NWGK;
+    using NHWGK  = ck::tensor_layout::convolution::NHWGK;
+    using NDHWGK = ck::tensor_layout::convolution::NDHWGK;
+
+    if(words[0] == "gemm" && words.size() == 4)
+    {
+        result = ck::profiler::get_instance_coverage_gemm(
+            std::stoi(words[1]), std::stoi(words[2]), std::stoi(words[3]));
+
+        return true;
+    }
+
+    if(words[0] != "grouped_conv_fwd" || words.size() < 2)
+    {
+        return false;
+    }
+
+    const int num_dim_spatial = std::stoi(words[1]);
+
+    // 1 for the family, 1 for num_dim_spatial, 4 for G/N/K/C, and 6 * num_dim_spatial
+    if(num_dim_spatial < 1 || num_dim_spatial > 3 ||
+       words.size() != static_cast<std::size_t>(2 + 4 + 6 * num_dim_spatial))
+    {
+        return false;
+    }
+
+    std::vector<char*> argv;
+
+    for(const auto& word : words)
+    {
+        argv.push_back(const_cast<char*>(word.c_str()));
+    }
+
+    const auto params = ck::utils::conv::parse_conv_param(num_dim_spatial, 2, argv.data());
+
+    if(num_dim_spatial == 1)
+    {
+        result =
+            ck::profiler::get_instance_coverage_grouped_conv_fwd<1, NWGC, GKXC, NWGK>(params);
+    }
+    else if(num_dim_spatial == 2)
+    {
+        result =
+            ck::profiler::get_instance_coverage_grouped_conv_fwd<2, NHWGC, GKYXC, NHWGK>(params);
+    }
+    else
+    {
+        result = ck::profiler::get_instance_coverage_grouped_conv_fwd<3, NDHWGC, GKZYXC, NDHWGK>(
+            params);
+    }
+
+    return true;
+}
+
+} // namespace
+
+int profile_instance_coverage(int argc, char* argv[])
+{
+    if(argc != 5)
+    {
+        print_helper_msg();
+        return EXIT_FAILURE;
+    }
+
+    const std::string arch = argv[2];
+    const bool do_log      = std::stoi(argv[4]);
+
+    if(arch != "native")
+    {
+        ck::set_device_name_override(arch);
+    }
+
+    std::ifstream problem_list(argv[3]);
+
+    if(!problem_list)
+    {
+        std::cerr << "can not open problem list " << argv[3] << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::vector<ck::profiler::InstanceCoverageResult> results;
+    std::string line;
+
+    for(int line_number = 1; std::getline(problem_list, line); ++line_number)
+    {
+        std::istringstream line_stream(line.substr(0, line.find('#')));
+        std::vector<std::string> words;
+
+        for(std::string word; line_stream >> word;)
+        {
+            words.push_back(word);
+        }
+
+        if(words.empty())
+        {
+            continue;
+        }
+
+        results.emplace_back();
+
+        if(!get_line_coverage(words, results.back()))
+        {
+            std::cerr << argv[3] << ":" << line_number << ": not a problem: " << line << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    const auto num_uncovered = ck::profiler::report_instance_coverage(
+        arch == "native" ? ck::get_device_name() : arch, results, do_log);
+
+    return num_uncovered == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+REGISTER_PROFILER_OPERATION(OP_NAME, OP_DESC, profile_instance_coverage);
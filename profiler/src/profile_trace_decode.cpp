@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "ck/host_utility/invocation_trace.hpp"
+#include "profiler_operation_registry.hpp"
+
+namespace {
+
+#define OP_NAME "trace_decode"
+#define OP_DESC "List the problems of an invocation trace as ckProfiler commands"
+
+static void print_helper_msg()
+{
+    std::cout
+        // clang-format off
+        << "arg1: tensor operation (" OP_NAME ": " OP_DESC ")\n"
+        << "arg2: invocation trace, written with CK_INVOCATION_TRACE=<file>\n"
+        << "prints one line of ckProfiler arguments per problem, most frequent first, with\n"
+        << "verification off, integer initialization and timing on" << std::endl;
+    // clang-format on
+}
+
+using ProblemKey = std::tuple<std::string, int32_t, int32_t, std::vector<int64_t>>;
+
+struct InstanceSummary
+{
+    std::size_t num_run_ = 0;
+    double total_time_   = 0;
+};
+
+struct ProblemSummary
+{
+    std::size_t num_argument_ = 0;
+    std::size_t num_run_      = 0;
+    double total_time_        = 0;
+    uint64_t workspace_bytes_ = 0;
+    std::map<uint64_t, InstanceSummary> instances_;
+};
+
+ProblemKey make_problem_key(const ck::InvocationProblem& problem)
+{
+    return {std::string(problem.operation_,
+                        strnlen(problem.operation_, ck::InvocationTraceMaxOperationName)),
+            problem.data_type_,
+            problem.layout_,
+            std::vector<int64_t>(problem.values_, problem.values_ + problem.num_value_)};
+}
+
+} // namespace
+
+int profile_trace_decode(int argc, char* argv[])
+{
+    if(argc != 3)
+    {
+        print_helper_msg();
+        return EXIT_FAILURE;
+    }
+
+    const auto records = ck::read_invocation_trace(argv[2]);
+
+    std::map<ProblemKey, ProblemSummary> problems;
+
+    // the problem of every argument, a later argument at the same address replaces it
+    std::unordered_map<uint64_t, const ProblemKey*> argument_problems;
+
+    std::size_t num_untraced_run = 0;
+
+    for(const auto& record : records)
+    {
+        if(record.event_ == static_cast<uint32_t>(ck::InvocationTraceEvent::MakeArgument))
+        {
+            auto& [key, summary] = *problems.try_emplace(make_problem_key(record.problem_)).first;
+
+            summary.num_argument_ += 1;
+            summary.workspace_bytes_ = std::max(summary.workspace_bytes_, record.workspace_bytes_);
+
+            argument_problems[record.argument_id_] = &key;
+        }
+        else if(const auto it = argument_problems.find(record.argument_id_);
+                it != argument_problems.end())
+        {
+            auto& summary  = problems.at(*it->second);
+            auto& instance = summary.instances_[record.instance_hash_];
+
+            summary.num_run_ += 1;
+            summary.total_time_ += record.time_ms_;
+            instance.num_run_ += 1;
+            instance.total_time_ += record.time_ms_;
+        }
+        else
+        {
+            num_untraced_run += 1;
+        }
+    }
+
+    std::vector<std::pair<const ProblemKey*, const ProblemSummary*>> sorted;
+
+    for(const auto& [key, summary] : problems)
+    {
+        sorted.emplace_back(&key, &summary);
+    }
+
+    std::stable_sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) {
+        return a.second->num_run_ > b.second->num_run_;
+    });
+
+    std::cout << "# " << records.size() << " records, " << problems.size() << " problems, "
+              << num_untraced_run << " runs of untraced arguments" << std::endl;
+
+    for(const auto& [key, summary] : sorted)
+    {
+        const auto& [operation, data_type, layout, values] = *key;
+
+        std::cout << operation;
+
+        if(data_type >= 0 && layout >= 0)
+        {
+            std::cout << " " << data_type << " " << layout << " 0 1 0 1";
+        }
+
+        for(const auto value : values)
+        {
+            std::cout << " " << value;
+        }
+
+        std::cout << "  # " << summary->num_run_ << " runs";
+
+        if(summary->num_run_ > 0)
+        {
+            std::cout << ", mean " << summary->total_time_ / summary->num_run_ << " ms";
+        }
+
+        std::cout << ", workspace " << summary->workspace_bytes_ << " B";
+
+        for(const auto& [hash, instance] : summary->instances_)
+        {
+            std::cout << ", instance " << std::hex << hash << std::dec << " " << instance.num_run_
+                      << "x " << instance.total_time_ / instance.num_run_ << " ms";
+        }
+
+        std::cout << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+REGISTER_PROFILER_OPERATION(OP_NAME, OP_DESC, profile_trace_decode);
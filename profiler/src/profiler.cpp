@@ -2,17 +2,53 @@
 // Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
 
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
 
 #include "profiler_operation_registry.hpp"
+#include "profiler/profile_input_options.hpp"
+#include "profiler/profile_timing_options.hpp"
 
 static void print_helper_message()
 {
     std::cout << "arg1: tensor operation " << ProfilerOperationRegistry::GetInstance() << std::endl;
+    ck::profiler::print_profiler_timing_options_help();
+    ck::profiler::print_profiler_input_options_help();
+}
+
+// consume leading timing and input options, returns the number of arguments consumed
+static int parse_options(int argc, char* argv[])
+{
+    int i = 1;
+
+    for(; i < argc && std::strncmp(argv[i], "--", 2) == 0; ++i)
+    {
+        if(!ck::profiler::parse_profiler_timing_option(argv[i]) &&
+           !ck::profiler::parse_profiler_input_option(argv[i]))
+        {
+            std::cerr << "unknown option: " << argv[i] << std::endl;
+            print_helper_message();
+            std::exit(EXIT_FAILURE);
+        }
+    }
+
+    return i - 1;
 }
 
 int main(int argc, char* argv[])
 {
+    // drop the options so that operations see their usual arguments
+    const int num_option = parse_options(argc, argv);
+
+    for(int i = 1; i + num_option < argc; ++i)
+    {
+        argv[i] = argv[i + num_option];
+    }
+
+    argc -= num_option;
+
+    ck::profiler::set_profiler_invocation(argc, argv);
+
     if(argc == 1)
     {
         print_helper_message();
@@ -0,0 +1,292 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/library/utility/caching_allocator.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace {
+
+// host memory with a byte budget, recording the blocks it hands out
+struct CountingBackend : public CachingAllocatorBackend
+{
+    explicit CountingBackend(std::size_t budget) : budget_(budget) {}
+
+    void* Allocate(std::size_t size) override
+    {
+        if(bytes_ + size > budget_)
+        {
+            throw std::bad_alloc();
+        }
+
+        void* p = ::operator new(size);
+
+        bytes_ += size;
+        live_.emplace(p, size);
+
+        return p;
+    }
+
+    void Free(void* p) override
+    {
+        const auto iter = live_.find(p);
+
+        ASSERT_NE(iter, live_.end());
+
+        bytes_ -= iter->second;
+        live_.erase(iter);
+
+        ::operator delete(p);
+    }
+
+    void Synchronize() override { ++num_synchronize_; }
+
+    std::size_t budget_;
+    std::size_t bytes_           = 0;
+    std::size_t num_synchronize_ = 0;
+    std::map<void*, std::size_t> live_;
+};
+
+struct Allocator
+{
+    explicit Allocator(std::size_t budget = std::size_t(1) << 30)
+        : backend_(new CountingBackend(budget)),
+          allocator_(std::unique_ptr<CachingAllocatorBackend>(backend_))
+    {
+    }
+
+    CountingBackend* backend_;
+    CachingAllocator allocator_;
+};
+
+} // namespace
+
+TEST(CachingAllocator, SizeClasses)
+{
+    EXPECT_EQ(CachingAllocator::GetSizeClass(1), 256);
+    EXPECT_EQ(CachingAllocator::GetSizeClass(256), 256);
+    EXPECT_EQ(CachingAllocator::GetSizeClass(257), 320);
+    EXPECT_EQ(CachingAllocator::GetSizeClass(512), 512);
+    EXPECT_EQ(CachingAllocator::GetSizeClass(513), 640);
+    EXPECT_EQ(CachingAllocator::GetSizeClass(1000), 1024);
+    EXPECT_EQ(CachingAllocator::GetSizeClass(3 << 20), 3 << 20);
+    EXPECT_EQ(CachingAllocator::GetSizeClass((3 << 20) + 1), (7 << 20) / 2);
+
+    // at most a quarter wasted
+    for(std::size_t size = 257; size < 100000; size += 37)
+    {
+        const std::size_t size_class = CachingAllocator::GetSizeClass(size);
+
+        EXPECT_GE(size_class, size);
+        EXPECT_LE(size_class - size, size / 4);
+    }
+}
+
+TEST(CachingAllocator, ReusesFreedBlocks)
+{
+    Allocator a;
+
+    void* p0 = a.allocator_.Allocate(1000);
+    a.allocator_.Free(p0);
+
+    // same size class
+    void* p1 = a.allocator_.Allocate(900);
+    EXPECT_EQ(p1, p0);
+
+    // other size class
+    void* p2 = a.allocator_.Allocate(5000);
+    EXPECT_NE(p2, p0);
+
+    a.allocator_.Free(p1);
+    a.allocator_.Free(p2);
+
+    const auto stats = a.allocator_.GetStats();
+
+    EXPECT_EQ(stats.num_allocations_, 3);
+    EXPECT_EQ(stats.num_reuses_, 1);
+    EXPECT_EQ(stats.num_backend_allocations_, 2);
+    EXPECT_EQ(stats.num_backend_frees_, 0);
+    EXPECT_EQ(stats.bytes_in_use_, 0);
+    EXPECT_EQ(stats.peak_bytes_in_use_, 1024 + 5120);
+    EXPECT_EQ(stats.bytes_cached_, 1024 + 5120);
+    EXPECT_EQ(stats.peak_bytes_reserved_, 1024 + 5120);
+    EXPECT_EQ(a.backend_->num_synchronize_, 3);
+
+    a.allocator_.Trim();
+
+    EXPECT_EQ(a.allocator_.GetStats().bytes_cached_, 0);
+    EXPECT_EQ(a.allocator_.GetStats().num_backend_frees_, 2);
+    EXPECT_TRUE(a.backend_->live_.empty());
+
+    a.allocator_.ResetStats();
+
+    EXPECT_EQ(a.allocator_.GetStats().num_allocations_, 0);
+    EXPECT_EQ(a.allocator_.GetStats().peak_bytes_in_use_, 0);
+}
+
+TEST(CachingAllocator, ZeroSizeAndNull)
+{
+    Allocator a;
+
+    EXPECT_EQ(a.allocator_.Allocate(0), nullptr);
+    a.allocator_.Free(nullptr);
+
+    EXPECT_EQ(a.allocator_.GetStats().num_allocations_, 0);
+}
+
+TEST(CachingAllocator, CacheLimit)
+{
+    Allocator a;
+
+    a.allocator_.SetMaxCachedBytes(2048);
+
+    std::vector<void*> blocks;
+    for(int i = 0; i < 4; ++i)
+    {
+        blocks.push_back(a.allocator_.Allocate(1024));
+    }
+
+    for(void* p : blocks)
+    {
+        a.allocator_.Free(p);
+    }
+
+    EXPECT_EQ(a.allocator_.GetStats().bytes_cached_, 2048);
+    EXPECT_EQ(a.allocator_.GetStats().num_backend_frees_, 2);
+
+    // no caching at all
+    a.allocator_.SetMaxCachedBytes(0);
+
+    EXPECT_EQ(a.allocator_.GetStats().bytes_cached_, 0);
+    EXPECT_TRUE(a.backend_->live_.empty());
+
+    a.allocator_.Free(a.allocator_.Allocate(1024));
+
+    EXPECT_EQ(a.allocator_.GetStats().num_reuses_, 0);
+    EXPECT_TRUE(a.backend_->live_.empty());
+}
+
+TEST(CachingAllocator, DefaultCacheLimit)
+{
+    // freed host memory is returned to the OS beyond the default limit
+    EXPECT_EQ(CachingAllocator::GetHostInstance().GetMaxCachedBytes(),
+              CachingAllocator::DefaultMaxCachedBytes);
+
+    auto* backend = new CountingBackend(std::size_t(1) << 30);
+    CachingAllocator allocator(std::unique_ptr<CachingAllocatorBackend>(backend), 0);
+
+    EXPECT_EQ(allocator.GetMaxCachedBytes(), 0);
+
+    allocator.Free(allocator.Allocate(1024));
+
+    EXPECT_EQ(allocator.GetStats().bytes_cached_, 0);
+    EXPECT_TRUE(backend->live_.empty());
+}
+
+TEST(CachingAllocator, ReleasesCacheWhenOutOfMemory)
+{
+    Allocator a(4096);
+
+    a.allocator_.Free(a.allocator_.Allocate(3072));
+
+    // does not fit next to the cached 3072 bytes
+    void* p = a.allocator_.Allocate(2048);
+
+    EXPECT_NE(p, nullptr);
+    EXPECT_EQ(a.allocator_.GetStats().bytes_cached_, 0);
+    EXPECT_EQ(a.allocator_.GetStats().num_backend_frees_, 1);
+
+    // does not fit at all
+    EXPECT_THROW(a.allocator_.Allocate(3072), std::bad_alloc);
+
+    a.allocator_.Free(p);
+}
+
+TEST(CachingAllocator, UnknownPointer)
+{
+    Allocator a;
+
+    int x = 0;
+
+    EXPECT_THROW(a.allocator_.Free(&x), std::runtime_error);
+}
+
+TEST(CachingAllocator, HostTensorStorage)
+{
+    auto& allocator = CachingAllocator::GetHostInstance();
+
+    const HostTensorDescriptor desc({64, 33});
+
+    {
+        Tensor<float> t(desc);
+        std::fill(t.begin(), t.end(), 2.f);
+    }
+
+    allocator.ResetStats();
+
+    {
+        // storage of the tensor above, zero-filled again
+        Tensor<float> t(desc);
+
+        EXPECT_EQ(allocator.GetStats().num_reuses_, 1);
+
+        for(float v : t)
+        {
+            EXPECT_EQ(v, 0.f);
+        }
+    }
+
+    {
+        Tensor<float> t(desc, TensorUninitialized{});
+
+        EXPECT_EQ(allocator.GetStats().num_reuses_, 2);
+        EXPECT_EQ(t.GetElementSpaceSize(), 64 * 33);
+
+        t.SetZero();
+
+        const auto copy      = t;
+        const auto as_double = t.CopyAsType<double>();
+
+        EXPECT_EQ(copy.mData, t.mData);
+
+        for(double v : as_double)
+        {
+            EXPECT_EQ(v, 0.);
+        }
+    }
+
+    EXPECT_EQ(allocator.GetStats().bytes_in_use_, 0);
+}
+
+TEST(CachingAllocator, HostAllocatorInitialization)
+{
+    const HostCachingAllocator<float> value_init;
+    const HostCachingAllocator<float> default_init(/*default_init=*/true);
+
+    EXPECT_EQ(value_init, HostCachingAllocator<double>{});
+    EXPECT_NE(value_init, default_init);
+    EXPECT_EQ(default_init, HostCachingAllocator<double>(default_init));
+
+    // a tensor assigned from an uninitialized one also grows without initializing
+    Tensor<float> t(HostTensorDescriptor({4}));
+
+    t = Tensor<float>(HostTensorDescriptor({8}), TensorUninitialized{});
+
+    EXPECT_EQ(t.mData.get_allocator(), default_init);
+
+    std::vector<float, HostCachingAllocator<float>> a(4, 1.f, value_init);
+    std::vector<float, HostCachingAllocator<float>> b(8, 2.f, default_init);
+
+    a.swap(b);
+
+    EXPECT_EQ(a.get_allocator(), default_init);
+    EXPECT_EQ(b.get_allocator(), value_init);
+    EXPECT_EQ(b.size(), std::size_t{4});
+}
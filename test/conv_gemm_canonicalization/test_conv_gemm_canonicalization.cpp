@@ -0,0 +1,160 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+
+#include "ck/library/utility/convolution_gemm_canonicalization.hpp"
+#include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
+#include "ck/library/utility/convolution_parameter.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_batched_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd.hpp"
+
+namespace {
+
+using namespace ck::tensor_layout::convolution;
+
+using ck::utils::conv::ConvFwdGemmProblem;
+using ck::utils::conv::ConvParam;
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+void fill_random(Tensor<float>& tensor, unsigned seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(-5, 5);
+
+    // small integers, so that the sums are exact in any order
+    for(auto& v : tensor)
+    {
+        v = static_cast<float>(dist(gen));
+    }
+}
+
+// Runs the convolution with ReferenceConvFwd and its GEMM with ReferenceBatchedGemm on views of
+// the same memory, and checks that both give the same output
+template <ck::index_t NDimSpatial, typename InLayout, typename WeiLayout, typename OutLayout>
+void check_gemm_equivalence(const ConvParam& conv_param)
+{
+    ConvFwdGemmProblem gemm;
+
+    ASSERT_TRUE((ck::utils::conv::get_conv_fwd_gemm_problem<InLayout, WeiLayout, OutLayout>(
+        conv_param, gemm)));
+
+    Tensor<float> input(
+        ck::utils::conv::make_input_host_tensor_descriptor_g_n_c_wis_packed<InLayout>(conv_param));
+    Tensor<float> weight(
+        ck::utils::conv::make_weight_host_tensor_descriptor_g_k_c_xs_packed<WeiLayout>(conv_param));
+    Tensor<float> output(
+        ck::utils::conv::make_output_host_tensor_descriptor_g_n_k_wos_packed<OutLayout>(
+            conv_param));
+
+    fill_random(input, 1);
+    fill_random(weight, 2);
+    output.SetZero();
+
+    auto ref_conv = ck::tensor_operation::host::
+        ReferenceConvFwd<NDimSpatial, float, float, float, PassThrough, PassThrough, PassThrough>{};
+    ref_conv.MakeInvoker().Run(ref_conv.MakeArgument(input,
+                                                     weight,
+                                                     output,
+                                                     conv_param.conv_filter_strides_,
+                                                     conv_param.conv_filter_dilations_,
+                                                     conv_param.input_left_pads_,
+                                                     conv_param.input_right_pads_,
+                                                     PassThrough{},
+                                                     PassThrough{},
+                                                     PassThrough{}));
+
+    const std::size_t G = gemm.G_;
+    const std::size_t M = gemm.M_;
+    const std::size_t N = gemm.N_;
+    const std::size_t K = gemm.K_;
+
+    const std::size_t stride_a       = gemm.StrideA_;
+    const std::size_t stride_b       = gemm.StrideB_;
+    const std::size_t stride_e       = gemm.StrideE_;
+    const std::size_t batch_stride_a = gemm.BatchStrideA_;
+    const std::size_t batch_stride_b = gemm.BatchStrideB_;
+    const std::size_t batch_stride_e = gemm.BatchStrideE_;
+    const std::size_t unit_stride    = 1;
+
+    // A [G, M, K] row-major, B [G, K, N] column-major and E [G, M, N] row-major over the memory
+    // of the input, the weight and the output
+    Tensor<float> a_g_m_k(
+        HostTensorDescriptor({G, M, K}, {batch_stride_a, stride_a, unit_stride}));
+    Tensor<float> b_g_k_n(
+        HostTensorDescriptor({G, K, N}, {batch_stride_b, unit_stride, stride_b}));
+    Tensor<float> e_g_m_n(
+        HostTensorDescriptor({G, M, N}, {batch_stride_e, stride_e, unit_stride}));
+
+    ASSERT_LE(a_g_m_k.mDesc.GetElementSpaceSize(), input.mData.size());
+    ASSERT_LE(b_g_k_n.mDesc.GetElementSpaceSize(), weight.mData.size());
+    ASSERT_EQ(e_g_m_n.mDesc.GetElementSpaceSize(), output.mData.size());
+
+    a_g_m_k.mData = input.mData;
+    b_g_k_n.mData = weight.mData;
+    e_g_m_n.SetZero();
+
+    auto ref_gemm = ck::tensor_operation::host::
+        ReferenceBatchedGemm<float, float, float, float, PassThrough, PassThrough, PassThrough>{};
+    ref_gemm.MakeInvoker().Run(ref_gemm.MakeArgument(
+        a_g_m_k, b_g_k_n, e_g_m_n, PassThrough{}, PassThrough{}, PassThrough{}));
+
+    EXPECT_EQ(e_g_m_n.mData, output.mData);
+}
+
+} // namespace
+
+TEST(ConvGemmCanonicalization, Filter1x1Stride1Pad0)
+{
+    // G between the spatial dims and C, so the GEMM rows are G * C apart
+    check_gemm_equivalence<2, NHWGC, GKYXC, NHWGK>(
+        ConvParam{2, 3, 2, 5, 4, {1, 1}, {3, 7}, {1, 1}, {1, 1}, {0, 0}, {0, 0}});
+
+    check_gemm_equivalence<3, GNDHWC, GKZYXC, GNDHWK>(
+        ConvParam{3, 2, 3, 6, 5, {1, 1, 1}, {2, 3, 4}, {1, 1, 1}, {2, 1, 3}, {0, 0, 0}, {0, 0, 0}});
+}
+
+TEST(ConvGemmCanonicalization, FilterCoversInput)
+{
+    // one output position per image, the reduction runs over the whole image
+    check_gemm_equivalence<2, GNHWC, GKYXC, GNHWK>(
+        ConvParam{2, 2, 3, 4, 3, {5, 6}, {5, 6}, {1, 1}, {1, 1}, {0, 0}, {0, 0}});
+
+    check_gemm_equivalence<2, NHWGC, GKYXC, NHWGK>(
+        ConvParam{2, 1, 4, 3, 2, {3, 4}, {3, 4}, {2, 2}, {1, 1}, {0, 0}, {0, 0}});
+}
+
+TEST(ConvGemmCanonicalization, Strided1x1)
+{
+    // the input positions skipped by the stride fold into the row stride in 1D
+    check_gemm_equivalence<1, NWGC, GKXC, NWGK>(
+        ConvParam{1, 2, 3, 4, 5, {1}, {12}, {3}, {1}, {0}, {0}});
+}
+
+TEST(ConvGemmCanonicalization, NotEquivalent)
+{
+    ConvFwdGemmProblem gemm;
+
+    // padding
+    EXPECT_FALSE((ck::utils::conv::get_conv_fwd_gemm_problem<NHWGC, GKYXC, NHWGK>(
+        ConvParam{2, 1, 2, 4, 4, {1, 1}, {7, 7}, {1, 1}, {1, 1}, {1, 1}, {0, 0}}, gemm)));
+
+    // 3x3 filter sliding over the input
+    EXPECT_FALSE((ck::utils::conv::get_conv_fwd_gemm_problem<GNHWC, GKYXC, GNHWK>(
+        ConvParam{2, 1, 2, 4, 4, {3, 3}, {7, 7}, {1, 1}, {1, 1}, {0, 0}, {0, 0}}, gemm)));
+
+    // strided 1x1 filter skipping input rows in 2D
+    EXPECT_FALSE((ck::utils::conv::get_conv_fwd_gemm_problem<GNHWC, GKYXC, GNHWK>(
+        ConvParam{2, 1, 2, 4, 4, {1, 1}, {8, 8}, {2, 2}, {1, 1}, {0, 0}, {0, 0}}, gemm)));
+
+    // filter covering the input, but the taps of one group are G * C apart
+    EXPECT_FALSE((ck::utils::conv::get_conv_fwd_gemm_problem<NHWGC, GKYXC, NHWGK>(
+        ConvParam{2, 2, 2, 4, 4, {3, 3}, {3, 3}, {1, 1}, {1, 1}, {0, 0}, {0, 0}}, gemm)));
+}
@@ -0,0 +1,188 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/device/gemm_specialization.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_grouped_gemm_xdl.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+class TestGGemmArgumentUpdate : public ::testing::Test
+{
+    protected:
+    template <ck::index_t... Is>
+    using S = ck::Sequence<Is...>;
+
+    using F16         = ck::half_t;
+    using F32         = float;
+    using Row         = ck::tensor_layout::gemm::RowMajor;
+    using Col         = ck::tensor_layout::gemm::ColumnMajor;
+    using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+    using EmptyTuple  = ck::Tuple<>;
+    using GemmDesc    = ck::tensor_operation::device::GemmDesc;
+
+    static constexpr auto GemmMNKPadding =
+        ck::tensor_operation::device::GemmSpecialization::MNKPadding;
+
+    // clang-format off
+    using DeviceOp = ck::tensor_operation::device::DeviceGroupedGemm_Xdl
+        < Row, Col, EmptyTuple, Row, F16, F16, F32, F16, EmptyTuple, F16, PassThrough, PassThrough, PassThrough, GemmMNKPadding, 1, 256, 256, 128, 32, 8, 8, 32, 32, 4, 2, S<4, 64, 1>, S<1, 0, 2>, S<1, 0, 2>, 2, 8, 8, 1, S<4, 64, 1>, S<1, 0, 2>, S<1, 0, 2>, 2, 8, 8, 1, 1, 1, S<1, 32, 1, 8>, 8>;
+    // clang-format on
+
+    static void* FakePtr(std::uintptr_t tag, std::size_t i)
+    {
+        return reinterpret_cast<void*>((tag << 32) + (i << 8));
+    }
+
+    void SetUp() override
+    {
+        const std::vector<int> Ms{256, 0, 77, 512, 128, 256};
+
+        for(std::size_t i = 0; i < Ms.size(); ++i)
+        {
+            gemm_descs_.push_back(GemmDesc{Ms[i], 256, 128, 128, 128, 256, {}});
+
+            SetPointers(i, 1);
+        }
+    }
+
+    void SetPointers(std::size_t i, std::uintptr_t tag)
+    {
+        p_a_.resize(gemm_descs_.size());
+        p_b_.resize(gemm_descs_.size());
+        p_e_.resize(gemm_descs_.size());
+
+        p_a_[i] = FakePtr(3 * tag, i);
+        p_b_[i] = FakePtr(3 * tag + 1, i);
+        p_e_[i] = FakePtr(3 * tag + 2, i);
+    }
+
+    DeviceOp::Argument MakeArgument()
+    {
+        return DeviceOp::MakeArgument(
+            p_a_, p_b_, p_ds_, p_e_, gemm_descs_, PassThrough{}, PassThrough{}, PassThrough{});
+    }
+
+    static void ExpectSameKernelArgs(const DeviceOp::Argument& lhs, const DeviceOp::Argument& rhs)
+    {
+        EXPECT_EQ(lhs.grid_size_, rhs.grid_size_);
+        EXPECT_EQ(lhs.skipped_group_count_, rhs.skipped_group_count_);
+        ASSERT_EQ(lhs.gemm_desc_kernel_arg_.size(), rhs.gemm_desc_kernel_arg_.size());
+
+        for(std::size_t i = 0; i < lhs.gemm_desc_kernel_arg_.size(); ++i)
+        {
+            const auto& l = lhs.gemm_desc_kernel_arg_[i];
+            const auto& r = rhs.gemm_desc_kernel_arg_[i];
+
+            EXPECT_EQ(l.a_ptr_, r.a_ptr_);
+            EXPECT_EQ(l.b_ptr_, r.b_ptr_);
+            EXPECT_EQ(l.e_ptr_, r.e_ptr_);
+            EXPECT_EQ(l.BlockStart_, r.BlockStart_);
+            EXPECT_EQ(l.BlockEnd_, r.BlockEnd_);
+            EXPECT_EQ(l.block_2_etile_map_.BlockStart_, r.block_2_etile_map_.BlockStart_);
+            EXPECT_EQ(l.e_grid_desc_m_n_.GetLength(ck::Number<0>{}),
+                      r.e_grid_desc_m_n_.GetLength(ck::Number<0>{}));
+            EXPECT_EQ(l.a_grid_desc_ak0_m_ak1_.GetLength(ck::Number<1>{}),
+                      r.a_grid_desc_ak0_m_ak1_.GetLength(ck::Number<1>{}));
+        }
+    }
+
+    std::vector<GemmDesc> gemm_descs_;
+    std::vector<const void*> p_a_, p_b_;
+    std::vector<std::array<const void*, 0>> p_ds_;
+    std::vector<void*> p_e_;
+};
+
+TEST_F(TestGGemmArgumentUpdate, UpdatePointers)
+{
+    auto argument = MakeArgument();
+
+    for(std::size_t i = 0; i < gemm_descs_.size(); ++i)
+    {
+        SetPointers(i, 2);
+    }
+
+    argument.UpdatePointers(p_a_, p_b_, p_ds_, p_e_);
+
+    ExpectSameKernelArgs(argument, MakeArgument());
+}
+
+TEST_F(TestGGemmArgumentUpdate, UpdateGroupShape)
+{
+    auto argument = MakeArgument();
+
+    // shape change of a non-skipped group shifts the block ranges of the following groups
+    gemm_descs_[2].M_ = 1000;
+    SetPointers(2, 3);
+    argument.UpdateGroup(2, gemm_descs_[2], p_a_[2], p_b_[2], {}, p_e_[2]);
+    ExpectSameKernelArgs(argument, MakeArgument());
+
+    // a skipped group becoming active repacks the kernel arguments
+    gemm_descs_[1].M_ = 64;
+    argument.UpdateGroup(1, gemm_descs_[1], p_a_[1], p_b_[1], {}, p_e_[1]);
+    ExpectSameKernelArgs(argument, MakeArgument());
+
+    // and the other way round
+    gemm_descs_[4].M_ = 0;
+    argument.UpdateGroup(4, gemm_descs_[4], p_a_[4], p_b_[4], {}, p_e_[4]);
+    ExpectSameKernelArgs(argument, MakeArgument());
+}
+
+TEST_F(TestGGemmArgumentUpdate, DirtyRange)
+{
+    auto argument = MakeArgument();
+
+    argument.p_workspace_ = FakePtr(100, 0);
+
+    // a new workspace always needs a full upload
+    EXPECT_EQ(argument.GetDirtyKernelArgRange().first, std::size_t{0});
+    EXPECT_EQ(argument.GetDirtyKernelArgRange().second, argument.gemm_desc_kernel_arg_.size());
+
+    argument.MarkKernelArgsSynced();
+    EXPECT_EQ(argument.GetDirtyKernelArgRange().first, argument.GetDirtyKernelArgRange().second);
+
+    // only the kernel argument of the updated group is stale
+    SetPointers(3, 4);
+    argument.UpdateGroup(3, gemm_descs_[3], p_a_[3], p_b_[3], {}, p_e_[3]);
+
+    const auto karg_id = static_cast<std::size_t>(argument.group_karg_id_[3]);
+
+    EXPECT_EQ(argument.GetDirtyKernelArgRange().first, karg_id);
+    EXPECT_EQ(argument.GetDirtyKernelArgRange().second, karg_id + 1);
+}
+
+TEST_F(TestGGemmArgumentUpdate, SharedWorkspace)
+{
+    auto argument = MakeArgument();
+    auto other    = MakeArgument();
+
+    argument.p_workspace_ = FakePtr(101, 0);
+    other.p_workspace_    = argument.p_workspace_;
+
+    argument.MarkKernelArgsSynced();
+
+    // a copy starts from the same upload, but once it uploads again the original does not
+    auto copy = argument;
+
+    EXPECT_EQ(copy.GetDirtyKernelArgRange().first, copy.GetDirtyKernelArgRange().second);
+
+    copy.MarkKernelArgsSynced();
+    EXPECT_EQ(argument.GetDirtyKernelArgRange().first, std::size_t{0});
+    EXPECT_EQ(argument.GetDirtyKernelArgRange().second, argument.gemm_desc_kernel_arg_.size());
+
+    // another argument uploading to the same workspace overwrites the kernel arguments
+    argument.MarkKernelArgsSynced();
+    other.MarkKernelArgsSynced();
+    EXPECT_EQ(argument.GetDirtyKernelArgRange().first, std::size_t{0});
+    EXPECT_EQ(argument.GetDirtyKernelArgRange().second, argument.gemm_desc_kernel_arg_.size());
+
+    // and so may anything that was given the workspace since
+    argument.MarkKernelArgsSynced();
+    DeviceOp{}.SetWorkSpacePointer(&argument, argument.p_workspace_);
+    EXPECT_EQ(argument.GetDirtyKernelArgRange().second, argument.gemm_desc_kernel_arg_.size());
+}
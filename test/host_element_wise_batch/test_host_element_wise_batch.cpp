@@ -0,0 +1,194 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/library/utility/host_element_wise_batch.hpp"
+
+namespace element_wise = ck::tensor_operation::element_wise;
+
+using ck::tensor_operation::host::apply_element_wise;
+
+namespace {
+
+// dense around 0 and log spaced up to +-200, plus special values
+std::vector<float> make_inputs()
+{
+    std::vector<float> x;
+
+    for(int i = -4000; i <= 4000; ++i)
+    {
+        x.push_back(static_cast<float>(i) * 1e-3f);
+    }
+
+    for(float v = 4.f; v < 200.f; v *= 1.001f)
+    {
+        x.push_back(v);
+        x.push_back(-v);
+    }
+
+    for(float v = 1e-30f; v < 1e-3f; v *= 1.1f)
+    {
+        x.push_back(v);
+        x.push_back(-v);
+    }
+
+    x.push_back(0.f);
+    x.push_back(-0.f);
+    x.push_back(std::numeric_limits<float>::infinity());
+    x.push_back(-std::numeric_limits<float>::infinity());
+    x.push_back(std::numeric_limits<float>::quiet_NaN());
+
+    return x;
+}
+
+// batch result against the scalar operator, within 4 * eps * (|y_ref| + |x|)
+template <typename ElementOp>
+void check_against_scalar(const ElementOp& op)
+{
+    const auto x = make_inputs();
+
+    std::vector<float> y(x.size());
+
+    apply_element_wise(op, y.data(), x.data(), x.size());
+
+    for(std::size_t i = 0; i < x.size(); ++i)
+    {
+        float y_ref;
+        op(y_ref, x[i]);
+
+        if(std::isnan(y_ref) || std::isinf(y_ref))
+        {
+            EXPECT_EQ(std::isnan(y[i]), std::isnan(y_ref)) << "x = " << x[i];
+            EXPECT_EQ(std::isinf(y[i]), std::isinf(y_ref)) << "x = " << x[i];
+            if(std::isinf(y_ref))
+            {
+                EXPECT_EQ(y[i], y_ref) << "x = " << x[i];
+            }
+            continue;
+        }
+
+        const float tolerance =
+            4.f * std::numeric_limits<float>::epsilon() * (std::abs(y_ref) + std::abs(x[i]));
+
+        EXPECT_LE(std::abs(y[i] - y_ref), tolerance) << "x = " << x[i] << ", y = " << y[i]
+                                                     << ", y_ref = " << y_ref;
+    }
+}
+
+} // namespace
+
+TEST(HostElementWiseBatch, FastGelu) { check_against_scalar(element_wise::FastGelu{}); }
+TEST(HostElementWiseBatch, Gelu) { check_against_scalar(element_wise::Gelu{}); }
+TEST(HostElementWiseBatch, Sigmoid) { check_against_scalar(element_wise::Sigmoid{}); }
+TEST(HostElementWiseBatch, TanH) { check_against_scalar(element_wise::TanH{}); }
+TEST(HostElementWiseBatch, Swish)
+{
+    check_against_scalar(element_wise::Swish{});
+    check_against_scalar(element_wise::Swish{1.7f});
+}
+TEST(HostElementWiseBatch, SoftRelu)
+{
+    check_against_scalar(element_wise::SoftRelu{});
+    check_against_scalar(element_wise::SoftRelu{0.3f});
+}
+TEST(HostElementWiseBatch, Elu)
+{
+    check_against_scalar(element_wise::Elu{});
+    check_against_scalar(element_wise::Elu{0.5f});
+}
+
+TEST(HostElementWiseBatch, FastGeluHalf)
+{
+    const auto x = make_inputs();
+
+    std::vector<ck::half_t> x_half;
+    for(float v : x)
+    {
+        x_half.push_back(ck::type_convert<ck::half_t>(v));
+    }
+
+    std::vector<ck::half_t> y(x.size());
+    apply_element_wise(element_wise::FastGelu{}, y.data(), x_half.data(), x.size());
+
+    for(std::size_t i = 0; i < x.size(); ++i)
+    {
+        ck::half_t y_ref;
+        element_wise::FastGelu{}(y_ref, x_half[i]);
+
+        const float y_f     = ck::type_convert<float>(y[i]);
+        const float y_ref_f = ck::type_convert<float>(y_ref);
+
+        // rounding to half may differ by 1 ulp of half
+        if(std::isnan(y_ref_f))
+        {
+            EXPECT_TRUE(std::isnan(y_f)) << "x = " << x[i];
+        }
+        else if(std::isinf(y_ref_f))
+        {
+            EXPECT_EQ(y_f, y_ref_f) << "x = " << x[i];
+        }
+        else
+        {
+            EXPECT_LE(std::abs(y_f - y_ref_f), std::abs(y_ref_f) * 1e-3f + 6e-8f) << "x = " << x[i];
+        }
+    }
+}
+
+TEST(HostElementWiseBatch, ScalarFallback)
+{
+    // operators and types without a batch implementation give the scalar result exactly
+    const auto x = make_inputs();
+
+    std::vector<float> y(x.size());
+    std::vector<float> y_sum(x.size());
+    std::vector<double> x_double(x.begin(), x.end());
+    std::vector<double> y_double(x.size());
+
+    apply_element_wise(element_wise::Relu{}, y.data(), x.data(), x.size());
+    apply_element_wise(element_wise::Add{}, y_sum.data(), x.data(), y.data(), x.size());
+    apply_element_wise(element_wise::Sigmoid{}, y_double.data(), x_double.data(), x.size());
+
+    for(std::size_t i = 0; i < x.size(); ++i)
+    {
+        float y_ref;
+        element_wise::Relu{}(y_ref, x[i]);
+
+        float y_sum_ref;
+        element_wise::Add{}(y_sum_ref, x[i], y_ref);
+
+        double y_double_ref;
+        element_wise::Sigmoid{}(y_double_ref, x_double[i]);
+
+        if(std::isnan(x[i]))
+        {
+            continue;
+        }
+
+        EXPECT_EQ(y[i], y_ref);
+        EXPECT_EQ(y_sum[i], y_sum_ref);
+        EXPECT_EQ(y_double[i], y_double_ref);
+    }
+}
+
+TEST(HostElementWiseBatch, InPlace)
+{
+    auto x = make_inputs();
+
+    std::vector<float> y(x.size());
+    apply_element_wise(element_wise::TanH{}, y.data(), x.data(), x.size());
+    apply_element_wise(element_wise::TanH{}, x.data(), x.data(), x.size());
+
+    for(std::size_t i = 0; i < x.size(); ++i)
+    {
+        if(!std::isnan(y[i]))
+        {
+            EXPECT_EQ(x[i], y[i]);
+        }
+    }
+}
@@ -0,0 +1,253 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
+#include "ck/library/utility/convolution_parameter.hpp"
+#include "ck/library/utility/host_integer_gemm.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+
+namespace element_wise = ck::tensor_operation::element_wise;
+
+using ck::tensor_operation::host::integer_gemm;
+using ck::tensor_operation::host::ReferenceConvFwd;
+using ck::tensor_operation::host::ReferenceGemm;
+
+namespace {
+
+template <typename T>
+void fill_random(Tensor<T>& tensor, int lo, int hi, unsigned seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(lo, hi);
+
+    for(auto& v : tensor)
+    {
+        v = static_cast<T>(dist(gen));
+    }
+}
+
+template <typename T>
+int64_t naive_dot(const Tensor<T>& a_m_k, const Tensor<T>& b_k_n, std::size_t m, std::size_t n)
+{
+    int64_t acc = 0;
+
+    for(std::size_t k = 0; k < a_m_k.mDesc.GetLengths()[1]; ++k)
+    {
+        acc += static_cast<int64_t>(a_m_k(m, k)) * static_cast<int64_t>(b_k_n(k, n));
+    }
+
+    return acc;
+}
+
+} // namespace
+
+TEST(HostIntegerGemm, MatchesNaive)
+{
+    struct Problem
+    {
+        std::size_t M, N, K;
+        bool b_col_major;
+    };
+
+    // edge tiles and blocks, column major B, empty K
+    const std::vector<Problem> problems{{1, 1, 1, false},
+                                        {7, 5, 3, true},
+                                        {33, 67, 129, false},
+                                        {64, 64, 64, true},
+                                        {200, 150, 300, false},
+                                        {5, 3, 0, false}};
+
+    for(const auto& p : problems)
+    {
+        Tensor<int8_t> a_m_k(std::vector<std::size_t>{p.M, p.K});
+        Tensor<int8_t> b_k_n(std::vector<std::size_t>{p.K, p.N},
+                             p.b_col_major ? std::vector<std::size_t>{1, p.K}
+                                           : std::vector<std::size_t>{p.N, 1});
+
+        fill_random(a_m_k, -128, 127, 1);
+        fill_random(b_k_n, -128, 127, 2);
+
+        const auto acc = integer_gemm(a_m_k, b_k_n);
+
+        for(std::size_t m = 0; m < p.M; ++m)
+        {
+            for(std::size_t n = 0; n < p.N; ++n)
+            {
+                ASSERT_EQ(acc[m * p.N + n], naive_dot(a_m_k, b_k_n, m, n));
+            }
+        }
+    }
+}
+
+TEST(HostIntegerGemm, ExactBeyondFloat)
+{
+    // the sum -128 * -128 * 4097 + 1 is not representable in float
+    const std::size_t K = 4098;
+
+    Tensor<int8_t> a_m_k(std::vector<std::size_t>{1, K});
+    Tensor<int8_t> b_k_n(std::vector<std::size_t>{K, 1});
+
+    std::fill(a_m_k.begin(), a_m_k.end(), int8_t{-128});
+    std::fill(b_k_n.begin(), b_k_n.end(), int8_t{-128});
+    a_m_k(0, K - 1) = 1;
+    b_k_n(K - 1, 0) = 1;
+
+    EXPECT_EQ(integer_gemm(a_m_k, b_k_n)[0], 128 * 128 * 4097 + 1);
+}
+
+TEST(HostIntegerGemm, ReferenceGemmRequantization)
+{
+    using CDEElementOp = element_wise::Activation_Mul_Clamp<element_wise::Relu>;
+
+    const std::size_t M = 45, N = 70, K = 300;
+
+    Tensor<int8_t> a_m_k(std::vector<std::size_t>{M, K});
+    Tensor<int8_t> b_k_n(std::vector<std::size_t>{K, N});
+    Tensor<int8_t> e_m_n(std::vector<std::size_t>{M, N});
+
+    fill_random(a_m_k, -128, 127, 3);
+    fill_random(b_k_n, -128, 127, 4);
+
+    const auto cde_element_op = CDEElementOp{0.0003f, element_wise::Relu{}};
+
+    auto ref_gemm = ReferenceGemm<int8_t,
+                                  int8_t,
+                                  int8_t,
+                                  int32_t,
+                                  element_wise::PassThrough,
+                                  element_wise::PassThrough,
+                                  CDEElementOp>{};
+
+    static_assert(decltype(ref_gemm)::UseIntegerGemm);
+
+    auto ref_invoker = ref_gemm.MakeInvoker();
+    ref_invoker.Run(ref_gemm.MakeArgument(a_m_k,
+                                          b_k_n,
+                                          e_m_n,
+                                          element_wise::PassThrough{},
+                                          element_wise::PassThrough{},
+                                          cde_element_op));
+
+    for(std::size_t m = 0; m < M; ++m)
+    {
+        for(std::size_t n = 0; n < N; ++n)
+        {
+            int8_t expected;
+            cde_element_op(expected, static_cast<int32_t>(naive_dot(a_m_k, b_k_n, m, n)));
+
+            ASSERT_EQ(e_m_n(m, n), expected);
+        }
+    }
+}
+
+TEST(HostIntegerGemm, ReferenceConvFwd)
+{
+    using InLayout  = ck::tensor_layout::convolution::NHWGC;
+    using WeiLayout = ck::tensor_layout::convolution::GKYXC;
+    using OutLayout = ck::tensor_layout::convolution::NHWGK;
+
+    // groups, strides, dilations and asymmetric padding
+    const ck::utils::conv::ConvParam conv_param{
+        2, 2, 3, 5, 7, {3, 2}, {11, 9}, {2, 1}, {1, 2}, {1, 0}, {2, 1}};
+
+    Tensor<int8_t> in(
+        ck::utils::conv::make_input_host_tensor_descriptor_g_n_c_wis_packed<InLayout>(conv_param));
+    Tensor<int8_t> wei(
+        ck::utils::conv::make_weight_host_tensor_descriptor_g_k_c_xs_packed<WeiLayout>(
+            conv_param));
+    Tensor<int32_t> out(
+        ck::utils::conv::make_output_host_tensor_descriptor_g_n_k_wos_packed<OutLayout>(
+            conv_param));
+
+    fill_random(in, -128, 127, 5);
+    fill_random(wei, -128, 127, 6);
+
+    auto ref_conv = ReferenceConvFwd<2,
+                                     int8_t,
+                                     int8_t,
+                                     int32_t,
+                                     element_wise::PassThrough,
+                                     element_wise::PassThrough,
+                                     element_wise::PassThrough>{};
+
+    static_assert(decltype(ref_conv)::UseIntegerGemm);
+
+    auto ref_invoker = ref_conv.MakeInvoker();
+    ref_invoker.Run(ref_conv.MakeArgument(in,
+                                          wei,
+                                          out,
+                                          conv_param.conv_filter_strides_,
+                                          conv_param.conv_filter_dilations_,
+                                          conv_param.input_left_pads_,
+                                          conv_param.input_right_pads_,
+                                          element_wise::PassThrough{},
+                                          element_wise::PassThrough{},
+                                          element_wise::PassThrough{}));
+
+    const auto& out_lengths = out.GetLengths();
+    const auto& wei_lengths = wei.GetLengths();
+    const auto& in_lengths  = in.GetLengths();
+
+    out.ForEach([&](auto& self, const std::vector<std::size_t>& idx) {
+        const std::size_t g = idx[0], n = idx[1], k = idx[2], ho = idx[3], wo = idx[4];
+
+        int64_t expected = 0;
+
+        for(std::size_t c = 0; c < wei_lengths[2]; ++c)
+        {
+            for(std::size_t y = 0; y < wei_lengths[3]; ++y)
+            {
+                for(std::size_t x = 0; x < wei_lengths[4]; ++x)
+                {
+                    const auto hi = static_cast<int64_t>(ho * 2 + y * 1) - 1;
+                    const auto wi = static_cast<int64_t>(wo * 1 + x * 2) - 0;
+
+                    if(hi >= 0 && hi < static_cast<int64_t>(in_lengths[3]) && wi >= 0 &&
+                       wi < static_cast<int64_t>(in_lengths[4]))
+                    {
+                        expected += static_cast<int64_t>(in(g, n, c, hi, wi)) * wei(g, k, c, y, x);
+                    }
+                }
+            }
+        }
+
+        ASSERT_EQ(self(idx), expected);
+    });
+
+    EXPECT_EQ(out_lengths[3], 6);
+    EXPECT_EQ(out_lengths[4], 8);
+}
+
+#ifdef CK_EXPERIMENTAL_BIT_INT_EXTENSION_INT4
+TEST(HostIntegerGemm, Int4)
+{
+    const std::size_t M = 9, N = 13, K = 77;
+
+    Tensor<ck::int4_t> a_m_k(std::vector<std::size_t>{M, K});
+    Tensor<ck::int4_t> b_k_n(std::vector<std::size_t>{K, N});
+
+    fill_random(a_m_k, -8, 7, 7);
+    fill_random(b_k_n, -8, 7, 8);
+
+    const auto acc = integer_gemm(a_m_k, b_k_n);
+
+    for(std::size_t m = 0; m < M; ++m)
+    {
+        for(std::size_t n = 0; n < N; ++n)
+        {
+            ASSERT_EQ(acc[m * N + n], naive_dot(a_m_k, b_k_n, m, n));
+        }
+    }
+}
+#endif
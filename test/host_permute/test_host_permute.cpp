@@ -0,0 +1,219 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/unary_element_wise_operation.hpp"
+#include "ck/library/utility/host_permute.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+using ck::utils::make_host_permute_plan;
+using ck::utils::permute_host_tensor;
+using ck::utils::permute_host_tensor_in_place;
+using ck::utils::transpose_host_tensor_given_new2old;
+
+namespace {
+
+// dst(i...) == src(i_new2old...) checked index by index
+template <typename Src, typename Dst>
+void check_permuted(const Tensor<Src>& src,
+                    const std::vector<std::size_t>& new2old,
+                    const Tensor<Dst>& dst)
+{
+    const auto& lengths = dst.mDesc.GetLengths();
+
+    if(dst.mDesc.GetElementSize() == 0)
+    {
+        return;
+    }
+
+    std::vector<std::size_t> dst_idx(lengths.size(), 0);
+    std::vector<std::size_t> src_idx(lengths.size(), 0);
+
+    bool done = false;
+    while(!done)
+    {
+        for(std::size_t i = 0; i < lengths.size(); ++i)
+        {
+            src_idx[new2old[i]] = dst_idx[i];
+        }
+
+        const auto expected = src.mData[src.mDesc.GetOffsetFromMultiIndex(src_idx)];
+        const auto actual   = dst.mData[dst.mDesc.GetOffsetFromMultiIndex(dst_idx)];
+
+        ASSERT_EQ(static_cast<Dst>(expected), actual);
+
+        done = true;
+        for(std::size_t i = lengths.size(); i > 0; --i)
+        {
+            if(++dst_idx[i - 1] < lengths[i - 1])
+            {
+                done = false;
+                break;
+            }
+
+            dst_idx[i - 1] = 0;
+        }
+    }
+}
+
+template <typename T>
+Tensor<T> make_iota_tensor(const std::vector<std::size_t>& lengths)
+{
+    Tensor<T> tensor(lengths);
+
+    std::iota(tensor.mData.begin(), tensor.mData.end(), T{0});
+
+    return tensor;
+}
+
+std::vector<std::size_t> permuted(const std::vector<std::size_t>& lengths,
+                                  const std::vector<std::size_t>& new2old)
+{
+    std::vector<std::size_t> result;
+
+    for(std::size_t i : new2old)
+    {
+        result.push_back(lengths[i]);
+    }
+
+    return result;
+}
+
+} // namespace
+
+TEST(HostPermute, PlanMergesDimensions)
+{
+    // NCDHW -> NDHWC is a batch of [C, DHW] -> [DHW, C] transposes
+    const HostTensorDescriptor src({2, 3, 4, 5, 6});
+    const HostTensorDescriptor dst({2, 4, 5, 6, 3});
+
+    const auto plan = make_host_permute_plan(src, dst, {0, 2, 3, 4, 1});
+
+    EXPECT_EQ(plan.lengths_, (std::vector<std::size_t>{2, 120, 3}));
+    EXPECT_EQ(plan.src_strides_, (std::vector<std::size_t>{360, 1, 120}));
+    EXPECT_EQ(plan.dst_strides_, (std::vector<std::size_t>{360, 3, 1}));
+    EXPECT_EQ(plan.src_inner_, 1);
+    EXPECT_EQ(plan.dst_inner_, 2);
+
+    // identity up to unit dimensions is a single row
+    const auto copy_plan = make_host_permute_plan(
+        HostTensorDescriptor({4, 1, 5}), HostTensorDescriptor({1, 4, 5}), {1, 0, 2});
+
+    EXPECT_EQ(copy_plan.lengths_, (std::vector<std::size_t>{20}));
+}
+
+TEST(HostPermute, MatchesIndexByIndex)
+{
+    struct Problem
+    {
+        std::vector<std::size_t> lengths;
+        std::vector<std::size_t> new2old;
+    };
+
+    const std::vector<Problem> problems{
+        {{67, 45}, {1, 0}},
+        {{512, 384}, {1, 0}},
+        {{2, 37, 19, 23}, {0, 2, 3, 1}},   // NCHW -> NHWC
+        {{2, 19, 23, 37}, {0, 3, 1, 2}},   // NHWC -> NCHW
+        {{3, 5, 7, 11, 13}, {0, 2, 3, 4, 1}},
+        {{3, 5, 7, 11, 13}, {4, 3, 2, 1, 0}},
+        {{3, 1, 7, 1, 13}, {3, 4, 1, 0, 2}},
+        {{8, 8, 8}, {0, 1, 2}},
+        {{4, 0, 5}, {2, 1, 0}},
+        {{1, 1}, {1, 0}},
+        {{2, 3, 4, 5, 6, 7}, {5, 0, 4, 1, 3, 2}},
+    };
+
+    for(const auto& p : problems)
+    {
+        const auto src = make_iota_tensor<float>(p.lengths);
+
+        Tensor<float> dst(permuted(p.lengths, p.new2old));
+
+        permute_host_tensor(src, p.new2old, dst);
+        check_permuted(src, p.new2old, dst);
+
+        check_permuted(src, p.new2old, transpose_host_tensor_given_new2old(src, p.new2old));
+    }
+}
+
+TEST(HostPermute, LargeTensorInParallel)
+{
+    // above the parallel threshold, with edges in both transposed dimensions
+    const std::vector<std::size_t> lengths{3, 101, 29, 37};
+    const std::vector<std::size_t> new2old{0, 2, 3, 1};
+
+    const auto src = make_iota_tensor<int>(lengths);
+
+    Tensor<int> dst(permuted(lengths, new2old));
+
+    permute_host_tensor(src, new2old, dst);
+    check_permuted(src, new2old, dst);
+}
+
+TEST(HostPermute, StridedTensorsAndElementOp)
+{
+    // padded source rows, column major destination, conversion to double
+    const std::vector<std::size_t> lengths{13, 70};
+
+    Tensor<float> src(lengths, std::vector<std::size_t>{75, 1});
+    std::iota(src.mData.begin(), src.mData.end(), 0.f);
+
+    Tensor<double> dst(std::vector<std::size_t>{70, 13}, std::vector<std::size_t>{1, 70});
+
+    permute_host_tensor(src, {1, 0}, dst, ck::tensor_operation::element_wise::PassThrough{});
+    check_permuted(src, {1, 0}, dst);
+
+    // scaled
+    Tensor<float> scaled(std::vector<std::size_t>{70, 13});
+
+    permute_host_tensor(src, {1, 0}, scaled, ck::tensor_operation::element_wise::Scale{2.f});
+
+    for(std::size_t m = 0; m < 13; ++m)
+    {
+        for(std::size_t n = 0; n < 70; ++n)
+        {
+            EXPECT_EQ(scaled(n, m), 2.f * src(m, n));
+        }
+    }
+}
+
+TEST(HostPermute, InPlace)
+{
+    const std::vector<std::vector<std::size_t>> new2olds{
+        {0, 2, 3, 1}, {0, 3, 1, 2}, {3, 2, 1, 0}, {0, 1, 2, 3}, {1, 0, 2, 3}};
+
+    for(const auto& new2old : new2olds)
+    {
+        const std::vector<std::size_t> lengths{2, 7, 5, 9};
+
+        const auto src = make_iota_tensor<float>(lengths);
+        auto tensor    = src;
+
+        permute_host_tensor_in_place(tensor, new2old);
+
+        EXPECT_EQ(tensor.mDesc.GetLengths(), permuted(lengths, new2old));
+        check_permuted(src, new2old, tensor);
+    }
+}
+
+TEST(HostPermute, InvalidArguments)
+{
+    const auto src = make_iota_tensor<float>({2, 3});
+
+    Tensor<float> dst({3, 2});
+    Tensor<float> wrong_lengths({2, 3});
+
+    EXPECT_THROW(permute_host_tensor(src, {0, 0}, dst), std::runtime_error);
+    EXPECT_THROW(permute_host_tensor(src, {1, 0, 2}, dst), std::runtime_error);
+    EXPECT_THROW(permute_host_tensor(src, {1, 0}, wrong_lengths), std::runtime_error);
+
+    Tensor<float> padded(std::vector<std::size_t>{2, 3}, std::vector<std::size_t>{4, 1});
+
+    EXPECT_THROW(permute_host_tensor_in_place(padded, {1, 0}), std::runtime_error);
+}
@@ -0,0 +1,143 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_file.hpp"
+
+using ck::utils::HostTensorFile;
+using ck::utils::load_host_tensor;
+using ck::utils::save_host_tensor;
+
+namespace {
+
+class TemporaryFile
+{
+    public:
+    explicit TemporaryFile(const std::string& name)
+        : path_(testing::TempDir() + "test_host_tensor_file_" + name + ".npy")
+    {
+    }
+
+    ~TemporaryFile() { std::remove(path_.c_str()); }
+
+    const std::string& GetPath() const { return path_; }
+
+    private:
+    std::string path_;
+};
+
+template <typename T>
+void fill_sequence(Tensor<T>& tensor)
+{
+    int v = 0;
+
+    tensor.ForEach([&](auto& self, const std::vector<std::size_t>& idx) {
+        self(idx) = static_cast<T>(v++ % 127);
+    });
+}
+
+template <typename T>
+void expect_same_elements(const Tensor<T>& a, const Tensor<T>& b)
+{
+    ASSERT_EQ(a.mDesc.GetLengths(), b.mDesc.GetLengths());
+
+    a.ForEach([&](const auto& self, const std::vector<std::size_t>& idx) {
+        ASSERT_EQ(self(idx), b(idx));
+    });
+}
+
+} // namespace
+
+TEST(HostTensorFile, RowMajorRoundTrip)
+{
+    const TemporaryFile file("row_major");
+
+    Tensor<float> tensor(std::vector<std::size_t>{3, 5, 7});
+    fill_sequence(tensor);
+
+    save_host_tensor(file.GetPath(), tensor);
+
+    const HostTensorFile mapped(file.GetPath());
+
+    EXPECT_EQ(mapped.GetDataType(), "<f4");
+    EXPECT_EQ(mapped.GetLengths(), tensor.mDesc.GetLengths());
+    EXPECT_FALSE(mapped.IsFortranOrder());
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(mapped.GetData()) % 64, 0);
+
+    const auto loaded = load_host_tensor<float>(file.GetPath());
+
+    EXPECT_EQ(loaded.mDesc.GetStrides(), tensor.mDesc.GetStrides());
+    EXPECT_EQ(loaded.mData, tensor.mData);
+}
+
+TEST(HostTensorFile, PaddedColumnMajor)
+{
+    const TemporaryFile file("column_major");
+
+    // K x N tensor B stored column major with a padded leading dimension
+    const std::size_t K = 33, N = 20, StrideB = 40;
+
+    Tensor<int8_t> tensor(std::vector<std::size_t>{K, N}, std::vector<std::size_t>{1, StrideB});
+    fill_sequence(tensor);
+
+    save_host_tensor(file.GetPath(), tensor);
+
+    const HostTensorFile mapped(file.GetPath());
+
+    EXPECT_EQ(mapped.GetDataType(), "|i1");
+    EXPECT_TRUE(mapped.IsFortranOrder());
+    EXPECT_EQ(mapped.GetDataBytes(), K * N);
+
+    // into the same padded layout and into a row major one
+    Tensor<int8_t> padded(std::vector<std::size_t>{K, N}, std::vector<std::size_t>{1, StrideB});
+    Tensor<int8_t> row_major(std::vector<std::size_t>{K, N});
+
+    load_host_tensor(mapped, padded);
+    load_host_tensor(mapped, row_major);
+
+    expect_same_elements(padded, tensor);
+    expect_same_elements(row_major, tensor);
+}
+
+TEST(HostTensorFile, StreamedInChunks)
+{
+    const TemporaryFile file("chunks");
+
+    // rows of 1 MiB with padding, so that every chunk holds one row
+    const std::size_t M = 5, N = 262144;
+
+    Tensor<float> tensor(std::vector<std::size_t>{M, N}, std::vector<std::size_t>{N + 3, 1});
+    fill_sequence(tensor);
+
+    save_host_tensor(file.GetPath(), tensor);
+
+    const auto loaded = load_host_tensor<float>(file.GetPath());
+
+    expect_same_elements(loaded, tensor);
+}
+
+TEST(HostTensorFile, Errors)
+{
+    const TemporaryFile file("errors");
+
+    Tensor<float> tensor(std::vector<std::size_t>{4, 4});
+    fill_sequence(tensor);
+
+    save_host_tensor(file.GetPath(), tensor);
+
+    const HostTensorFile mapped(file.GetPath());
+
+    Tensor<int32_t> wrong_type(std::vector<std::size_t>{4, 4});
+    Tensor<float> wrong_lengths(std::vector<std::size_t>{4, 5});
+
+    EXPECT_THROW(load_host_tensor(mapped, wrong_type), std::runtime_error);
+    EXPECT_THROW(load_host_tensor(mapped, wrong_lengths), std::runtime_error);
+    EXPECT_THROW(HostTensorFile(file.GetPath() + ".missing"), std::runtime_error);
+}
@@ -0,0 +1,206 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_description/tensor_descriptor.hpp"
+#include "ck/tensor_description/tensor_descriptor_helper.hpp"
+#include "ck/tensor_description/tensor_adaptor.hpp"
+#include "ck/library/utility/host_transform_program.hpp"
+
+using namespace ck;
+
+using ck::utils::HostTransformProgram;
+using ck::utils::make_host_transform_program;
+
+static constexpr auto I0 = Number<0>{};
+static constexpr auto I1 = Number<1>{};
+static constexpr auto I2 = Number<2>{};
+
+// offsets of the whole index space of desc computed through tensor coordinates
+template <typename Desc>
+std::vector<long_index_t> reference_offsets(const Desc& desc)
+{
+    constexpr index_t NDim = Desc::GetNumOfDimension();
+
+    index_t size = 1;
+
+    static_for<0, NDim, 1>{}([&](auto i) { size *= desc.GetLength(i); });
+
+    std::vector<long_index_t> offsets;
+
+    for(index_t linear = 0; linear < size; ++linear)
+    {
+        auto idx = make_zero_multi_index<NDim>();
+
+        index_t r = linear;
+
+        static_for<NDim - 1, -1, -1>{}([&](auto i) {
+            idx(i) = r % desc.GetLength(i);
+            r /= desc.GetLength(i);
+        });
+
+        const auto coord = make_tensor_coordinate(desc, idx);
+
+        offsets.push_back(coordinate_has_valid_offset(desc, coord) ? coord.GetOffset()
+                                                                   : HostTransformProgram::InvalidOffset);
+    }
+
+    return offsets;
+}
+
+template <typename Desc>
+void check_program(const Desc& desc, bool expect_row_affine)
+{
+    const auto program = make_host_transform_program(desc);
+
+    EXPECT_EQ(program.IsRowAffine(), expect_row_affine);
+
+    const auto ref = reference_offsets(desc);
+
+    EXPECT_EQ(program.GetTopElementSize(), ref.size());
+    EXPECT_EQ(program.CalculateOffsets(1), ref);
+    EXPECT_EQ(program.CalculateOffsets(4), ref);
+}
+
+TEST(HostTransformProgram, Packed)
+{
+    const auto desc = make_naive_tensor_descriptor_packed(make_tuple(3, 5, 7));
+
+    check_program(desc, true);
+
+    const auto program = make_host_transform_program(desc);
+
+    EXPECT_EQ(program.CalculateOffset({2, 4, 6}), 3 * 5 * 7 - 1);
+}
+
+TEST(HostTransformProgram, StridedPad)
+{
+    const index_t N = 2, H = 5, W = 6, C = 3;
+
+    const auto desc_nhwc =
+        make_naive_tensor_descriptor(make_tuple(N, H, W, C), make_tuple(H * W * C + 4, W * C, C, 1));
+
+    // right pad and left pad along the innermost dimension
+    const auto desc = transform_tensor_descriptor(
+        desc_nhwc,
+        make_tuple(make_pass_through_transform(N),
+                   make_pad_transform(H, 1, 2),
+                   make_pass_through_transform(W),
+                   make_pad_transform(C, 2, 1)),
+        make_tuple(Sequence<0>{}, Sequence<1>{}, Sequence<2>{}, Sequence<3>{}),
+        make_tuple(Sequence<0>{}, Sequence<1>{}, Sequence<2>{}, Sequence<3>{}));
+
+    check_program(desc, true);
+}
+
+TEST(HostTransformProgram, Im2Col)
+{
+    const index_t N = 2, Hi = 7, Wi = 6, C = 3;
+    const index_t Y = 3, X = 2;
+    const index_t StrideH = 2, StrideW = 1, DilationH = 1, DilationW = 2;
+    const index_t LeftPadH = 1, LeftPadW = 1, RightPadH = 1, RightPadW = 0;
+
+    const index_t Ho = (Hi + LeftPadH + RightPadH - DilationH * (Y - 1) - 1) / StrideH + 1;
+    const index_t Wo = (Wi + LeftPadW + RightPadW - DilationW * (X - 1) - 1) / StrideW + 1;
+
+    const auto in_n_hi_wi_c = make_naive_tensor_descriptor_packed(make_tuple(N, Hi, Wi, C));
+
+    const auto in_n_hip_wip_c = transform_tensor_descriptor(
+        in_n_hi_wi_c,
+        make_tuple(make_pass_through_transform(N),
+                   make_pad_transform(Hi, LeftPadH, RightPadH),
+                   make_pad_transform(Wi, LeftPadW, RightPadW),
+                   make_pass_through_transform(C)),
+        make_tuple(Sequence<0>{}, Sequence<1>{}, Sequence<2>{}, Sequence<3>{}),
+        make_tuple(Sequence<0>{}, Sequence<1>{}, Sequence<2>{}, Sequence<3>{}));
+
+    const auto in_n_y_ho_x_wo_c = transform_tensor_descriptor(
+        in_n_hip_wip_c,
+        make_tuple(make_pass_through_transform(N),
+                   make_embed_transform(make_tuple(Y, Ho), make_tuple(DilationH, StrideH)),
+                   make_embed_transform(make_tuple(X, Wo), make_tuple(DilationW, StrideW)),
+                   make_pass_through_transform(C)),
+        make_tuple(Sequence<0>{}, Sequence<1>{}, Sequence<2>{}, Sequence<3>{}),
+        make_tuple(Sequence<0>{}, Sequence<1, 2>{}, Sequence<3, 4>{}, Sequence<5>{}));
+
+    const auto in_gemmm_gemmk = transform_tensor_descriptor(
+        in_n_y_ho_x_wo_c,
+        make_tuple(make_merge_transform(make_tuple(N, Ho, Wo)),
+                   make_merge_transform(make_tuple(Y, X, C))),
+        make_tuple(Sequence<0, 2, 4>{}, Sequence<1, 3, 5>{}),
+        make_tuple(Sequence<0>{}, Sequence<1>{}));
+
+    // the innermost dimension goes through a merge
+    check_program(in_gemmm_gemmk, false);
+
+    // the same view with an unmerged GemmK, innermost dimension C is affine again
+    const auto in_gemmm_y_x_c = transform_tensor_descriptor(
+        in_n_y_ho_x_wo_c,
+        make_tuple(make_merge_transform(make_tuple(N, Ho, Wo)),
+                   make_pass_through_transform(Y),
+                   make_pass_through_transform(X),
+                   make_pass_through_transform(C)),
+        make_tuple(Sequence<0, 2, 4>{}, Sequence<1>{}, Sequence<3>{}, Sequence<5>{}),
+        make_tuple(Sequence<0>{}, Sequence<1>{}, Sequence<2>{}, Sequence<3>{}));
+
+    check_program(in_gemmm_y_x_c, true);
+}
+
+TEST(HostTransformProgram, UnMergeAndMagicDivisionMerge)
+{
+    const index_t M = 6, K = 20, K1 = 4;
+
+    const auto desc_m_k = make_naive_tensor_descriptor(make_tuple(M, K), make_tuple(K + 3, 1));
+
+    const auto desc_k0_m_k1 = transform_tensor_descriptor(
+        desc_m_k,
+        make_tuple(make_pass_through_transform(M),
+                   make_unmerge_transform(make_tuple(K / K1, K1))),
+        make_tuple(Sequence<0>{}, Sequence<1>{}),
+        make_tuple(Sequence<1>{}, Sequence<0, 2>{}));
+
+    check_program(desc_k0_m_k1, true);
+
+    const auto desc_mk = transform_tensor_descriptor(
+        desc_k0_m_k1,
+        make_tuple(make_merge_transform_v2_magic_division(make_tuple(K / K1, M, K1))),
+        make_tuple(Sequence<0, 1, 2>{}),
+        make_tuple(Sequence<0>{}));
+
+    check_program(desc_mk, false);
+}
+
+TEST(HostTransformProgram, Adaptor)
+{
+    const index_t M0 = 3, M1 = 4, M2 = 5;
+
+    const auto adaptor = make_single_stage_tensor_adaptor(
+        make_tuple(make_merge_transform(make_tuple(M0, M1, M2))),
+        make_tuple(Sequence<0, 1, 2>{}),
+        make_tuple(Sequence<0>{}));
+
+    const auto program = make_host_transform_program(adaptor);
+
+    ASSERT_EQ(program.GetNumOfTopDimension(), 1);
+    ASSERT_EQ(program.GetNumOfBottomDimension(), 3);
+
+    std::vector<long_index_t> registers(program.GetNumOfRegister());
+
+    for(long_index_t m = 0; m < M0 * M1 * M2; ++m)
+    {
+        long_index_t bottom[3];
+
+        EXPECT_TRUE(program.Run(&m, bottom, registers.data()));
+
+        const auto idx = adaptor.CalculateBottomIndex(make_multi_index(m));
+
+        EXPECT_EQ(bottom[0], idx[I0]);
+        EXPECT_EQ(bottom[1], idx[I1]);
+        EXPECT_EQ(bottom[2], idx[I2]);
+    }
+
+    EXPECT_THROW(program.CalculateOffsets(), std::runtime_error);
+}
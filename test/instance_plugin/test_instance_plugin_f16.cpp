@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <fstream>
+#include <iostream>
+#include <unistd.h>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/library/tensor_operation_instance/gpu/gemm.hpp"
+#include "ck/library/tensor_operation_instance/instance_plugin.hpp"
+
+using ck::tensor_operation::device::instance::get_instance_plugins;
+
+namespace {
+
+// resident set size in MiB
+double get_rss()
+{
+    long pages = 0;
+    long resident = 0;
+
+    std::ifstream("/proc/self/statm") >> pages >> resident;
+
+    return static_cast<double>(resident) * sysconf(_SC_PAGESIZE) / (1024 * 1024);
+}
+
+} // namespace
+
+TEST(InstancePlugin, LoadsOnlyRequestedFamily)
+{
+    using Row = ck::tensor_layout::gemm::RowMajor;
+    using F16 = ck::half_t;
+    using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+    using DeviceOp = ck::tensor_operation::device::
+        DeviceGemm<Row, Row, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>;
+
+    const auto plugins = get_instance_plugins();
+
+    ASSERT_FALSE(plugins.empty());
+
+    for(const auto& plugin : plugins)
+    {
+        EXPECT_FALSE(plugin.loaded_) << plugin.file_;
+    }
+
+    const double rss_before = get_rss();
+
+    const auto op_ptrs = ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<
+        DeviceOp>::GetInstances();
+
+    const double rss_after = get_rss();
+
+    EXPECT_FALSE(op_ptrs.empty());
+
+    int num_loaded = 0;
+
+    for(const auto& plugin : get_instance_plugins())
+    {
+        if(plugin.loaded_)
+        {
+            EXPECT_EQ(plugin.family_, "gemm") << plugin.file_;
+            EXPECT_EQ(plugin.data_type_, "f16") << plugin.file_;
+
+            ++num_loaded;
+        }
+    }
+
+    EXPECT_GE(num_loaded, 1);
+
+    std::cout << op_ptrs.size() << " instances from " << num_loaded << " of " << plugins.size()
+              << " plugins, resident set " << rss_before << " MiB -> " << rss_after << " MiB"
+              << std::endl;
+}
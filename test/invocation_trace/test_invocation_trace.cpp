@@ -0,0 +1,221 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/host_utility/invocation_trace.hpp"
+#include "ck/tensor_operation/gpu/device/device_base_trace.hpp"
+
+using ck::InvocationProblem;
+using ck::InvocationTraceEvent;
+using ck::InvocationTracer;
+using ck::InvocationTraceRecord;
+using ck::InvocationTraceRing;
+using ck::tensor_operation::device::BaseArgument;
+using ck::tensor_operation::device::BaseInvoker;
+using ck::tensor_operation::device::BaseOperator;
+using ck::tensor_operation::device::make_traced_argument_pointer;
+using ck::tensor_operation::device::run_traced;
+
+namespace {
+
+// a device operation that does nothing, with a workspace of 4 bytes per element
+struct FakeOperator : public BaseOperator
+{
+    struct Argument : public BaseArgument
+    {
+        int64_t length_;
+    };
+
+    struct Invoker : public BaseInvoker
+    {
+        float Run(const BaseArgument*, const StreamConfig& = StreamConfig{}) override
+        {
+            return 1.5f;
+        }
+    };
+
+    std::unique_ptr<BaseArgument> MakeArgumentPointer(int64_t length)
+    {
+        auto argument     = std::make_unique<Argument>();
+        argument->length_ = length;
+
+        return argument;
+    }
+
+    size_t GetWorkSpaceSize(const BaseArgument* p_arg) const override
+    {
+        return 4 * static_cast<const Argument*>(p_arg)->length_;
+    }
+};
+
+std::string temporary_path()
+{
+    return testing::TempDir() + "test_invocation_trace.cktrace";
+}
+
+void invoke(FakeOperator& op, int64_t length, int num_run)
+{
+    auto argument_ptr =
+        make_traced_argument_pointer(op, InvocationProblem{"fake", 1, 0, {length, 7}}, length);
+
+    FakeOperator::Invoker invoker;
+
+    for(int i = 0; i < num_run; ++i)
+    {
+        EXPECT_EQ(run_traced(op, invoker, argument_ptr.get(), StreamConfig{nullptr, true}), 1.5f);
+    }
+}
+
+} // namespace
+
+TEST(InvocationTrace, RingDropsWhenFull)
+{
+    InvocationTraceRing ring;
+    InvocationTraceRecord record;
+
+    for(std::size_t i = 0; i < ck::InvocationTraceRingCapacity; ++i)
+    {
+        record.argument_id_ = i;
+        EXPECT_TRUE(ring.Push(record));
+    }
+
+    EXPECT_FALSE(ring.Push(record));
+
+    std::size_t num_drained = 0;
+
+    ring.Drain([&](const InvocationTraceRecord& r) { EXPECT_EQ(r.argument_id_, num_drained++); });
+
+    EXPECT_EQ(num_drained, ck::InvocationTraceRingCapacity);
+    EXPECT_TRUE(ring.Push(record));
+}
+
+TEST(InvocationTrace, RecordsFromThreads)
+{
+    const std::string path = temporary_path();
+
+    auto& tracer = InvocationTracer::GetInstance();
+
+    FakeOperator op;
+
+    // nothing is recorded while tracing is off
+    invoke(op, 1, 1);
+
+    ASSERT_TRUE(tracer.Start(path));
+    ASSERT_TRUE(InvocationTracer::IsEnabled());
+
+    const int num_thread = 4;
+    const int num_run    = 100;
+
+    std::vector<std::thread> threads;
+
+    for(int t = 0; t < num_thread; ++t)
+    {
+        threads.emplace_back([&, t] { invoke(op, 10 + t, num_run); });
+    }
+
+    for(auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    tracer.Stop();
+
+    EXPECT_FALSE(InvocationTracer::IsEnabled());
+
+    const auto records = ck::read_invocation_trace(path);
+
+    std::remove(path.c_str());
+
+    ASSERT_EQ(records.size() + tracer.GetNumDropped(), num_thread * (1 + num_run));
+
+    std::map<uint64_t, int64_t> argument_lengths;
+    std::map<int64_t, int> num_runs;
+
+    for(const auto& record : records)
+    {
+        EXPECT_EQ(record.instance_hash_, typeid(FakeOperator).hash_code());
+
+        if(record.event_ == static_cast<uint32_t>(InvocationTraceEvent::MakeArgument))
+        {
+            EXPECT_STREQ(record.problem_.operation_, "fake");
+            ASSERT_EQ(record.problem_.num_value_, 2);
+            EXPECT_EQ(record.workspace_bytes_, 4 * record.problem_.values_[0]);
+
+            argument_lengths[record.argument_id_] = record.problem_.values_[0];
+        }
+        else
+        {
+            EXPECT_EQ(record.time_ms_, 1.5f);
+
+            // sorted by time, so the argument is recorded before its runs
+            ASSERT_EQ(argument_lengths.count(record.argument_id_), 1);
+
+            num_runs[argument_lengths[record.argument_id_]] += 1;
+        }
+    }
+
+    if(tracer.GetNumDropped() == 0)
+    {
+        for(int t = 0; t < num_thread; ++t)
+        {
+            EXPECT_EQ(num_runs[10 + t], num_run);
+        }
+    }
+}
+
+TEST(InvocationTrace, ReleasesRingsOfExitedThreads)
+{
+    const std::string path = temporary_path();
+
+    auto& tracer = InvocationTracer::GetInstance();
+
+    FakeOperator op;
+
+    ASSERT_TRUE(tracer.Start(path));
+
+    const std::size_t num_ring = tracer.GetNumRings();
+
+    // threads that come and go, one ring each while they run
+    for(int t = 0; t < 16; ++t)
+    {
+        std::thread([&, t] { invoke(op, t, 1); }).join();
+    }
+
+    tracer.Stop();
+
+    const auto records = ck::read_invocation_trace(path);
+
+    std::remove(path.c_str());
+
+    EXPECT_EQ(records.size() + tracer.GetNumDropped(), 16 * 2);
+    EXPECT_EQ(tracer.GetNumRings(), num_ring);
+}
+
+TEST(InvocationTrace, StartDiscardsLeftoverRecords)
+{
+    const std::string path = temporary_path();
+
+    auto& tracer = InvocationTracer::GetInstance();
+
+    ASSERT_TRUE(tracer.Start(path));
+    tracer.Stop();
+
+    // a record that missed the last flush of the previous trace
+    InvocationTraceRecord record;
+    tracer.Record(record);
+
+    ASSERT_TRUE(tracer.Start(path));
+    tracer.Stop();
+
+    EXPECT_TRUE(ck::read_invocation_trace(path).empty());
+
+    std::remove(path.c_str());
+}
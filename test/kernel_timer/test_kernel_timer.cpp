@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/stream_config.hpp"
+#include "ck/host_utility/kernel_timer.hpp"
+
+using ck::compute_timing_stats;
+using ck::HostTimer;
+using ck::TimingStats;
+
+TEST(TimingStats, Percentiles)
+{
+    std::vector<float> samples;
+
+    // 1 ... 100 in shuffled order
+    for(int i = 0; i < 100; ++i)
+    {
+        samples.push_back(static_cast<float>((i * 37) % 100 + 1));
+    }
+
+    const auto stats = compute_timing_stats(samples);
+
+    EXPECT_EQ(stats.samples_, samples);
+    EXPECT_FLOAT_EQ(stats.min_, 1.f);
+    EXPECT_FLOAT_EQ(stats.max_, 100.f);
+    EXPECT_FLOAT_EQ(stats.mean_, 50.5f);
+    EXPECT_FLOAT_EQ(stats.median_, 50.5f);
+    EXPECT_NEAR(stats.p90_, 90.1f, 1e-4f);
+    EXPECT_NEAR(stats.p99_, 99.01f, 1e-4f);
+    EXPECT_NEAR(stats.stddev_, 29.011f, 1e-3f);
+    EXPECT_EQ(stats.num_rejected_, 0);
+}
+
+TEST(TimingStats, OutlierRejection)
+{
+    // bimodal: mostly 1 ms, a few 10 ms runs
+    std::vector<float> samples(20, 1.f);
+
+    samples[3]  = 10.f;
+    samples[11] = 10.f;
+
+    const auto kept = compute_timing_stats(samples);
+
+    EXPECT_FLOAT_EQ(kept.max_, 10.f);
+    EXPECT_GT(kept.p99_, 1.f);
+
+    const auto rejected = compute_timing_stats(samples, true);
+
+    EXPECT_EQ(rejected.num_rejected_, 2);
+    EXPECT_EQ(rejected.samples_.size(), samples.size());
+    EXPECT_FLOAT_EQ(rejected.mean_, 1.f);
+    EXPECT_FLOAT_EQ(rejected.max_, 1.f);
+    EXPECT_FLOAT_EQ(rejected.stddev_, 0.f);
+}
+
+TEST(TimingStats, Empty)
+{
+    const auto stats = compute_timing_stats({});
+
+    EXPECT_TRUE(stats.Empty());
+    EXPECT_EQ(stats.mean_, 0.f);
+}
+
+// time a host workload through the same path as kernel launches, no device needed
+TEST(TimeKernelRuns, HostTimerSamples)
+{
+    HostTimer timer;
+    TimingStats stats;
+
+    int num_run        = 0;
+    int num_preprocess = 0;
+
+    StreamConfig config{nullptr, true, 0, 2, 8};
+
+    config.timer_ = &timer;
+    config.stats_ = &stats;
+
+    const float mean = ck::time_kernel_runs(
+        config,
+        [&] {
+            ++num_run;
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        },
+        [&] { ++num_preprocess; });
+
+    EXPECT_EQ(num_run, 2 + 8);
+    EXPECT_EQ(num_preprocess, 1 + 8);
+    EXPECT_EQ(stats.samples_.size(), 8);
+    EXPECT_EQ(stats.num_warmup_, 2);
+    EXPECT_GE(stats.min_, 2.f);
+    EXPECT_FLOAT_EQ(mean, stats.mean_);
+}
+
+TEST(TimeKernelRuns, BatchedMean)
+{
+    HostTimer timer;
+
+    int num_run = 0;
+
+    StreamConfig config{nullptr, true, 0, 1, 4};
+
+    config.timer_ = &timer;
+
+    const float mean = ck::time_kernel_runs(
+        config,
+        [&] {
+            ++num_run;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        },
+        [] {});
+
+    EXPECT_EQ(num_run, 1 + 4);
+    EXPECT_GE(mean, 1.f);
+}
+
+TEST(TimeKernelRuns, WarmupUntilStable)
+{
+    HostTimer timer;
+    TimingStats stats;
+
+    int num_run = 0;
+
+    StreamConfig config{nullptr, true, 0, 0, 4};
+
+    config.timer_               = &timer;
+    config.stats_               = &stats;
+    config.warmup_until_stable_ = true;
+    config.max_warmup_iters_    = 50;
+    config.stable_tolerance_    = 0.5f;
+
+    // first runs are slow, then settle at 1 ms
+    ck::time_kernel_runs(
+        config,
+        [&] {
+            ++num_run;
+            std::this_thread::sleep_for(std::chrono::milliseconds(num_run < 4 ? 20 : 1));
+        },
+        [] {});
+
+    EXPECT_GE(stats.num_warmup_, 5);
+    EXPECT_LT(stats.num_warmup_, 50);
+    EXPECT_LT(stats.max_, 10.f);
+}
@@ -43,6 +43,28 @@ gpu_naive_division(int32_t divisor, const int32_t* p_dividend, int32_t* p_result
     }
 }
 
+// full 32-bit range: uint32_t quotient and remainder, int64_t quotient of the dividend scaled up
+// past 32 bits
+__global__ void gpu_full_range_division(ck::MDivFullRange mdiv,
+                                        ck::MDiv64 mdiv64,
+                                        const uint32_t* p_dividend,
+                                        uint32_t* p_quotient,
+                                        uint32_t* p_remainder,
+                                        int64_t* p_quotient64,
+                                        uint64_t num)
+{
+    uint64_t global_thread_num = blockDim.x * gridDim.x;
+
+    uint64_t global_thread_id = blockIdx.x * blockDim.x + threadIdx.x;
+
+    for(uint64_t data_id = global_thread_id; data_id < num; data_id += global_thread_num)
+    {
+        mdiv.divmod(p_dividend[data_id], p_quotient[data_id], p_remainder[data_id]);
+
+        p_quotient64[data_id] = mdiv64.div(-(static_cast<int64_t>(p_dividend[data_id]) << 20));
+    }
+}
+
 __host__ void cpu_magic_number_division(uint32_t magic_multiplier,
                                         uint32_t magic_shift,
                                         const int32_t* p_dividend,
@@ -137,6 +159,61 @@ int main(int, char*[])
         }
     }
 
+    // full range uint32_t and 64-bit signed division on device
+    std::vector<uint32_t> dividends_u32(num_dividend);
+
+    for(uint64_t i = 0; i < num_dividend; ++i)
+    {
+        // spread over the whole uint32_t range, including the top
+        dividends_u32[i] = static_cast<uint32_t>(0xffffffffULL - i * 65519ULL);
+    }
+
+    DeviceMem dividends_u32_dev_buf(sizeof(uint32_t) * num_dividend);
+    DeviceMem quotient_u32_dev_buf(sizeof(uint32_t) * num_dividend);
+    DeviceMem remainder_u32_dev_buf(sizeof(uint32_t) * num_dividend);
+    DeviceMem quotient_i64_dev_buf(sizeof(int64_t) * num_dividend);
+
+    dividends_u32_dev_buf.ToDevice(dividends_u32.data());
+
+    std::vector<uint32_t> quotient_u32(num_dividend);
+    std::vector<uint32_t> remainder_u32(num_dividend);
+    std::vector<int64_t> quotient_i64(num_dividend);
+
+    for(uint32_t divisor : {1U, 3U, 641U, 0x7fffffffU, 0x80000000U, 0x80000001U, 0xffffffffU})
+    {
+        const int64_t divisor64 = (static_cast<int64_t>(divisor) << 3) + 1;
+
+        gpu_full_range_division<<<1024, 256>>>(
+            ck::MDivFullRange{divisor},
+            ck::MDiv64{divisor64},
+            static_cast<const uint32_t*>(dividends_u32_dev_buf.GetDeviceBuffer()),
+            static_cast<uint32_t*>(quotient_u32_dev_buf.GetDeviceBuffer()),
+            static_cast<uint32_t*>(remainder_u32_dev_buf.GetDeviceBuffer()),
+            static_cast<int64_t*>(quotient_i64_dev_buf.GetDeviceBuffer()),
+            num_dividend);
+
+        quotient_u32_dev_buf.FromDevice(quotient_u32.data());
+        remainder_u32_dev_buf.FromDevice(remainder_u32.data());
+        quotient_i64_dev_buf.FromDevice(quotient_i64.data());
+
+        for(uint64_t i = 0; i < num_dividend; ++i)
+        {
+            const uint32_t n   = dividends_u32[i];
+            const int64_t n64  = -(static_cast<int64_t>(n) << 20);
+            const bool correct = quotient_u32[i] == n / divisor &&
+                                 remainder_u32[i] == n % divisor &&
+                                 quotient_i64[i] == n64 / divisor64;
+
+            if(!correct)
+            {
+                std::cout << "full range division wrong for " << n << " / " << divisor
+                          << std::endl;
+                pass = false;
+                break;
+            }
+        }
+    }
+
     if(pass)
     {
         std::cout << "test magic number division: Pass" << std::endl;
@@ -0,0 +1,445 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/utility/magic_division.hpp"
+
+// Host verification harness and microbenchmark for the magic number dividers.
+//
+// Usage:
+//   test_magic_number_division_host                  boundary + random verification (ctest)
+//   test_magic_number_division_host exhaustive d...  all 2^32 uint32_t dividends for divisors d...
+//   test_magic_number_division_host bench            host timing of magic vs hardware division
+
+namespace {
+
+std::atomic<uint64_t> num_error{0};
+
+template <typename T>
+void report(const char* what, T dividend, T divisor, T result, T expected)
+{
+    if(num_error++ < 16)
+    {
+        std::cout << what << ": " << dividend << " / " << divisor << " = " << result
+                  << ", expected " << expected << std::endl;
+    }
+}
+
+// dividends where a wrong multiplier or shift shows first: around 0, around multiples of the
+// divisor, around powers of two and at the top of the range
+template <typename T, typename Divisor>
+std::vector<T> boundary_dividends(Divisor divisor, std::mt19937_64& gen)
+{
+    using U = std::make_unsigned_t<T>;
+
+    std::vector<T> dividends;
+
+    // wrap around instead of overflowing for signed types
+    auto add = [](T a, T b) { return static_cast<T>(static_cast<U>(a) + static_cast<U>(b)); };
+    auto mul = [](T a, T b) { return static_cast<T>(static_cast<U>(a) * static_cast<U>(b)); };
+
+    const T max = std::numeric_limits<T>::max();
+    const T min = std::numeric_limits<T>::min();
+    const T d   = static_cast<T>(divisor);
+
+    for(T x : {T{0}, T{1}, add(d, T(-1)), d, add(d, T{1}), add(max, T(-1)), max, min, add(min, T{1})})
+    {
+        dividends.push_back(x);
+    }
+
+    // largest multiples of the divisor
+    const T q_max = d == T(-1) ? max : max / d;
+
+    for(T q : {q_max, add(q_max, T(-1)), T(q_max / 2)})
+    {
+        dividends.push_back(mul(q, d));
+        dividends.push_back(add(mul(q, d), T(-1)));
+        dividends.push_back(add(mul(q, d), T{1}));
+    }
+
+    for(int i = 0; i < std::numeric_limits<U>::digits; ++i)
+    {
+        const T p = static_cast<T>(U{1} << i);
+
+        dividends.push_back(p);
+        dividends.push_back(add(p, T(-1)));
+    }
+
+    for(int i = 0; i < 64; ++i)
+    {
+        dividends.push_back(static_cast<T>(gen()));
+    }
+
+    return dividends;
+}
+
+template <typename T>
+std::vector<T> test_divisors(std::mt19937_64& gen)
+{
+    using U = std::make_unsigned_t<T>;
+
+    std::vector<T> divisors;
+
+    // every small divisor
+    for(T d = 1; d <= 65536; ++d)
+    {
+        divisors.push_back(d);
+    }
+
+    // around every power of two
+    for(int i = 1; i < std::numeric_limits<U>::digits; ++i)
+    {
+        const U p = U{1} << i;
+
+        for(U d : {U(p - 1), p, U(p + 1)})
+        {
+            divisors.push_back(static_cast<T>(d));
+        }
+    }
+
+    // top of the range
+    for(U d = std::numeric_limits<U>::max(); d > std::numeric_limits<U>::max() - 256; --d)
+    {
+        divisors.push_back(static_cast<T>(d));
+    }
+
+    for(int i = 0; i < 65536; ++i)
+    {
+        divisors.push_back(static_cast<T>(gen() >> (i % std::numeric_limits<U>::digits)));
+    }
+
+    std::vector<T> result;
+
+    for(T d : divisors)
+    {
+        if(d != 0)
+        {
+            result.push_back(d);
+        }
+    }
+
+    return result;
+}
+
+template <typename F>
+void parallel_for(std::size_t n, F f)
+{
+    const std::size_t num_thread = std::max(1u, std::thread::hardware_concurrency());
+
+    std::vector<std::thread> threads;
+
+    for(std::size_t t = 0; t < num_thread; ++t)
+    {
+        threads.emplace_back([&, t] {
+            for(std::size_t i = t; i < n; i += num_thread)
+            {
+                f(i);
+            }
+        });
+    }
+
+    for(auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+void verify_uint32()
+{
+    std::mt19937_64 gen(11939);
+
+    const auto divisors = test_divisors<uint32_t>(gen);
+
+    parallel_for(divisors.size(), [&](std::size_t i) {
+        std::mt19937_64 local_gen(i);
+
+        const uint32_t d = divisors[i];
+
+        const ck::MDivFullRange mdiv(d);
+
+        // original 31-bit version, valid for 31-bit dividend and divisor
+        uint32_t m31, s31;
+        ck::tie(m31, s31) = ck::MagicDivision::CalculateMagicNumbers(d);
+
+        for(uint32_t n : boundary_dividends<uint32_t>(d, local_gen))
+        {
+            uint32_t q, r;
+
+            mdiv.divmod(n, q, r);
+
+            if(q != n / d || r != n % d)
+            {
+                report("uint32_t full range", n, d, q, n / d);
+            }
+
+            if(d <= INT32_MAX && n <= INT32_MAX)
+            {
+                const uint32_t q31 = ck::MagicDivision::DoMagicDivision(n, m31, s31);
+
+                if(q31 != n / d)
+                {
+                    report("uint32_t 31-bit", n, d, q31, n / d);
+                }
+            }
+        }
+    });
+}
+
+void verify_int32()
+{
+    std::mt19937_64 gen(2791);
+
+    std::vector<int32_t> divisors = test_divisors<int32_t>(gen);
+
+    const std::size_t num_positive = divisors.size();
+
+    for(std::size_t i = 0; i < num_positive; ++i)
+    {
+        divisors.push_back(divisors[i] == std::numeric_limits<int32_t>::min() ? divisors[i]
+                                                                              : -divisors[i]);
+    }
+
+    parallel_for(divisors.size(), [&](std::size_t i) {
+        std::mt19937_64 local_gen(i);
+
+        const int32_t d = divisors[i];
+
+        const ck::MDivSigned mdiv(d);
+
+        for(int32_t n : boundary_dividends<int32_t>(d, local_gen))
+        {
+            // overflows for operator/
+            if(n == std::numeric_limits<int32_t>::min() && d == -1)
+            {
+                continue;
+            }
+
+            int32_t q, r;
+
+            mdiv.divmod(n, q, r);
+
+            if(q != n / d || r != n % d)
+            {
+                report("int32_t", n, d, q, n / d);
+            }
+        }
+    });
+}
+
+void verify_int64()
+{
+    std::mt19937_64 gen(65537);
+
+    std::vector<int64_t> divisors = test_divisors<int64_t>(gen);
+
+    const std::size_t num_positive = divisors.size();
+
+    for(std::size_t i = 0; i < num_positive; ++i)
+    {
+        divisors.push_back(divisors[i] == std::numeric_limits<int64_t>::min() ? divisors[i]
+                                                                              : -divisors[i]);
+    }
+
+    parallel_for(divisors.size(), [&](std::size_t i) {
+        std::mt19937_64 local_gen(i);
+
+        const int64_t d = divisors[i];
+
+        const ck::MDiv64 mdiv(d);
+
+        for(int64_t n : boundary_dividends<int64_t>(d, local_gen))
+        {
+            if(n == std::numeric_limits<int64_t>::min() && d == -1)
+            {
+                continue;
+            }
+
+            int64_t q, r;
+
+            mdiv.divmod(n, q, r);
+
+            if(q != n / d || r != n % d)
+            {
+                report("int64_t", n, d, q, n / d);
+            }
+        }
+    });
+
+    // unsigned 64-bit dividends beyond INT64_MAX
+    const auto udivisors = test_divisors<uint64_t>(gen);
+
+    parallel_for(udivisors.size(), [&](std::size_t i) {
+        std::mt19937_64 local_gen(i);
+
+        const uint64_t d = udivisors[i];
+
+        uint64_t m;
+        uint32_t s;
+        ck::tie(m, s) = ck::MagicDivision::CalculateMagicNumbers64(d);
+
+        for(uint64_t n : boundary_dividends<uint64_t>(d, local_gen))
+        {
+            const uint64_t q = ck::MagicDivision::DoMagicDivision64(n, m, s);
+
+            if(q != n / d)
+            {
+                report("uint64_t", n, d, q, n / d);
+            }
+        }
+    });
+}
+
+// every uint32_t dividend for the given divisors
+void verify_uint32_exhaustive(const std::vector<uint32_t>& divisors)
+{
+    constexpr uint64_t num_dividend = uint64_t{1} << 32;
+    constexpr uint64_t chunk        = uint64_t{1} << 24;
+
+    for(uint32_t d : divisors)
+    {
+        const ck::MDivFullRange mdiv(d);
+
+        parallel_for(num_dividend / chunk, [&](std::size_t c) {
+            for(uint64_t i = c * chunk; i < (c + 1) * chunk; ++i)
+            {
+                const uint32_t n = static_cast<uint32_t>(i);
+
+                if(mdiv.div(n) != n / d)
+                {
+                    report("uint32_t exhaustive", n, d, mdiv.div(n), n / d);
+                }
+            }
+        });
+
+        std::cout << "divisor " << d << " checked" << std::endl;
+    }
+}
+
+template <typename T, typename F>
+double time_division(const char* name, const std::vector<T>& dividends, F f)
+{
+    // keep the compiler from removing the loop
+    T sum = 0;
+
+    const int nrepeat = 16;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for(int r = 0; r < nrepeat; ++r)
+    {
+        for(T n : dividends)
+        {
+            sum += f(n);
+        }
+    }
+
+    const auto stop = std::chrono::steady_clock::now();
+
+    const double ns =
+        std::chrono::duration<double, std::nano>(stop - start).count() / (nrepeat * dividends.size());
+
+    std::cout << name << ": " << ns << " ns/div (checksum " << sum << ")" << std::endl;
+
+    return ns;
+}
+
+void benchmark()
+{
+    std::mt19937_64 gen(1);
+
+    const std::size_t n = 1 << 22;
+
+    std::vector<uint32_t> u32(n);
+    std::vector<int32_t> i32(n);
+    std::vector<int64_t> i64(n);
+
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        u32[i] = static_cast<uint32_t>(gen());
+        i32[i] = static_cast<int32_t>(gen());
+        i64[i] = static_cast<int64_t>(gen());
+    }
+
+    // divisor only known at run time, as in tensor descriptors
+    volatile uint32_t divisor_u32 = 3 * 7 * 11;
+    volatile int64_t divisor_i64  = (int64_t{1} << 33) + 7;
+
+    const uint32_t d32 = divisor_u32;
+    const int32_t ds32 = static_cast<int32_t>(d32);
+    const int64_t d64  = divisor_i64;
+
+    uint32_t m31, s31;
+    ck::tie(m31, s31) = ck::MagicDivision::CalculateMagicNumbers(d32);
+
+    const ck::MDivFullRange mdiv_u32(d32);
+    const ck::MDivSigned mdiv_i32(ds32);
+    const ck::MDiv64 mdiv_i64(d64);
+
+    time_division("uint32_t hardware    ", u32, [&](uint32_t x) { return x / d32; });
+    time_division("uint32_t magic 31-bit", u32, [&](uint32_t x) {
+        return ck::MagicDivision::DoMagicDivision(x & INT32_MAX, m31, s31);
+    });
+    time_division("uint32_t magic full  ", u32, [&](uint32_t x) { return mdiv_u32.div(x); });
+    time_division("int32_t hardware     ", i32, [&](int32_t x) { return x / ds32; });
+    time_division("int32_t magic        ", i32, [&](int32_t x) { return mdiv_i32.div(x); });
+    time_division("int64_t hardware     ", i64, [&](int64_t x) { return x / d64; });
+    time_division("int64_t magic        ", i64, [&](int64_t x) { return mdiv_i64.div(x); });
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if(argc > 1 && std::strcmp(argv[1], "bench") == 0)
+    {
+        benchmark();
+        return 0;
+    }
+
+    if(argc > 1 && std::strcmp(argv[1], "exhaustive") == 0)
+    {
+        std::vector<uint32_t> divisors;
+
+        for(int i = 2; i < argc; ++i)
+        {
+            divisors.push_back(static_cast<uint32_t>(std::strtoul(argv[i], nullptr, 0)));
+        }
+
+        if(divisors.empty())
+        {
+            divisors = {1, 3, 7, 641, 0x7fffffffu, 0x80000001u, 0xffffffffu};
+        }
+
+        verify_uint32_exhaustive(divisors);
+    }
+    else
+    {
+        verify_uint32();
+        verify_int32();
+        verify_int64();
+    }
+
+    if(num_error == 0)
+    {
+        std::cout << "test magic number division host: Pass" << std::endl;
+        return 0;
+    }
+    else
+    {
+        std::cout << "test magic number division host: Fail, " << num_error << " errors"
+                  << std::endl;
+        return -1;
+    }
+}
@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "profiler/profile_result_store.hpp"
+#include "profiler/profile_timing_options.hpp"
+
+using ck::profiler::mann_whitney_p_value;
+using ck::profiler::ProfilerResultRecord;
+
+namespace {
+
+std::string get_temp_path(const std::string& name)
+{
+    return ::testing::TempDir() + name;
+}
+
+} // namespace
+
+TEST(ProfilerResultStore, RoundTrip)
+{
+    const auto path = get_temp_path("test_profiler_result_store.ckres");
+
+    std::remove(path.c_str());
+
+    ProfilerResultRecord first;
+
+    first.timestamp_  = 1700000000;
+    first.operation_  = "gemm";
+    first.problem_    = "1 1 3840 4096 4096 4096 4096 4096";
+    first.instance_   = "DeviceGemm_Xdl_CShuffle<256, 256, 128>";
+    first.ave_time_   = 0.5f;
+    first.tflops_     = 250.f;
+    first.gb_per_sec_ = 128.f;
+    first.samples_    = {0.5f, 0.25f, 0.75f};
+
+    // separators in a field must not split the record, an empty field has a placeholder
+    ProfilerResultRecord second;
+
+    second.timestamp_ = 1700000001;
+    second.operation_ = "grouped_gemm";
+    second.instance_  = "with\ttab and\nnewline";
+    second.ave_time_  = 2.f;
+
+    ck::profiler::append_profiler_result(path, first);
+    ck::profiler::append_profiler_result(path, second);
+
+    // a record cut short by an interrupted run is skipped
+    {
+        std::ofstream os(path, std::ios::app);
+
+        os << "1700000002\tgemm\t1 1";
+    }
+
+    const auto records = ck::profiler::read_profiler_results(path);
+
+    ASSERT_EQ(records.size(), 2);
+
+    EXPECT_EQ(records[0].timestamp_, first.timestamp_);
+    EXPECT_EQ(records[0].operation_, first.operation_);
+    EXPECT_EQ(records[0].problem_, first.problem_);
+    EXPECT_EQ(records[0].instance_, first.instance_);
+    EXPECT_EQ(records[0].ave_time_, first.ave_time_);
+    EXPECT_EQ(records[0].tflops_, first.tflops_);
+    EXPECT_EQ(records[0].gb_per_sec_, first.gb_per_sec_);
+    EXPECT_EQ(records[0].samples_, first.samples_);
+    EXPECT_EQ(records[0].Key(), first.Key());
+
+    EXPECT_EQ(records[1].operation_, "grouped_gemm");
+    EXPECT_EQ(records[1].problem_, "-");
+    EXPECT_EQ(records[1].instance_, "with tab and newline");
+    EXPECT_EQ(records[1].ave_time_, 2.f);
+    EXPECT_TRUE(records[1].samples_.empty());
+
+    std::remove(path.c_str());
+}
+
+TEST(ProfilerResultStore, RejectsOtherFiles)
+{
+    const auto path = get_temp_path("test_profiler_result_store.txt");
+
+    {
+        std::ofstream os(path);
+
+        os << "timestamp\toperation\n";
+    }
+
+    EXPECT_THROW(ck::profiler::read_profiler_results(path), std::runtime_error);
+    EXPECT_THROW(ck::profiler::read_profiler_results(path + ".missing"), std::runtime_error);
+
+    std::remove(path.c_str());
+}
+
+// Runs of the same shape that only differ in verification, initialization, logging or timing
+// have the same problem
+TEST(ProfilerResultStore, ProblemIsShapeArguments)
+{
+    auto problem_of = [](std::vector<std::string> args) {
+        std::vector<char*> argv;
+
+        for(auto& arg : args)
+        {
+            argv.push_back(arg.data());
+        }
+
+        const int argc = static_cast<int>(argv.size());
+
+        ck::profiler::set_profiler_invocation(argc, argv.data());
+        ck::profiler::set_profiler_problem(argc, argv.data(), {{2, 4}, {8, 14}});
+
+        return ck::profiler::get_profiler_timing_options().problem_;
+    };
+
+    const auto problem = problem_of(
+        {"ckProfiler", "gemm", "1", "0", "1", "1", "0", "1", "64", "32", "16", "16", "32", "32"});
+
+    EXPECT_EQ(problem, "1 0 64 32 16 16 32 32");
+
+    // verification, init method, log, time kernel and the warm-up and iteration counts
+    EXPECT_EQ(problem,
+              problem_of({"ckProfiler", "gemm", "1", "0", "0", "2", "1", "0", "64", "32", "16",
+                          "16", "32", "32", "5", "100"}));
+}
+
+// Small samples worked out with the tie corrected normal approximation, e.g. for
+// x = {1, 2, 3}, y = {4, 5, 6}: U = 0, mean 4.5, variance 3 * 3 / 12 * 7 = 5.25,
+// z = (4.5 - 0.5) / sqrt(5.25) and p = erfc(z / sqrt(2))
+TEST(ProfilerResultStore, MannWhitneyPValue)
+{
+    EXPECT_NEAR(mann_whitney_p_value({1, 2, 3}, {4, 5, 6}), 0.0808555983700523, 1e-12);
+
+    // symmetric in x and y
+    EXPECT_NEAR(mann_whitney_p_value({4, 5, 6}, {1, 2, 3}), 0.0808555983700523, 1e-12);
+
+    // ties within and across the samples
+    EXPECT_NEAR(mann_whitney_p_value({1, 2, 2, 3}, {2, 3, 3, 4}), 0.17203370892182296, 1e-12);
+    EXPECT_NEAR(mann_whitney_p_value({1, 1, 2}, {1, 2, 2, 2}), 0.41421617824252505, 1e-12);
+
+    // a shift well beyond the noise is significant
+    std::vector<float> x;
+    std::vector<float> y;
+
+    for(int i = 0; i < 50; ++i)
+    {
+        x.push_back(1.f + 0.001f * i);
+        y.push_back(1.1f + 0.001f * i);
+    }
+
+    EXPECT_LT(mann_whitney_p_value(x, y), 1e-10);
+
+    // all values tied, or an empty sample, carry no evidence
+    EXPECT_EQ(mann_whitney_p_value({5, 5}, {5, 5, 5}), 1.0);
+    EXPECT_EQ(mann_whitney_p_value({}, {1, 2}), 1.0);
+}
@@ -0,0 +1,190 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/library/utility/host_complex_gemm.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_cgemm.hpp"
+
+using ck::tensor_operation::host::CGemmAlgorithm;
+using ck::tensor_operation::host::deinterleave_complex_host_tensor;
+using ck::tensor_operation::host::interleave_complex_host_tensor;
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+using ReferenceCGemm = ck::tensor_operation::host::
+    ReferenceCGemm<float, float, float, PassThrough, PassThrough, PassThrough>;
+
+Tensor<float> make_random_tensor(const std::vector<std::size_t>& lengths,
+                                 const std::vector<std::size_t>& strides,
+                                 unsigned seed)
+{
+    Tensor<float> tensor(lengths, strides);
+
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+
+    for(auto& v : tensor)
+    {
+        v = dist(gen);
+    }
+
+    return tensor;
+}
+
+struct Problem
+{
+    std::size_t M, N, K;
+};
+
+// planar operands, B column major
+struct PlanarCGemm
+{
+    explicit PlanarCGemm(const Problem& p)
+        : a_real(make_random_tensor({p.M, p.K}, {p.K, 1}, 1)),
+          a_imag(make_random_tensor({p.M, p.K}, {p.K, 1}, 2)),
+          b_real(make_random_tensor({p.K, p.N}, {1, p.K}, 3)),
+          b_imag(make_random_tensor({p.K, p.N}, {1, p.K}, 4)),
+          c_real(std::vector<std::size_t>{p.M, p.N}),
+          c_imag(std::vector<std::size_t>{p.M, p.N})
+    {
+    }
+
+    void Run(CGemmAlgorithm algorithm)
+    {
+        auto ref_cgemm   = ReferenceCGemm{};
+        auto ref_invoker = ref_cgemm.MakeInvoker();
+
+        ref_invoker.Run(ref_cgemm.MakeArgument(a_real,
+                                               a_imag,
+                                               b_real,
+                                               b_imag,
+                                               c_real,
+                                               c_imag,
+                                               PassThrough{},
+                                               PassThrough{},
+                                               PassThrough{},
+                                               algorithm));
+    }
+
+    // |c - a * b| against the sum of absolute products, from double loops
+    void Check(double tolerance) const
+    {
+        const std::size_t M = a_real.GetLengths()[0];
+        const std::size_t K = a_real.GetLengths()[1];
+        const std::size_t N = b_real.GetLengths()[1];
+
+        for(std::size_t m = 0; m < M; ++m)
+        {
+            for(std::size_t n = 0; n < N; ++n)
+            {
+                double real = 0, imag = 0, scale = 1;
+
+                for(std::size_t k = 0; k < K; ++k)
+                {
+                    const double ar = a_real(m, k), ai = a_imag(m, k);
+                    const double br = b_real(k, n), bi = b_imag(k, n);
+
+                    real += ar * br - ai * bi;
+                    imag += ar * bi + ai * br;
+                    scale += std::abs(ar * br) + std::abs(ai * bi);
+                }
+
+                ASSERT_NEAR(c_real(m, n), real, tolerance * scale);
+                ASSERT_NEAR(c_imag(m, n), imag, tolerance * scale);
+            }
+        }
+    }
+
+    Tensor<float> a_real, a_imag, b_real, b_imag, c_real, c_imag;
+};
+
+} // namespace
+
+TEST(ReferenceCGemm, Planar)
+{
+    for(const auto& p : std::vector<Problem>{{1, 1, 1}, {37, 65, 33}, {70, 3, 300}, {4, 5, 0}})
+    {
+        PlanarCGemm classic(p);
+        classic.Run(CGemmAlgorithm::Classic4M);
+        classic.Check(1e-6);
+
+        PlanarCGemm gauss(p);
+        gauss.Run(CGemmAlgorithm::Gauss3M);
+        gauss.Check(1e-6);
+    }
+}
+
+TEST(ReferenceCGemm, Interleaved)
+{
+    const Problem p{45, 67, 129};
+
+    for(auto algorithm : {CGemmAlgorithm::Classic4M, CGemmAlgorithm::Gauss3M})
+    {
+        PlanarCGemm planar(p);
+        planar.Run(algorithm);
+
+        const auto a_m_k = interleave_complex_host_tensor(planar.a_real, planar.a_imag);
+        const auto b_k_n = interleave_complex_host_tensor(planar.b_real, planar.b_imag);
+
+        Tensor<float> c_m_n(std::vector<std::size_t>{p.M, p.N, 2});
+
+        auto ref_cgemm   = ReferenceCGemm{};
+        auto ref_invoker = ref_cgemm.MakeInvoker();
+
+        ref_invoker.Run(ref_cgemm.MakeArgument(
+            a_m_k, b_k_n, c_m_n, PassThrough{}, PassThrough{}, PassThrough{}, algorithm));
+
+        // same sums in the same order as on planar storage
+        Tensor<float> c_real(std::vector<std::size_t>{p.M, p.N});
+        Tensor<float> c_imag(std::vector<std::size_t>{p.M, p.N}, std::vector<std::size_t>{1, p.M});
+
+        deinterleave_complex_host_tensor(c_m_n, c_real, c_imag);
+
+        for(std::size_t m = 0; m < p.M; ++m)
+        {
+            for(std::size_t n = 0; n < p.N; ++n)
+            {
+                EXPECT_EQ(c_real(m, n), planar.c_real(m, n));
+                EXPECT_EQ(c_imag(m, n), planar.c_imag(m, n));
+            }
+        }
+    }
+}
+
+TEST(ReferenceCGemm, LayoutConversion)
+{
+    const auto real = make_random_tensor({3, 4, 5}, {1, 3, 12}, 5);
+    const auto imag = make_random_tensor({3, 4, 5}, {20, 5, 1}, 6);
+
+    const auto complex = interleave_complex_host_tensor(real, imag);
+
+    EXPECT_EQ(complex.GetLengths(), (std::vector<std::size_t>{3, 4, 5, 2}));
+    EXPECT_EQ(complex(2, 1, 3, 0), real(2, 1, 3));
+    EXPECT_EQ(complex(2, 1, 3, 1), imag(2, 1, 3));
+
+    Tensor<float> real_copy(std::vector<std::size_t>{3, 4, 5});
+    Tensor<float> imag_copy(std::vector<std::size_t>{3, 4, 5}, std::vector<std::size_t>{1, 3, 12});
+
+    deinterleave_complex_host_tensor(complex, real_copy, imag_copy);
+
+    real.ForEach([&](const auto&, const std::vector<std::size_t>& idx) {
+        EXPECT_EQ(real_copy(idx), real(idx));
+        EXPECT_EQ(imag_copy(idx), imag(idx));
+    });
+
+    Tensor<float> wrong(std::vector<std::size_t>{3, 4});
+
+    EXPECT_THROW(interleave_complex_host_tensor(real, wrong), std::runtime_error);
+    EXPECT_THROW(deinterleave_complex_host_tensor(complex, wrong, wrong), std::runtime_error);
+    EXPECT_THROW(deinterleave_complex_host_tensor(real, real_copy, imag_copy), std::runtime_error);
+}
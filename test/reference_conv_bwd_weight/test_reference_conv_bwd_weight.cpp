@@ -0,0 +1,162 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
+#include "ck/library/utility/convolution_parameter.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_bwd_weight.hpp"
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+template <ck::index_t NDimSpatial>
+using ReferenceConvBwdWeight = ck::tensor_operation::host::
+    ReferenceConvBwdWeight<NDimSpatial, float, float, float, PassThrough, PassThrough, PassThrough>;
+
+void fill_random(Tensor<float>& tensor, unsigned seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(-3, 3);
+
+    // small integers, so that the float sums are exact in any order
+    for(auto& v : tensor)
+    {
+        v = static_cast<float>(dist(gen));
+    }
+}
+
+// sums over the output positions a weight element contributes to, one by one
+void naive_conv_bwd_weight(const ck::utils::conv::ConvParam& conv_param,
+                           const Tensor<float>& input,
+                           Tensor<float>& weight,
+                           const Tensor<float>& output)
+{
+    const std::size_t num_dim_spatial = conv_param.num_dim_spatial_;
+
+    weight.ForEach([&](auto& self, const std::vector<std::size_t>& wei_idx) {
+        float v_acc = 0;
+
+        output.ForEach([&](const auto&, const std::vector<std::size_t>& out_idx) {
+            if(out_idx[0] != wei_idx[0] || out_idx[2] != wei_idx[1])
+            {
+                return;
+            }
+
+            std::vector<std::size_t> in_idx{out_idx[0], out_idx[1], wei_idx[2]};
+
+            for(std::size_t d = 0; d < num_dim_spatial; ++d)
+            {
+                const auto i = static_cast<ck::long_index_t>(out_idx[3 + d]) *
+                                   conv_param.conv_filter_strides_[d] +
+                               static_cast<ck::long_index_t>(wei_idx[3 + d]) *
+                                   conv_param.conv_filter_dilations_[d] -
+                               conv_param.input_left_pads_[d];
+
+                if(i < 0 || static_cast<std::size_t>(i) >= input.GetLengths()[3 + d])
+                {
+                    return;
+                }
+
+                in_idx.push_back(static_cast<std::size_t>(i));
+            }
+
+            v_acc += output(out_idx) * input(in_idx);
+        });
+
+        self(wei_idx) = v_acc;
+    });
+}
+
+template <ck::index_t NDimSpatial, typename InLayout, typename WeiLayout, typename OutLayout>
+void run_and_check(const ck::utils::conv::ConvParam& conv_param, std::size_t expected_num_split)
+{
+    Tensor<float> input(
+        ck::utils::conv::make_input_host_tensor_descriptor_g_n_c_wis_packed<InLayout>(conv_param));
+    Tensor<float> weight(
+        ck::utils::conv::make_weight_host_tensor_descriptor_g_k_c_xs_packed<WeiLayout>(
+            conv_param));
+    Tensor<float> expected(weight.mDesc);
+    Tensor<float> output(
+        ck::utils::conv::make_output_host_tensor_descriptor_g_n_k_wos_packed<OutLayout>(
+            conv_param));
+
+    fill_random(input, 1);
+    fill_random(output, 2);
+
+    auto ref_conv     = ReferenceConvBwdWeight<NDimSpatial>{};
+    auto ref_invoker  = ref_conv.MakeInvoker();
+    auto ref_argument = ref_conv.MakeArgument(input,
+                                              weight,
+                                              output,
+                                              conv_param.conv_filter_strides_,
+                                              conv_param.conv_filter_dilations_,
+                                              conv_param.input_left_pads_,
+                                              conv_param.input_right_pads_,
+                                              PassThrough{},
+                                              PassThrough{},
+                                              PassThrough{});
+
+    EXPECT_EQ(ReferenceConvBwdWeight<NDimSpatial>::GetNumReductionSplit(ref_argument),
+              expected_num_split);
+
+    ref_invoker.Run(ref_argument);
+
+    naive_conv_bwd_weight(conv_param, input, expected, output);
+
+    EXPECT_EQ(weight.mData, expected.mData);
+}
+
+} // namespace
+
+TEST(ReferenceConvBwdWeight, Depthwise2D)
+{
+    // 36 weight elements over 4 x 95 x 95 output positions, dilated with asymmetric padding
+    const ck::utils::conv::ConvParam conv_param{
+        2, 4, 4, 1, 1, {3, 3}, {96, 96}, {1, 1}, {2, 2}, {2, 2}, {1, 1}};
+
+    run_and_check<2,
+                  ck::tensor_layout::convolution::GNHWC,
+                  ck::tensor_layout::convolution::GKYXC,
+                  ck::tensor_layout::convolution::GNHWK>(conv_param, 8);
+}
+
+TEST(ReferenceConvBwdWeight, SmallKGrouped1D)
+{
+    const ck::utils::conv::ConvParam conv_param{
+        1, 2, 3, 2, 3, {5}, {20000}, {2}, {1}, {2}, {2}};
+
+    run_and_check<1,
+                  ck::tensor_layout::convolution::GNWC,
+                  ck::tensor_layout::convolution::GKXC,
+                  ck::tensor_layout::convolution::GNWK>(conv_param, 5);
+}
+
+TEST(ReferenceConvBwdWeight, Depthwise3D)
+{
+    const ck::utils::conv::ConvParam conv_param{
+        3, 3, 1, 1, 2, {3, 3, 3}, {20, 24, 24}, {1, 1, 1}, {1, 1, 1}, {1, 1, 1}, {1, 1, 1}};
+
+    run_and_check<3,
+                  ck::tensor_layout::convolution::GNDHWC,
+                  ck::tensor_layout::convolution::GKZYXC,
+                  ck::tensor_layout::convolution::GNDHWK>(conv_param, 2);
+}
+
+TEST(ReferenceConvBwdWeight, NoSplitForLargeWeights)
+{
+    const ck::utils::conv::ConvParam conv_param{
+        2, 1, 2, 16, 8, {3, 3}, {17, 17}, {2, 2}, {1, 1}, {1, 1}, {1, 1}};
+
+    run_and_check<2,
+                  ck::tensor_layout::convolution::GNHWC,
+                  ck::tensor_layout::convolution::GKYXC,
+                  ck::tensor_layout::convolution::GNHWK>(conv_param, 1);
+}
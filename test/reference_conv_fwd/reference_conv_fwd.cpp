@@ -3,6 +3,7 @@
 
 #include <cmath>
 #include <cstdlib>
+#include <limits>
 #include <numeric>
 #include <type_traits>
 #include <vector>
@@ -390,3 +391,265 @@ TEST(ReferenceConvolutionFWD, Conv3DGNCDHWStridesDilations)
     EXPECT_TRUE(ck::utils::check_err(
         out_tensor, ref_data, "Error [case 2]: incorrect results!", 1e-4f, 1e-6f));
 }
+
+namespace {
+
+// output positions summed one by one in double
+template <typename DataType>
+void naive_convolution_forward(const ck::utils::conv::ConvParam& conv_param,
+                               const Tensor<DataType>& input,
+                               const Tensor<DataType>& weights,
+                               Tensor<DataType>& output)
+{
+    const std::size_t num_dim_spatial = conv_param.num_dim_spatial_;
+
+    const auto& wei_lengths = weights.GetLengths();
+
+    std::size_t filter_size = 1;
+    for(std::size_t d = 0; d < num_dim_spatial; ++d)
+    {
+        filter_size *= wei_lengths[3 + d];
+    }
+
+    output.ForEach([&](auto& self, const std::vector<std::size_t>& out_idx) {
+        double v_acc = 0;
+
+        for(std::size_t c = 0; c < wei_lengths[2]; ++c)
+        {
+            for(std::size_t f = 0; f < filter_size; ++f)
+            {
+                std::vector<std::size_t> in_idx{out_idx[0], out_idx[1], c};
+                std::vector<std::size_t> wei_idx{out_idx[0], out_idx[2], c};
+                bool valid = true;
+
+                for(std::size_t d = 0, i = f; d < num_dim_spatial; ++d)
+                {
+                    std::size_t stride = 1;
+                    for(std::size_t e = d + 1; e < num_dim_spatial; ++e)
+                    {
+                        stride *= wei_lengths[3 + e];
+                    }
+
+                    const std::size_t x = i / stride;
+                    i %= stride;
+
+                    const auto hi = static_cast<ck::long_index_t>(out_idx[3 + d]) *
+                                        conv_param.conv_filter_strides_[d] +
+                                    static_cast<ck::long_index_t>(x) *
+                                        conv_param.conv_filter_dilations_[d] -
+                                    conv_param.input_left_pads_[d];
+
+                    valid = valid && hi >= 0 &&
+                            static_cast<std::size_t>(hi) < input.GetLengths()[3 + d];
+
+                    in_idx.push_back(static_cast<std::size_t>(hi));
+                    wei_idx.push_back(x);
+                }
+
+                if(valid)
+                {
+                    v_acc += static_cast<double>(input(in_idx)) * weights(wei_idx);
+                }
+            }
+        }
+
+        self(out_idx) = static_cast<DataType>(v_acc);
+    });
+}
+
+template <ck::index_t NDimSpatial,
+          typename InLayout,
+          typename WeiLayout,
+          typename OutLayout,
+          typename DataType = float>
+void run_and_check_fft_convolution_forward(const ck::utils::conv::ConvParam& conv_param,
+                                           bool expect_fft,
+                                           double rtol = 1e-5,
+                                           double atol = 3e-6)
+{
+    Tensor<DataType> input(
+        ck::utils::conv::make_input_host_tensor_descriptor_g_n_c_wis_packed<InLayout>(conv_param));
+    Tensor<DataType> weights(
+        ck::utils::conv::make_weight_host_tensor_descriptor_g_k_c_xs_packed<WeiLayout>(
+            conv_param));
+    Tensor<DataType> output(
+        ck::utils::conv::make_output_host_tensor_descriptor_g_n_k_wos_packed<OutLayout>(
+            conv_param));
+    Tensor<DataType> expected(output.mDesc);
+
+    ck::utils::FillUniformDistribution<DataType>{-1.f, 1.f}(input);
+    ck::utils::FillUniformDistribution<DataType>{-1.f, 1.f}(weights);
+
+    if constexpr(std::is_same_v<DataType, double>)
+    {
+        // values float cannot represent
+        for(auto& v : input)
+        {
+            v /= 3;
+        }
+
+        for(auto& v : weights)
+        {
+            v /= 3;
+        }
+    }
+
+    using ReferenceConvFwd = ck::tensor_operation::host::ReferenceConvFwd<NDimSpatial,
+                                                                          DataType,
+                                                                          DataType,
+                                                                          DataType,
+                                                                          InElementOp,
+                                                                          WeiElementOp,
+                                                                          OutElementOp>;
+
+    auto ref_conv     = ReferenceConvFwd{};
+    auto ref_invoker  = ref_conv.MakeInvoker();
+    auto ref_argument = ref_conv.MakeArgument(input,
+                                              weights,
+                                              output,
+                                              conv_param.conv_filter_strides_,
+                                              conv_param.conv_filter_dilations_,
+                                              conv_param.input_left_pads_,
+                                              conv_param.input_right_pads_,
+                                              InElementOp{},
+                                              WeiElementOp{},
+                                              OutElementOp{});
+
+    EXPECT_EQ(ReferenceConvFwd::UseFftConv(ref_argument), expect_fft);
+
+    ref_invoker.Run(ref_argument);
+
+    naive_convolution_forward(conv_param, input, weights, expected);
+
+    EXPECT_TRUE(ck::utils::check_err(output, expected, "Error: incorrect results!", rtol, atol));
+}
+
+} // namespace
+
+TEST(ReferenceConvolutionFWD, FftConv1DLongFilterStridesDilationsPadding)
+{
+    const ck::utils::conv::ConvParam conv_param(
+        1, 2, 2, 3, 2, {65}, {1000}, {2}, {2}, {70}, {3});
+
+    run_and_check_fft_convolution_forward<1,
+                                          ck::tensor_layout::convolution::GNWC,
+                                          ck::tensor_layout::convolution::GKXC,
+                                          ck::tensor_layout::convolution::GNWK>(conv_param, true);
+}
+
+TEST(ReferenceConvolutionFWD, FftConv2DDepthwiseLargeFilter)
+{
+    const ck::utils::conv::ConvParam conv_param(
+        2, 2, 1, 1, 1, {31, 31}, {48, 48}, {1, 1}, {1, 1}, {15, 15}, {15, 15});
+
+    run_and_check_fft_convolution_forward<2,
+                                          ck::tensor_layout::convolution::GNHWC,
+                                          ck::tensor_layout::convolution::GKYXC,
+                                          ck::tensor_layout::convolution::GNHWK>(conv_param, true);
+}
+
+TEST(ReferenceConvolutionFWD, FftConv2DStem)
+{
+    // 7x7 stride 2 stem
+    const ck::utils::conv::ConvParam conv_param(
+        2, 1, 1, 8, 8, {7, 7}, {56, 56}, {2, 2}, {1, 1}, {3, 3}, {3, 3});
+
+    run_and_check_fft_convolution_forward<2,
+                                          ck::tensor_layout::convolution::NHWGC,
+                                          ck::tensor_layout::convolution::GKYXC,
+                                          ck::tensor_layout::convolution::NHWGK>(conv_param, true);
+}
+
+TEST(ReferenceConvolutionFWD, FftConv3D)
+{
+    const ck::utils::conv::ConvParam conv_param(
+        3, 1, 1, 3, 2, {5, 5, 5}, {16, 16, 16}, {1, 1, 1}, {1, 1, 1}, {2, 2, 2}, {2, 2, 2});
+
+    run_and_check_fft_convolution_forward<3,
+                                          ck::tensor_layout::convolution::GNDHWC,
+                                          ck::tensor_layout::convolution::GKZYXC,
+                                          ck::tensor_layout::convolution::GNDHWK>(conv_param,
+                                                                                  true);
+}
+
+TEST(ReferenceConvolutionFWD, FftConvNotForSmallFilters)
+{
+    const ck::utils::conv::ConvParam conv_param(
+        2, 2, 2, 8, 8, {3, 3}, {17, 17}, {1, 1}, {1, 1}, {1, 1}, {1, 1});
+
+    run_and_check_fft_convolution_forward<2,
+                                          ck::tensor_layout::convolution::GNHWC,
+                                          ck::tensor_layout::convolution::GKYXC,
+                                          ck::tensor_layout::convolution::GNHWK>(conv_param,
+                                                                                 false);
+}
+
+TEST(ReferenceConvolutionFWD, FftConvNotFor3x3x3Filters)
+{
+    const ck::utils::conv::ConvParam conv_param(
+        3, 1, 2, 2, 2, {3, 3, 3}, {12, 12, 12}, {1, 1, 1}, {1, 1, 1}, {1, 1, 1}, {1, 1, 1});
+
+    run_and_check_fft_convolution_forward<3,
+                                          ck::tensor_layout::convolution::GNDHWC,
+                                          ck::tensor_layout::convolution::GKZYXC,
+                                          ck::tensor_layout::convolution::GNDHWK>(conv_param,
+                                                                                  false);
+}
+
+TEST(ReferenceConvolutionFWD, FftConvDouble)
+{
+    // neither rounded to float on the way into the FFTs nor on the way out
+    const ck::utils::conv::ConvParam conv_param(
+        2, 2, 1, 1, 1, {31, 31}, {48, 48}, {1, 1}, {1, 1}, {15, 15}, {15, 15});
+
+    run_and_check_fft_convolution_forward<2,
+                                          ck::tensor_layout::convolution::GNHWC,
+                                          ck::tensor_layout::convolution::GKYXC,
+                                          ck::tensor_layout::convolution::GNHWK,
+                                          double>(conv_param, true, 1e-10, 1e-10);
+}
+
+TEST(ReferenceConvolutionFWD, FftConvNotForNonFiniteInput)
+{
+    const ck::utils::conv::ConvParam conv_param(
+        2, 1, 1, 1, 1, {31, 31}, {48, 48}, {1, 1}, {1, 1}, {15, 15}, {15, 15});
+
+    Tensor<float> input(
+        ck::utils::conv::make_input_host_tensor_descriptor_g_n_c_wis_packed<
+            ck::tensor_layout::convolution::GNHWC>(conv_param));
+    Tensor<float> weights(
+        ck::utils::conv::make_weight_host_tensor_descriptor_g_k_c_xs_packed<
+            ck::tensor_layout::convolution::GKYXC>(conv_param));
+    Tensor<float> output(
+        ck::utils::conv::make_output_host_tensor_descriptor_g_n_k_wos_packed<
+            ck::tensor_layout::convolution::GNHWK>(conv_param));
+
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(input);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(weights);
+
+    input(0, 0, 0, 0, 0) = std::numeric_limits<float>::infinity();
+
+    using ReferenceConvFwd = ck::tensor_operation::host::
+        ReferenceConvFwd<2, float, float, float, InElementOp, WeiElementOp, OutElementOp>;
+
+    auto ref_conv     = ReferenceConvFwd{};
+    auto ref_invoker  = ref_conv.MakeInvoker();
+    auto ref_argument = ref_conv.MakeArgument(input,
+                                              weights,
+                                              output,
+                                              conv_param.conv_filter_strides_,
+                                              conv_param.conv_filter_dilations_,
+                                              conv_param.input_left_pads_,
+                                              conv_param.input_right_pads_,
+                                              InElementOp{},
+                                              WeiElementOp{},
+                                              OutElementOp{});
+
+    EXPECT_FALSE(ReferenceConvFwd::UseFftConv(ref_argument));
+
+    ref_invoker.Run(ref_argument);
+
+    // only the outputs the infinite input contributes to
+    EXPECT_FALSE(std::isfinite(output(0, 0, 0, 0, 0)));
+    EXPECT_TRUE(std::isfinite(output(0, 0, 0, 47, 47)));
+}
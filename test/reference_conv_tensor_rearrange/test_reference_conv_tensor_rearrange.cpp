@@ -0,0 +1,260 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdint>
+#include <random>
+#include <type_traits>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
+#include "ck/library/utility/convolution_parameter.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/utility/numeric.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_column_to_image.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_image_to_column.hpp"
+
+namespace {
+
+using namespace ck::tensor_layout::convolution;
+
+template <typename T>
+void fill_random(Tensor<T>& tensor, unsigned seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(-5, 5);
+
+    // small integers, so that the float sums are exact in any order
+    for(auto& v : tensor)
+    {
+        v = static_cast<T>(dist(gen));
+    }
+}
+
+// [G, N * Do * Ho * Wo, Z * Y * X * C], with G between the rows for the NHWGC like layouts
+template <typename ImageLayout>
+HostTensorDescriptor make_column_desc(const ck::utils::conv::ConvParam& conv_param)
+{
+    const std::size_t G = conv_param.G_;
+    const std::size_t num_row =
+        conv_param.N_ * ck::accumulate_n<std::size_t>(conv_param.output_spatial_lengths_.begin(),
+                                                      conv_param.num_dim_spatial_,
+                                                      1,
+                                                      std::multiplies<>());
+    const std::size_t num_column =
+        conv_param.C_ * ck::accumulate_n<std::size_t>(conv_param.filter_spatial_lengths_.begin(),
+                                                      conv_param.num_dim_spatial_,
+                                                      1,
+                                                      std::multiplies<>());
+
+    if constexpr(std::is_same_v<ImageLayout, NWGC> || std::is_same_v<ImageLayout, NHWGC> ||
+                 std::is_same_v<ImageLayout, NDHWGC>)
+    {
+        return HostTensorDescriptor({G, num_row, num_column},
+                                    {num_column, num_column * G, std::size_t{1}});
+    }
+    else
+    {
+        return HostTensorDescriptor({G, num_row, num_column});
+    }
+}
+
+// f(column_idx, image_idx) for every column element that maps into the image, row by row
+template <typename F>
+void naive_for_each_tap(const ck::utils::conv::ConvParam& conv_param, F&& f)
+{
+    const std::size_t num_dim_spatial = conv_param.num_dim_spatial_;
+    const auto& out_lengths           = conv_param.output_spatial_lengths_;
+    const auto& filter_lengths        = conv_param.filter_spatial_lengths_;
+
+    const std::size_t num_out = ck::accumulate_n<std::size_t>(
+        out_lengths.begin(), num_dim_spatial, 1, std::multiplies<>());
+    const std::size_t num_tap = ck::accumulate_n<std::size_t>(
+        filter_lengths.begin(), num_dim_spatial, 1, std::multiplies<>());
+    const std::size_t C = conv_param.C_;
+
+    for(std::size_t g = 0; g < static_cast<std::size_t>(conv_param.G_); ++g)
+    {
+        for(std::size_t row = 0; row < conv_param.N_ * num_out; ++row)
+        {
+            for(std::size_t tap = 0; tap < num_tap; ++tap)
+            {
+                std::vector<std::size_t> image_idx(3 + num_dim_spatial);
+                bool in_image = true;
+
+                for(std::size_t d = num_dim_spatial, o = row % num_out, t = tap; d > 0; --d)
+                {
+                    const auto i =
+                        static_cast<ck::long_index_t>(o % out_lengths[d - 1]) *
+                            conv_param.conv_filter_strides_[d - 1] +
+                        static_cast<ck::long_index_t>(t % filter_lengths[d - 1]) *
+                            conv_param.conv_filter_dilations_[d - 1] -
+                        conv_param.input_left_pads_[d - 1];
+
+                    in_image = in_image && i >= 0 && i < conv_param.input_spatial_lengths_[d - 1];
+                    image_idx[2 + d] = static_cast<std::size_t>(i);
+
+                    o /= out_lengths[d - 1];
+                    t /= filter_lengths[d - 1];
+                }
+
+                for(std::size_t c = 0; in_image && c < C; ++c)
+                {
+                    image_idx[0] = g;
+                    image_idx[1] = row / num_out;
+                    image_idx[2] = c;
+
+                    f(std::vector<std::size_t>{g, row, tap * C + c}, image_idx);
+                }
+            }
+        }
+    }
+}
+
+template <ck::index_t NDimSpatial, typename ImageLayout, typename InDataType>
+void run_and_check(const ck::utils::conv::ConvParam& conv_param)
+{
+    const auto image_desc =
+        ck::utils::conv::make_input_host_tensor_descriptor_g_n_c_wis_packed<ImageLayout>(
+            conv_param);
+    const auto column_desc = make_column_desc<ImageLayout>(conv_param);
+
+    // image to column, converting the data type when InDataType is not float
+    {
+        Tensor<InDataType> image(image_desc);
+        Tensor<float> column(column_desc);
+        Tensor<float> expected(column_desc);
+
+        fill_random(image, 1);
+        column.SetZero();
+        expected.SetZero();
+
+        auto ref_op = ck::tensor_operation::host::
+            ReferenceImageToColumn<NDimSpatial, ImageLayout, InDataType, float>{};
+        auto ref_invoker = ref_op.MakeInvoker();
+        ref_invoker.Run(ref_op.MakeArgument(image,
+                                            column,
+                                            conv_param.filter_spatial_lengths_,
+                                            conv_param.conv_filter_strides_,
+                                            conv_param.conv_filter_dilations_,
+                                            conv_param.input_left_pads_,
+                                            conv_param.input_right_pads_));
+
+        naive_for_each_tap(conv_param, [&](const auto& column_idx, const auto& image_idx) {
+            expected(column_idx) = static_cast<float>(image(image_idx));
+        });
+
+        EXPECT_EQ(column.mData, expected.mData);
+    }
+
+    // column to image, summing the overlapping windows
+    {
+        Tensor<float> column(column_desc);
+        Tensor<float> image(image_desc);
+        Tensor<float> expected(image_desc);
+
+        fill_random(column, 2);
+        fill_random(image, 3);
+        expected.mData = image.mData;
+
+        auto ref_op = ck::tensor_operation::host::
+            ReferenceColumnToImage<NDimSpatial, ImageLayout, float, float>{};
+        auto ref_invoker = ref_op.MakeInvoker();
+        ref_invoker.Run(ref_op.MakeArgument(column,
+                                            image,
+                                            conv_param.filter_spatial_lengths_,
+                                            conv_param.conv_filter_strides_,
+                                            conv_param.conv_filter_dilations_,
+                                            conv_param.input_left_pads_,
+                                            conv_param.input_right_pads_));
+
+        naive_for_each_tap(conv_param, [&](const auto& column_idx, const auto& image_idx) {
+            expected(image_idx) += column(column_idx);
+        });
+
+        EXPECT_EQ(image.mData, expected.mData);
+    }
+}
+
+// column to image of non-integer values, with the sum rounded to DataType after every add
+template <ck::index_t NDimSpatial, typename ImageLayout, typename DataType>
+void run_and_check_column_to_image_rounding(const ck::utils::conv::ConvParam& conv_param)
+{
+    const auto image_desc =
+        ck::utils::conv::make_input_host_tensor_descriptor_g_n_c_wis_packed<ImageLayout>(
+            conv_param);
+    const auto column_desc = make_column_desc<ImageLayout>(conv_param);
+
+    Tensor<DataType> column(column_desc);
+    Tensor<DataType> image(image_desc);
+    Tensor<DataType> expected(image_desc);
+
+    column.GenerateTensorValue(GeneratorTensor_3<DataType>{-1.f, 1.f});
+    image.GenerateTensorValue(GeneratorTensor_3<DataType>{-1.f, 1.f});
+    expected.mData = image.mData;
+
+    auto ref_op = ck::tensor_operation::host::
+        ReferenceColumnToImage<NDimSpatial, ImageLayout, DataType, DataType>{};
+    auto ref_invoker = ref_op.MakeInvoker();
+    ref_invoker.Run(ref_op.MakeArgument(column,
+                                        image,
+                                        conv_param.filter_spatial_lengths_,
+                                        conv_param.conv_filter_strides_,
+                                        conv_param.conv_filter_dilations_,
+                                        conv_param.input_left_pads_,
+                                        conv_param.input_right_pads_));
+
+    naive_for_each_tap(conv_param, [&](const auto& column_idx, const auto& image_idx) {
+        expected(image_idx) = ck::type_convert<DataType>(
+            ck::type_convert<float>(expected(image_idx)) +
+            ck::type_convert<float>(column(column_idx)));
+    });
+
+    EXPECT_EQ(image.mData, expected.mData);
+}
+
+} // namespace
+
+TEST(ReferenceConvTensorRearrange, Overlapping1D)
+{
+    // stride below the dilated filter size, asymmetric padding
+    const ck::utils::conv::ConvParam conv_param{1, 1, 3, 1, 5, {4}, {37}, {2}, {3}, {3}, {1}};
+
+    run_and_check<1, GNWC, float>(conv_param);
+}
+
+TEST(ReferenceConvTensorRearrange, GroupedStrided2D)
+{
+    // G between the rows of the column matrix, stride larger than the filter
+    const ck::utils::conv::ConvParam conv_param{
+        2, 3, 2, 1, 4, {3, 2}, {13, 11}, {2, 3}, {1, 2}, {1, 0}, {2, 1}};
+
+    run_and_check<2, NHWGC, float>(conv_param);
+}
+
+TEST(ReferenceConvTensorRearrange, Padded3D)
+{
+    const ck::utils::conv::ConvParam conv_param{
+        3, 1, 2, 1, 3, {3, 3, 3}, {5, 7, 6}, {1, 2, 1}, {1, 1, 2}, {1, 1, 2}, {1, 0, 2}};
+
+    run_and_check<3, GNDHWC, float>(conv_param);
+}
+
+TEST(ReferenceConvTensorRearrange, ConvertingImageToColumn)
+{
+    const ck::utils::conv::ConvParam conv_param{
+        2, 2, 2, 1, 7, {3, 3}, {9, 10}, {1, 1}, {1, 1}, {1, 1}, {1, 1}};
+
+    run_and_check<2, NHWGC, int8_t>(conv_param);
+}
+
+TEST(ReferenceConvTensorRearrange, ColumnToImageRoundsEverySumF16)
+{
+    const ck::utils::conv::ConvParam conv_param{
+        2, 1, 2, 1, 8, {3, 3}, {9, 10}, {1, 1}, {1, 1}, {1, 1}, {1, 1}};
+
+    run_and_check_column_to_image_rounding<2, GNHWC, ck::half_t>(conv_param);
+}
@@ -0,0 +1,125 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdint>
+#include <random>
+#include <tuple>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm_multiple_d.hpp"
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/literals.hpp"
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+using namespace ck::literals;
+
+namespace {
+
+template <typename T>
+void fill_random(Tensor<T>& tensor, unsigned seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(-5, 5);
+
+    // small integers, so that the sums are exact in any order
+    for(auto& v : tensor)
+    {
+        v = ck::type_convert<T>(dist(gen));
+    }
+}
+
+// e = (c + d0) * d1
+struct AddMultiply
+{
+    template <typename E, typename C, typename D0, typename D1>
+    void operator()(E& e, const C& c, const D0& d0, const D1& d1) const
+    {
+        e = ck::type_convert<E>((ck::type_convert<float>(c) + ck::type_convert<float>(d0)) *
+                                ck::type_convert<float>(d1));
+    }
+};
+
+template <typename ADataType, typename BDataType, typename DDataType, typename AccDataType>
+void RunAndCompare(std::size_t M, std::size_t N, std::size_t K)
+{
+    using ReferenceGemmInstance = ck::tensor_operation::host::ReferenceGemm<ADataType,
+                                                                            BDataType,
+                                                                            AccDataType,
+                                                                            AccDataType,
+                                                                            PassThrough,
+                                                                            PassThrough,
+                                                                            PassThrough>;
+
+    using ReferenceGemmMultipleDInstance =
+        ck::tensor_operation::host::ReferenceGemmMultipleD<ADataType,
+                                                           BDataType,
+                                                           ck::Tuple<DDataType, DDataType>,
+                                                           float,
+                                                           AccDataType,
+                                                           PassThrough,
+                                                           PassThrough,
+                                                           AddMultiply>;
+
+    Tensor<ADataType> a_m_k(HostTensorDescriptor({M, K}, {K, 1_uz}));
+    // column major B
+    Tensor<BDataType> b_k_n(HostTensorDescriptor({K, N}, {1_uz, K}));
+    Tensor<DDataType> d0_m_n(HostTensorDescriptor({M, N}, {N, 1_uz}));
+    // bias broadcast along M
+    Tensor<DDataType> d1_m_n(HostTensorDescriptor({M, N}, {0_uz, 1_uz}));
+
+    fill_random(a_m_k, 1);
+    fill_random(b_k_n, 2);
+    fill_random(d0_m_n, 3);
+    fill_random(d1_m_n, 4);
+
+    Tensor<AccDataType> c_m_n(HostTensorDescriptor({M, N}, {N, 1_uz}));
+    Tensor<float> e_m_n_ref(HostTensorDescriptor({M, N}, {N, 1_uz}));
+    Tensor<float> e_m_n(HostTensorDescriptor({M, N}, {N, 1_uz}));
+
+    auto ref_gemm     = ReferenceGemmInstance{};
+    auto ref_invoker  = ref_gemm.MakeInvoker();
+    auto ref_argument = ref_gemm.MakeArgument(
+        a_m_k, b_k_n, c_m_n, PassThrough{}, PassThrough{}, PassThrough{});
+
+    ref_invoker.Run(ref_argument);
+
+    for(std::size_t m = 0; m < M; ++m)
+    {
+        for(std::size_t n = 0; n < N; ++n)
+        {
+            AddMultiply{}(e_m_n_ref(m, n), c_m_n(m, n), d0_m_n(m, n), d1_m_n(m, n));
+        }
+    }
+
+    auto gemm     = ReferenceGemmMultipleDInstance{};
+    auto invoker  = gemm.MakeInvoker();
+    auto argument = gemm.MakeArgument(a_m_k,
+                                      b_k_n,
+                                      std::tie(d0_m_n, d1_m_n),
+                                      e_m_n,
+                                      PassThrough{},
+                                      PassThrough{},
+                                      AddMultiply{});
+
+    invoker.Run(argument);
+
+    EXPECT_TRUE(ck::utils::check_err(e_m_n, e_m_n_ref));
+}
+
+} // namespace
+
+TEST(ReferenceGemmMultipleD, MatchesReferenceGemmWithEpilogueF32)
+{
+    RunAndCompare<float, float, float, float>(67, 45, 33);
+}
+
+TEST(ReferenceGemmMultipleD, MatchesReferenceGemmWithEpilogueInt8)
+{
+    // takes the integer_gemm() path
+    RunAndCompare<int8_t, int8_t, int32_t, int32_t>(67, 45, 130);
+}
@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_grouped_gemm.hpp"
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+using ReferenceGemmInstance = ck::tensor_operation::host::
+    ReferenceGemm<float, float, float, float, PassThrough, PassThrough, PassThrough>;
+
+using ReferenceGroupedGemmInstance = ck::tensor_operation::host::
+    ReferenceGroupedGemm<float, float, float, float, PassThrough, PassThrough, PassThrough>;
+
+TEST(HostThreadPool, RunsEveryTaskOnce)
+{
+    auto& pool = ck::utils::HostThreadPool::GetInstance();
+
+    for(std::size_t num_task : {0, 1, 7, 1000})
+    {
+        std::vector<std::atomic<int>> count(num_task);
+
+        pool.ParallelFor(num_task, [&](std::size_t i) { ++count[i]; });
+
+        for(std::size_t i = 0; i < num_task; ++i)
+        {
+            EXPECT_EQ(count[i], 1) << i << " of " << num_task;
+        }
+    }
+}
+
+TEST(HostThreadPool, NestedAndThrowingTasks)
+{
+    auto& pool = ck::utils::HostThreadPool::GetInstance();
+
+    std::atomic<int> count{0};
+
+    pool.ParallelFor(16, [&](std::size_t) { pool.ParallelFor(16, [&](std::size_t) { ++count; }); });
+
+    EXPECT_EQ(count, 256);
+
+    EXPECT_THROW(pool.ParallelFor(64,
+                                  [](std::size_t i) {
+                                      if(i == 13)
+                                      {
+                                          throw std::runtime_error("task");
+                                      }
+                                  }),
+                 std::runtime_error);
+
+    // still usable afterwards
+    count = 0;
+    pool.ParallelFor(64, [&](std::size_t) { ++count; });
+
+    EXPECT_EQ(count, 64);
+}
+
+TEST(ReferenceGroupedGemm, MatchesReferenceGemmPerGroup)
+{
+    // skewed groups: one large, many tiny, empty ones and K = 0, row and column major B
+    struct Problem
+    {
+        std::size_t M, N, K;
+        bool b_col_major;
+    };
+
+    std::vector<Problem> problems{
+        {200, 150, 300, false}, {0, 16, 8, false}, {5, 0, 8, true}, {7, 9, 0, false}};
+
+    for(std::size_t i = 0; i < 200; ++i)
+    {
+        problems.push_back({1 + i % 5, 1 + i % 33, 1 + i % 17, i % 2 == 1});
+    }
+
+    std::vector<Tensor<float>> a_g_m_k;
+    std::vector<Tensor<float>> b_g_k_n;
+    std::vector<Tensor<float>> c_g_m_n;
+    std::vector<Tensor<float>> c_g_m_n_ref;
+
+    for(const auto& p : problems)
+    {
+        a_g_m_k.emplace_back(std::vector<std::size_t>{p.M, p.K}, std::vector<std::size_t>{p.K, 1});
+
+        if(p.b_col_major)
+        {
+            b_g_k_n.emplace_back(std::vector<std::size_t>{p.K, p.N},
+                                 std::vector<std::size_t>{1, p.K});
+        }
+        else
+        {
+            b_g_k_n.emplace_back(std::vector<std::size_t>{p.K, p.N},
+                                 std::vector<std::size_t>{p.N, 1});
+        }
+
+        c_g_m_n.emplace_back(std::vector<std::size_t>{p.M, p.N},
+                             std::vector<std::size_t>{p.N + 3, 1});
+        c_g_m_n_ref.emplace_back(std::vector<std::size_t>{p.M, p.N},
+                                 std::vector<std::size_t>{p.N + 3, 1});
+
+        a_g_m_k.back().GenerateTensorValue(GeneratorTensor_2<float>{-5, 5});
+        b_g_k_n.back().GenerateTensorValue(GeneratorTensor_2<float>{-5, 5});
+    }
+
+    for(std::size_t g = 0; g < problems.size(); ++g)
+    {
+        auto ref_gemm     = ReferenceGemmInstance{};
+        auto ref_argument = ref_gemm.MakeArgument(
+            a_g_m_k[g], b_g_k_n[g], c_g_m_n_ref[g], PassThrough{}, PassThrough{}, PassThrough{});
+
+        ref_gemm.MakeInvoker().Run(ref_argument);
+    }
+
+    auto grouped_gemm     = ReferenceGroupedGemmInstance{};
+    auto grouped_argument = grouped_gemm.MakeArgument(
+        a_g_m_k, b_g_k_n, c_g_m_n, PassThrough{}, PassThrough{}, PassThrough{});
+
+    grouped_gemm.MakeInvoker().Run(grouped_argument);
+
+    for(std::size_t g = 0; g < problems.size(); ++g)
+    {
+        EXPECT_TRUE(ck::utils::check_err(c_g_m_n[g], c_g_m_n_ref[g])) << "group " << g;
+    }
+}
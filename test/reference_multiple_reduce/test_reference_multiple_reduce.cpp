@@ -0,0 +1,387 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <array>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/utility/reduction_operator.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/reference_tensor_operation/cpu/reference_multiple_reduce.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_reduce.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using Square      = ck::tensor_operation::element_wise::UnarySquare;
+using Divide      = ck::tensor_operation::element_wise::UnaryDivide;
+
+using Add = ck::reduce::Add;
+using Max = ck::reduce::Max;
+using Min = ck::reduce::Min;
+
+using IndexDataType = int32_t;
+
+void fill_random(Tensor<float>& tensor, unsigned seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(-5, 5);
+
+    for(auto& v : tensor)
+    {
+        v = static_cast<float>(dist(gen));
+    }
+}
+
+template <std::size_t N>
+std::array<ck::index_t, N> to_array(const std::vector<std::size_t>& values)
+{
+    std::array<ck::index_t, N> result;
+
+    std::copy(values.begin(), values.end(), result.begin());
+
+    return result;
+}
+
+// One reduction of in with ReferenceReduce, the result the fused reference has to match
+template <ck::index_t Rank,
+          ck::index_t NumReduceDim,
+          typename ReduceOperation,
+          typename InElementwiseOperation,
+          typename AccElementwiseOperation,
+          bool PropagateNan,
+          bool OutputIndex,
+          std::size_t NumDstDim>
+void reference_reduce(const Tensor<float>& in,
+                      Tensor<float>& out,
+                      std::vector<IndexDataType>& out_index,
+                      const std::array<ck::index_t, NumDstDim>& out_lengths,
+                      const std::array<int, NumReduceDim>& reduce_dims,
+                      double alpha,
+                      double beta,
+                      InElementwiseOperation in_elementwise_op,
+                      AccElementwiseOperation acc_elementwise_op)
+{
+    using ReferenceReduceInstance =
+        ck::tensor_operation::host::ReferenceReduce<float,
+                                                    float,
+                                                    float,
+                                                    Rank,
+                                                    NumReduceDim,
+                                                    ReduceOperation,
+                                                    InElementwiseOperation,
+                                                    AccElementwiseOperation,
+                                                    PropagateNan,
+                                                    OutputIndex>;
+
+    out_index.resize(out.mData.size());
+
+    auto ref_reduce   = ReferenceReduceInstance{};
+    auto argument_ptr = ref_reduce.MakeArgumentPointer(to_array<Rank>(in.mDesc.GetLengths()),
+                                                       to_array<Rank>(in.mDesc.GetStrides()),
+                                                       out_lengths,
+                                                       to_array<NumDstDim>(out.mDesc.GetStrides()),
+                                                       reduce_dims,
+                                                       alpha,
+                                                       beta,
+                                                       in.mData.data(),
+                                                       nullptr,
+                                                       out.mData.data(),
+                                                       out_index.data(),
+                                                       in_elementwise_op,
+                                                       acc_elementwise_op);
+
+    ref_reduce.MakeInvokerPointer()->Run(argument_ptr.get());
+}
+
+} // namespace
+
+TEST(ReferenceMultipleReduce, MeanAndMeanSquare)
+{
+    using ReferenceInstance =
+        ck::tensor_operation::host::ReferenceMultipleReduce<float,
+                                                            float,
+                                                            ck::Tuple<float, float>,
+                                                            4,
+                                                            3,
+                                                            ck::Tuple<Add, Add>,
+                                                            ck::Tuple<PassThrough, Square>,
+                                                            ck::Tuple<Divide, Divide>,
+                                                            false,
+                                                            false>;
+
+    const std::array<int, 3> reduce_dims{1, 2, 3};
+    const std::array<ck::index_t, 1> out_lengths{6};
+    const int reduce_length = 3 * 4 * 5;
+
+    Tensor<float> in({6, 3, 4, 5});
+    Tensor<float> mean({6});
+    Tensor<float> meansquare({6});
+
+    fill_random(in, 1);
+    fill_random(mean, 2);
+    fill_random(meansquare, 3);
+
+    Tensor<float> mean_ref(mean);
+    Tensor<float> meansquare_ref(meansquare);
+    std::vector<IndexDataType> index;
+
+    // with alpha and beta, the outputs are read before they are written
+    reference_reduce<4, 3, Add, PassThrough, Divide, false, false>(in,
+                                                                  mean_ref,
+                                                                  index,
+                                                                  out_lengths,
+                                                                  reduce_dims,
+                                                                  2.0,
+                                                                  0.5,
+                                                                  PassThrough{},
+                                                                  Divide{reduce_length});
+    reference_reduce<4, 3, Add, Square, Divide, false, false>(in,
+                                                              meansquare_ref,
+                                                              index,
+                                                              out_lengths,
+                                                              reduce_dims,
+                                                              1.0,
+                                                              0.0,
+                                                              Square{},
+                                                              Divide{reduce_length});
+
+    auto ref_multiple_reduce = ReferenceInstance{};
+    auto argument_ptr        = ref_multiple_reduce.MakeArgumentPointer(
+        to_array<4>(in.mDesc.GetLengths()),
+        to_array<4>(in.mDesc.GetStrides()),
+        out_lengths,
+        {to_array<1>(mean.mDesc.GetStrides()), to_array<1>(meansquare.mDesc.GetStrides())},
+        reduce_dims,
+        {2.0, 1.0},
+        {0.5, 0.0},
+        in.mData.data(),
+        {mean.mData.data(), meansquare.mData.data()},
+        ck::make_tuple(PassThrough{}, Square{}),
+        ck::make_tuple(Divide{reduce_length}, Divide{reduce_length}));
+
+    ASSERT_TRUE(ref_multiple_reduce.IsSupportedArgument(argument_ptr.get()));
+
+    ref_multiple_reduce.MakeInvokerPointer()->Run(argument_ptr.get());
+
+    EXPECT_EQ(mean.mData, mean_ref.mData);
+    EXPECT_EQ(meansquare.mData, meansquare_ref.mData);
+}
+
+TEST(ReferenceMultipleReduce, IndexAndNanPropagation)
+{
+    using ReduceOperations = ck::Tuple<Max, Add, Min>;
+    using InOperations     = ck::Tuple<PassThrough, PassThrough, PassThrough>;
+    using AccOperations    = ck::Tuple<PassThrough, PassThrough, PassThrough>;
+
+    using ReferenceInstance =
+        ck::tensor_operation::host::ReferenceMultipleReduce<float,
+                                                            float,
+                                                            ck::Tuple<float, float, float>,
+                                                            3,
+                                                            2,
+                                                            ReduceOperations,
+                                                            InOperations,
+                                                            AccOperations,
+                                                            true,
+                                                            true>;
+
+    // reduce the outer and the inner dim of a non-packed input
+    const std::array<int, 2> reduce_dims{0, 2};
+    const std::array<ck::index_t, 1> out_lengths{7};
+
+    Tensor<float> in(std::vector<std::size_t>{4, 7, 5}, std::vector<std::size_t>{80, 10, 1});
+    Tensor<float> max({7});
+    Tensor<float> sum({7});
+    Tensor<float> min({7});
+
+    fill_random(in, 4);
+
+    in(1, 2, 3) = std::numeric_limits<float>::quiet_NaN();
+    in(3, 5, 0) = std::numeric_limits<float>::quiet_NaN();
+
+    Tensor<float> max_ref({7});
+    Tensor<float> sum_ref({7});
+    Tensor<float> min_ref({7});
+    std::vector<IndexDataType> max_index_ref;
+    std::vector<IndexDataType> sum_index_ref;
+    std::vector<IndexDataType> min_index_ref;
+
+    auto reduce_row = [&](auto reduce_op, Tensor<float>& out, std::vector<IndexDataType>& index) {
+        using ReduceOperation = decltype(reduce_op);
+
+        reference_reduce<3, 2, ReduceOperation, PassThrough, PassThrough, true, true>(
+            in, out, index, out_lengths, reduce_dims, 1.0, 0.0, PassThrough{}, PassThrough{});
+    };
+
+    reduce_row(Max{}, max_ref, max_index_ref);
+    reduce_row(Min{}, min_ref, min_index_ref);
+
+    reference_reduce<3, 2, Add, PassThrough, PassThrough, true, false>(
+        in, sum_ref, sum_index_ref, out_lengths, reduce_dims, 1, 0, PassThrough{}, PassThrough{});
+
+    std::vector<IndexDataType> max_index(7, -1);
+    std::vector<IndexDataType> min_index(7, -1);
+
+    auto ref_multiple_reduce = ReferenceInstance{};
+    auto invoker             = ref_multiple_reduce.MakeInvoker();
+
+    const auto out_strides = to_array<1>(max.mDesc.GetStrides());
+
+    const std::array<void*, 3> out_hosts{max.mData.data(), sum.mData.data(), min.mData.data()};
+
+    // Add has no index, its index buffer is not needed
+    invoker.Run(ReferenceInstance::MakeArgument(to_array<3>(in.mDesc.GetLengths()),
+                                                to_array<3>(in.mDesc.GetStrides()),
+                                                out_lengths,
+                                                {out_strides, out_strides, out_strides},
+                                                reduce_dims,
+                                                {1.0, 1.0, 1.0},
+                                                {0.0, 0.0, 0.0},
+                                                in.mData.data(),
+                                                out_hosts,
+                                                {max_index.data(), nullptr, min_index.data()},
+                                                InOperations{},
+                                                AccOperations{}));
+
+    for(std::size_t i = 0; i < 7; ++i)
+    {
+        const bool has_nan = i == 2 || i == 5;
+
+        EXPECT_EQ(std::isnan(max(i)), has_nan) << i;
+        EXPECT_EQ(std::isnan(sum(i)), has_nan) << i;
+        EXPECT_EQ(std::isnan(min(i)), has_nan) << i;
+
+        if(!has_nan)
+        {
+            EXPECT_EQ(max(i), max_ref(i)) << i;
+            EXPECT_EQ(sum(i), sum_ref(i)) << i;
+            EXPECT_EQ(min(i), min_ref(i)) << i;
+        }
+
+        EXPECT_EQ(max_index[i], max_index_ref[i]) << i;
+        EXPECT_EQ(min_index[i], min_index_ref[i]) << i;
+    }
+
+    // the NaN at (1, 3) of the reduced dims is the result of its row
+    EXPECT_EQ(max_index[2], 1 * 5 + 3);
+    EXPECT_EQ(min_index[2], 1 * 5 + 3);
+
+    // the type erased interface has no index buffers
+    auto argument_ptr = ref_multiple_reduce.MakeArgumentPointer(
+        to_array<3>(in.mDesc.GetLengths()),
+        to_array<3>(in.mDesc.GetStrides()),
+        out_lengths,
+        {out_strides, out_strides, out_strides},
+        reduce_dims,
+        {1.0, 1.0, 1.0},
+        {0.0, 0.0, 0.0},
+        in.mData.data(),
+        out_hosts,
+        InOperations{},
+        AccOperations{});
+
+    EXPECT_FALSE(ref_multiple_reduce.IsSupportedArgument(argument_ptr.get()));
+}
+
+TEST(ReferenceMultipleReduce, ReduceAllDims)
+{
+    using ReferenceInstance = ck::tensor_operation::host::ReferenceMultipleReduce<
+        float,
+        float,
+        ck::Tuple<float, float>,
+        2,
+        2,
+        ck::Tuple<Add, ck::reduce::AMax>,
+        ck::Tuple<PassThrough, PassThrough>,
+        ck::Tuple<PassThrough, PassThrough>,
+        false,
+        true>;
+
+    Tensor<float> in({9, 11});
+    Tensor<float> out({1});
+
+    fill_random(in, 5);
+
+    float sum  = 0;
+    float amax = 0;
+    int amax_index = 0;
+
+    for(std::size_t i = 0; i < in.mData.size(); ++i)
+    {
+        sum += in.mData[i];
+
+        if(std::abs(in.mData[i]) > amax)
+        {
+            amax       = std::abs(in.mData[i]);
+            amax_index = static_cast<int>(i);
+        }
+    }
+
+    float sum_out  = 0;
+    float amax_out = 0;
+    IndexDataType amax_index_out = -1;
+
+    auto ref_multiple_reduce = ReferenceInstance{};
+    ref_multiple_reduce.MakeInvoker().Run(
+        ref_multiple_reduce.MakeArgument({9, 11},
+                                         {11, 1},
+                                         {1},
+                                         {{{1}, {1}}},
+                                         {0, 1},
+                                         {1.0, 1.0},
+                                         {0.0, 0.0},
+                                         in.mData.data(),
+                                         {&sum_out, &amax_out},
+                                         {nullptr, &amax_index_out},
+                                         ck::make_tuple(PassThrough{}, PassThrough{}),
+                                         ck::make_tuple(PassThrough{}, PassThrough{})));
+
+    EXPECT_EQ(sum_out, sum);
+    EXPECT_EQ(amax_out, amax);
+    EXPECT_EQ(amax_index_out, amax_index);
+}
+
+TEST(ReferenceMultipleReduce, InvalidArguments)
+{
+    using ReferenceInstance =
+        ck::tensor_operation::host::ReferenceMultipleReduce<float,
+                                                            float,
+                                                            ck::Tuple<float>,
+                                                            3,
+                                                            1,
+                                                            ck::Tuple<ck::reduce::Add>,
+                                                            ck::Tuple<PassThrough>,
+                                                            ck::Tuple<PassThrough>,
+                                                            false,
+                                                            false>;
+
+    std::vector<float> in(2 * 3 * 4);
+    std::vector<float> out(2 * 4);
+
+    auto make_argument = [&](std::array<int, 1> reduce_dims, std::array<ck::index_t, 2> lengths) {
+        return ReferenceInstance::MakeArgument({2, 3, 4},
+                                               {12, 4, 1},
+                                               lengths,
+                                               {{{4, 1}}},
+                                               reduce_dims,
+                                               {1.0},
+                                               {0.0},
+                                               in.data(),
+                                               {out.data()},
+                                               {nullptr},
+                                               ck::make_tuple(PassThrough{}),
+                                               ck::make_tuple(PassThrough{}));
+    };
+
+    EXPECT_NO_THROW(make_argument({1}, {2, 4}));
+    EXPECT_THROW(make_argument({3}, {2, 4}), std::runtime_error);
+    EXPECT_THROW(make_argument({1}, {2, 3}), std::runtime_error);
+}
@@ -0,0 +1,400 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <array>
+#include <cmath>
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/reference_tensor_operation/cpu/reference_batchnorm_backward.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_groupnorm_bwd.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_layernorm_bwd.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+void fill_random(Tensor<float>& tensor, unsigned seed, float lo, float hi)
+{
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<float> dist(lo, hi);
+
+    for(auto& v : tensor)
+    {
+        v = dist(gen);
+    }
+}
+
+// The backward of a normalization computed directly from its definition, in double. x(s, r),
+// dy(s, r) and param(s, r) give element r of group s and the index of its gamma.
+struct NaiveNormalizationBwd
+{
+    template <typename X, typename DY, typename Param>
+    NaiveNormalizationBwd(std::size_t num_group,
+                          std::size_t reduce_size,
+                          std::size_t num_param,
+                          X x,
+                          DY dy,
+                          Param param,
+                          const std::vector<double>& gamma,
+                          const std::vector<double>& mean,
+                          const std::vector<double>& inv_std)
+        : dx_(num_group, std::vector<double>(reduce_size)), dgamma_(num_param), dbeta_(num_param)
+    {
+        const double R = static_cast<double>(reduce_size);
+
+        for(std::size_t s = 0; s < num_group; ++s)
+        {
+            double ds = 0;
+            double db = 0;
+
+            for(std::size_t r = 0; r < reduce_size; ++r)
+            {
+                ds += dy(s, r) * gamma[param(s, r)] * x(s, r);
+                db += dy(s, r) * gamma[param(s, r)];
+
+                dgamma_[param(s, r)] += dy(s, r) * (x(s, r) - mean[s]) * inv_std[s];
+                dbeta_[param(s, r)] += dy(s, r);
+            }
+
+            const double b = (db * mean[s] - ds) * std::pow(inv_std[s], 3) / R;
+            const double c = -b * mean[s] - db * inv_std[s] / R;
+
+            for(std::size_t r = 0; r < reduce_size; ++r)
+            {
+                dx_[s][r] = inv_std[s] * dy(s, r) * gamma[param(s, r)] + b * x(s, r) + c;
+            }
+        }
+    }
+
+    std::vector<std::vector<double>> dx_;
+    std::vector<double> dgamma_;
+    std::vector<double> dbeta_;
+};
+
+// mean and 1 / sqrt(variance + epsilon) of every group
+template <typename X>
+void get_mean_inv_std(std::size_t num_group,
+                      std::size_t reduce_size,
+                      X x,
+                      double epsilon,
+                      std::vector<double>& mean,
+                      std::vector<double>& inv_std)
+{
+    mean.assign(num_group, 0);
+    inv_std.assign(num_group, 0);
+
+    for(std::size_t s = 0; s < num_group; ++s)
+    {
+        double variance = 0;
+
+        for(std::size_t r = 0; r < reduce_size; ++r)
+            mean[s] += x(s, r);
+
+        mean[s] /= static_cast<double>(reduce_size);
+
+        for(std::size_t r = 0; r < reduce_size; ++r)
+            variance += (x(s, r) - mean[s]) * (x(s, r) - mean[s]);
+
+        variance /= static_cast<double>(reduce_size);
+
+        inv_std[s] = 1.0 / std::sqrt(variance + epsilon);
+    }
+}
+
+void expect_near(float result, double expected)
+{
+    EXPECT_NEAR(result, expected, 1e-4 * (1.0 + std::abs(expected)));
+}
+
+using ReferenceLayernormBwd = ck::tensor_operation::host::
+    ReferenceLayernormBwd<float, float, float, float, float, float, float, float>;
+
+void run_layernorm_bwd(const Tensor<float>& dy,
+                       const Tensor<float>& x,
+                       const Tensor<float>& gamma,
+                       const Tensor<float>& mean,
+                       const Tensor<float>& inv_std,
+                       Tensor<float>& dgamma,
+                       Tensor<float>& dbeta,
+                       Tensor<float>& dx)
+{
+    const auto& lengths = x.mDesc.GetLengths();
+
+    auto ref = ReferenceLayernormBwd{};
+    ref.MakeInvoker().Run(ref.MakeArgument(
+        dy,
+        x,
+        gamma,
+        mean,
+        inv_std,
+        dgamma,
+        dbeta,
+        dx,
+        {static_cast<ck::index_t>(lengths[0]), static_cast<ck::index_t>(lengths[1])}));
+}
+
+// Layernorm backward of an M x N problem against the naive formulas, and the same results when
+// the reference runs serially inside a task of the thread pool
+void check_layernorm_bwd(std::size_t M, std::size_t N)
+{
+    Tensor<float> x({M, N});
+    Tensor<float> dy({M, N});
+    Tensor<float> gamma({N});
+    Tensor<float> mean({M});
+    Tensor<float> inv_std({M});
+
+    fill_random(x, 1, -2.f, 2.f);
+    fill_random(dy, 2, -1.f, 1.f);
+    fill_random(gamma, 3, 0.5f, 1.5f);
+
+    auto x_at  = [&](std::size_t s, std::size_t r) { return static_cast<double>(x(s, r)); };
+    auto dy_at = [&](std::size_t s, std::size_t r) { return static_cast<double>(dy(s, r)); };
+
+    std::vector<double> mean_m;
+    std::vector<double> inv_std_m;
+
+    get_mean_inv_std(M, N, x_at, 1e-5, mean_m, inv_std_m);
+
+    // the naive results from the same rounded statistics the reference reads
+    for(std::size_t m = 0; m < M; ++m)
+    {
+        mean(m)      = static_cast<float>(mean_m[m]);
+        inv_std(m)   = static_cast<float>(inv_std_m[m]);
+        mean_m[m]    = mean(m);
+        inv_std_m[m] = inv_std(m);
+    }
+
+    const NaiveNormalizationBwd naive(M,
+                                      N,
+                                      N,
+                                      x_at,
+                                      dy_at,
+                                      [](std::size_t, std::size_t r) { return r; },
+                                      std::vector<double>(gamma.begin(), gamma.end()),
+                                      mean_m,
+                                      inv_std_m);
+
+    Tensor<float> dgamma({N});
+    Tensor<float> dbeta({N});
+    Tensor<float> dx({M, N});
+
+    run_layernorm_bwd(dy, x, gamma, mean, inv_std, dgamma, dbeta, dx);
+
+    for(std::size_t n = 0; n < N; ++n)
+    {
+        expect_near(dgamma(n), naive.dgamma_[n]);
+        expect_near(dbeta(n), naive.dbeta_[n]);
+    }
+
+    for(std::size_t m = 0; m < M; ++m)
+        for(std::size_t n = 0; n < N; ++n)
+            expect_near(dx(m, n), naive.dx_[m][n]);
+
+    Tensor<float> serial_dgamma({N});
+    Tensor<float> serial_dbeta({N});
+    Tensor<float> serial_dx({M, N});
+
+    // a ParallelFor issued from a task of the pool runs on the calling thread
+    ck::utils::HostThreadPool::GetInstance().ParallelFor(2, [&](std::size_t i) {
+        if(i == 0)
+            run_layernorm_bwd(
+                dy, x, gamma, mean, inv_std, serial_dgamma, serial_dbeta, serial_dx);
+    });
+
+    EXPECT_EQ(serial_dgamma.mData, dgamma.mData);
+    EXPECT_EQ(serial_dbeta.mData, dbeta.mData);
+    EXPECT_EQ(serial_dx.mData, dx.mData);
+}
+
+} // namespace
+
+TEST(ReferenceNormalizationBwd, Layernorm) { check_layernorm_bwd(17, 33); }
+
+TEST(ReferenceNormalizationBwd, LayernormSplitRows)
+{
+    // rows longer than a task, so every row is reduced in parts that are merged in order
+    check_layernorm_bwd(3, 2 * ck::tensor_operation::host::NormalizationBwdChunkLength + 100);
+}
+
+TEST(ReferenceNormalizationBwd, Groupnorm)
+{
+    constexpr std::size_t N = 2;
+    constexpr std::size_t H = 3;
+    constexpr std::size_t W = 4;
+    constexpr std::size_t G = 3;
+    constexpr std::size_t C = 5;
+
+    Tensor<float> x({N, H, W, G, C});
+    Tensor<float> dy({N, H, W, G, C});
+    Tensor<float> gamma({G, C});
+    Tensor<float> mean({N, G});
+    Tensor<float> inv_std({N, G});
+
+    fill_random(x, 4, -2.f, 2.f);
+    fill_random(dy, 5, -1.f, 1.f);
+    fill_random(gamma, 6, 0.5f, 1.5f);
+
+    // group s = (n, g), position r = (h, w, c)
+    auto x_at = [&](std::size_t s, std::size_t r) {
+        return static_cast<double>(x(s / G, r / (W * C), r / C % W, s % G, r % C));
+    };
+    auto dy_at = [&](std::size_t s, std::size_t r) {
+        return static_cast<double>(dy(s / G, r / (W * C), r / C % W, s % G, r % C));
+    };
+    auto param = [&](std::size_t s, std::size_t r) { return s % G * C + r % C; };
+
+    std::vector<double> mean_ng;
+    std::vector<double> inv_std_ng;
+
+    get_mean_inv_std(N * G, H * W * C, x_at, 1e-5, mean_ng, inv_std_ng);
+
+    // the naive results from the same rounded statistics the reference reads
+    for(std::size_t s = 0; s < N * G; ++s)
+    {
+        mean(s / G, s % G)    = static_cast<float>(mean_ng[s]);
+        inv_std(s / G, s % G) = static_cast<float>(inv_std_ng[s]);
+        mean_ng[s]            = mean(s / G, s % G);
+        inv_std_ng[s]         = inv_std(s / G, s % G);
+    }
+
+    const NaiveNormalizationBwd naive(N * G,
+                                      H * W * C,
+                                      G * C,
+                                      x_at,
+                                      dy_at,
+                                      param,
+                                      std::vector<double>(gamma.begin(), gamma.end()),
+                                      mean_ng,
+                                      inv_std_ng);
+
+    Tensor<float> dgamma({G, C});
+    Tensor<float> dbeta({G, C});
+    Tensor<float> dx({N, H, W, G, C});
+
+    auto ref = ck::tensor_operation::host::
+        ReferenceGroupnormBwd<float, float, float, float, float, float, float, float>{};
+    ref.MakeInvoker().Run(ref.MakeArgument(
+        dy, x, gamma, mean, inv_std, dgamma, dbeta, dx, {N, H, W, G, C}));
+
+    for(std::size_t p = 0; p < G * C; ++p)
+    {
+        expect_near(dgamma(p / C, p % C), naive.dgamma_[p]);
+        expect_near(dbeta(p / C, p % C), naive.dbeta_[p]);
+    }
+
+    for(std::size_t s = 0; s < N * G; ++s)
+        for(std::size_t r = 0; r < H * W * C; ++r)
+            expect_near(dx(s / G, r / (W * C), r / C % W, s % G, r % C), naive.dx_[s][r]);
+}
+
+TEST(ReferenceNormalizationBwd, Batchnorm)
+{
+    constexpr std::size_t N = 4;
+    constexpr std::size_t H = 5;
+    constexpr std::size_t W = 3;
+    constexpr std::size_t C = 6;
+
+    constexpr double epsilon = 1e-4;
+
+    Tensor<float> x({N, H, W, C});
+    Tensor<float> dy({N, H, W, C});
+    Tensor<float> scale({C});
+    Tensor<float> saved_mean({C});
+    Tensor<float> saved_inv_var({C});
+
+    fill_random(x, 7, -2.f, 2.f);
+    fill_random(dy, 8, -1.f, 1.f);
+    fill_random(scale, 9, 0.5f, 1.5f);
+
+    // group s = c, position r = (n, h, w)
+    auto x_at = [&](std::size_t s, std::size_t r) {
+        return static_cast<double>(x(r / (H * W), r / W % H, r % W, s));
+    };
+    auto dy_at = [&](std::size_t s, std::size_t r) {
+        return static_cast<double>(dy(r / (H * W), r / W % H, r % W, s));
+    };
+
+    std::vector<double> mean_c;
+    std::vector<double> inv_std_c;
+
+    get_mean_inv_std(C, N * H * W, x_at, epsilon, mean_c, inv_std_c);
+
+    for(std::size_t c = 0; c < C; ++c)
+    {
+        saved_mean(c)    = static_cast<float>(mean_c[c]);
+        saved_inv_var(c) = static_cast<float>(inv_std_c[c]);
+    }
+
+    const NaiveNormalizationBwd naive(C,
+                                      N * H * W,
+                                      C,
+                                      x_at,
+                                      dy_at,
+                                      [](std::size_t s, std::size_t) { return s; },
+                                      std::vector<double>(scale.begin(), scale.end()),
+                                      mean_c,
+                                      inv_std_c);
+
+    using ReferenceBatchNormBwd = ck::tensor_operation::host::
+        ReferenceBatchNormBwd<float, float, float, float, float, float, float, PassThrough, 4, 3>;
+
+    auto to_array = [](const std::vector<std::size_t>& values) {
+        std::array<ck::index_t, 4> result;
+
+        std::copy(values.begin(), values.end(), result.begin());
+
+        return result;
+    };
+
+    const auto lengths = to_array(x.mDesc.GetLengths());
+    const auto strides = to_array(x.mDesc.GetStrides());
+
+    // with the saved mean and inv variance, and with both computed by the reference
+    for(const bool use_saved : {true, false})
+    {
+        Tensor<float> dx({N, H, W, C});
+        Tensor<float> dscale({C});
+        Tensor<float> dbias({C});
+
+        auto ref = ReferenceBatchNormBwd{};
+
+        auto argument = ref.MakeArgumentPointer(lengths,
+                                                strides,
+                                                strides,
+                                                strides,
+                                                {0, 1, 2},
+                                                {C},
+                                                {1},
+                                                {1},
+                                                {1},
+                                                x.mData.data(),
+                                                dy.mData.data(),
+                                                scale.mData.data(),
+                                                use_saved ? saved_mean.mData.data() : nullptr,
+                                                use_saved ? saved_inv_var.mData.data() : nullptr,
+                                                epsilon,
+                                                PassThrough{},
+                                                dx.mData.data(),
+                                                dscale.mData.data(),
+                                                dbias.mData.data());
+
+        ref.MakeInvokerPointer()->Run(argument.get());
+
+        for(std::size_t c = 0; c < C; ++c)
+        {
+            expect_near(dscale(c), naive.dgamma_[c]);
+            expect_near(dbias(c), naive.dbeta_[c]);
+        }
+
+        for(std::size_t s = 0; s < C; ++s)
+            for(std::size_t r = 0; r < N * H * W; ++r)
+                expect_near(dx(r / (H * W), r / W % H, r % W, s), naive.dx_[s][r]);
+    }
+}
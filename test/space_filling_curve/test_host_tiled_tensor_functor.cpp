@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <atomic>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/library/utility/host_tiled_tensor_functor.hpp"
+
+class TestHostTiledTensorFunctor : public ::testing::TestWithParam<HostTileOrder>
+{
+};
+
+// every index is visited exactly once, whatever the tiling, order and thread count
+TEST_P(TestHostTiledTensorFunctor, VisitsEveryIndexOnce)
+{
+    const std::size_t G = 3, M = 37, N = 53;
+
+    for(auto tile_lens : std::vector<std::array<std::size_t, 3>>{
+            {1, 32, 32}, {1, 8, 5}, {2, 1, 7}, {1, 1, 1}, {4, 64, 64}})
+    {
+        for(std::size_t num_thread : {1, 3, 8})
+        {
+            std::vector<std::atomic<int>> visits(G * M * N);
+
+            auto f = [&](auto g, auto m, auto n) { visits[(g * M + m) * N + n]++; };
+
+            make_TiledParallelTensorFunctor(f, G, M, N)
+                .SetTileLengths(tile_lens)
+                .SetTileOrder(GetParam())(num_thread);
+
+            for(const auto& v : visits)
+            {
+                ASSERT_EQ(v.load(), 1);
+            }
+        }
+    }
+}
+
+// consecutive tiles along the curve are neighbours
+TEST_P(TestHostTiledTensorFunctor, CurveIsContinuous)
+{
+    if(GetParam() != HostTileOrder::Hilbert)
+    {
+        GTEST_SKIP();
+    }
+
+    auto f = [](auto, auto) {};
+
+    const auto tiles =
+        make_TiledParallelTensorFunctor(f, 256, 256).SetTileLengths({16, 16}).GetTileOrder();
+
+    ASSERT_EQ(tiles.size(), 256);
+
+    for(std::size_t i = 1; i < tiles.size(); ++i)
+    {
+        const auto dm = tiles[i][0] > tiles[i - 1][0] ? tiles[i][0] - tiles[i - 1][0]
+                                                      : tiles[i - 1][0] - tiles[i][0];
+        const auto dn = tiles[i][1] > tiles[i - 1][1] ? tiles[i][1] - tiles[i - 1][1]
+                                                      : tiles[i - 1][1] - tiles[i][1];
+
+        EXPECT_EQ(dm + dn, 1);
+    }
+}
+
+TEST(TestHostTiledTensorFunctorEmpty, ZeroLength)
+{
+    int calls = 0;
+
+    auto f = [&](auto, auto) { ++calls; };
+
+    make_TiledParallelTensorFunctor(f, 0, 16)(4);
+
+    EXPECT_EQ(calls, 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(HostTileOrders,
+                         TestHostTiledTensorFunctor,
+                         ::testing::Values(HostTileOrder::RowMajor,
+                                           HostTileOrder::Morton,
+                                           HostTileOrder::Hilbert));
+
+// a small output, e.g. of a GEMM with a long K, is still split across the threads
+TEST(TestHostTiledTensorFunctorSmall, TilesShrinkToThreadCount)
+{
+    auto f = [](auto, auto) {};
+
+    auto functor = make_TiledParallelTensorFunctor(f, 32, 32);
+
+    EXPECT_EQ(functor.GetTileLengths(1), (std::array<std::size_t, 2>{32, 32}));
+    EXPECT_EQ(functor.GetTileLengths(16), (std::array<std::size_t, 2>{8, 8}));
+    EXPECT_EQ(functor.GetTileLengths(2048), (std::array<std::size_t, 2>{1, 1}));
+
+    // lengths below the tile length count as one tile
+    EXPECT_EQ(make_TiledParallelTensorFunctor(f, 3, 100).GetTileLengths(8),
+              (std::array<std::size_t, 2>{3, 8}));
+}
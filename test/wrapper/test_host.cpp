@@ -0,0 +1,155 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <numeric>
+#include <cstdlib>
+#include <iostream>
+#include <initializer_list>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/utility/host_wrapper.hpp"
+#include "ck/utility/common_header.hpp"
+#include "ck/wrapper/layout.hpp"
+#include "ck/wrapper/tensor.hpp"
+#include "ck/wrapper/operations/copy.hpp"
+
+// Copy from host tensor to host tensor through per thread registers, with the
+// same tiling and partitioning as the device copy test
+template <bool UseOptimizedCopy>
+void PerformHostCopyViaRegisters()
+{
+    const auto shape =
+        ck::make_tuple(ck::make_tuple(ck::Number<2>{}, ck::Number<2>{}), ck::Number<256>{});
+    const auto strides =
+        ck::make_tuple(ck::make_tuple(ck::Number<1>{}, ck::Number<2>{}), ck::Number<4>{});
+    const auto tensor_layout = ck::wrapper::make_layout(shape, strides);
+
+    const std::size_t num_elements = ck::wrapper::size(tensor_layout);
+
+    Tensor<ck::index_t> input({num_elements});
+    Tensor<ck::index_t> output({num_elements});
+
+    // 0, 1, 2, ..., size(shape) - 1
+    std::iota(input.mData.begin(), input.mData.end(), 0);
+
+    const auto input_tensor  = ck::wrapper::make_host_tensor(input, tensor_layout);
+    auto output_tensor       = ck::wrapper::make_host_tensor(output, tensor_layout);
+    const auto thread_layout = ck::make_tuple(ck::Number<1>{}, ck::Number<32>{});
+    const auto tile_shape    = ck::make_tuple(ck::Number<4>{}, ck::Number<64>{});
+
+    const ck::index_t grid_size = ck::math::integer_divide_ceil(ck::wrapper::size(input_tensor),
+                                                                ck::wrapper::size(tile_shape));
+
+    ck::wrapper::launch_host_kernel(
+        StreamConfig{},
+        [&](ck::index_t block_id, ck::index_t thread_id) {
+            const auto input_local_tile =
+                ck::wrapper::make_local_tile(input_tensor, tile_shape, block_id);
+            const auto output_local_tile =
+                ck::wrapper::make_local_tile(output_tensor, tile_shape, block_id);
+
+            const auto input_local_partition =
+                ck::wrapper::make_local_partition(input_local_tile, thread_layout, thread_id);
+            auto output_local_partition =
+                ck::wrapper::make_local_partition(output_local_tile, thread_layout, thread_id);
+
+            auto tensor_vgpr =
+                ck::wrapper::make_register_tensor<ck::wrapper::MemoryTypeEnum::Vgpr, ck::index_t>(
+                    layout(input_local_partition));
+
+            if constexpr(UseOptimizedCopy)
+            {
+                using DimAccessOrder                    = ck::Tuple<ck::Number<1>, ck::Number<0>>;
+                constexpr ck::index_t vector_dim        = 0;
+                constexpr ck::index_t scalar_per_vector = 2;
+                ck::wrapper::copy<DimAccessOrder, vector_dim, scalar_per_vector>(
+                    input_local_partition, tensor_vgpr);
+                ck::wrapper::copy<DimAccessOrder, vector_dim, scalar_per_vector>(
+                    tensor_vgpr, output_local_partition);
+            }
+            else
+            {
+                ck::wrapper::copy(input_local_partition, tensor_vgpr);
+                ck::wrapper::copy(tensor_vgpr, output_local_partition);
+            }
+        },
+        grid_size,
+        ck::wrapper::size(thread_layout));
+
+    EXPECT_TRUE(ck::utils::check_err(output.mData, input.mData));
+}
+
+TEST(TestHostCopyViaRegisters, GenericCopy) { PerformHostCopyViaRegisters<false>(); }
+TEST(TestHostCopyViaRegisters, OptimizedCopy) { PerformHostCopyViaRegisters<true>(); }
+
+TEST(TestHostCopy, OptimizedCopyHostTensors)
+{
+    constexpr ck::index_t M = 37;
+    constexpr ck::index_t N = 67;
+
+    Tensor<float> input({M, N});
+    // column major, VectorDim 1 is strided in the output
+    Tensor<float> output(std::vector<std::size_t>{M, N}, std::vector<std::size_t>{1, M});
+
+    input.GenerateTensorValue(GeneratorTensor_3<float>{-1.f, 1.f});
+
+    const auto input_tensor = ck::wrapper::make_host_tensor<2>(input);
+    auto output_tensor      = ck::wrapper::make_host_tensor<2>(output);
+
+    using DimAccessOrder = ck::Tuple<ck::Number<0>, ck::Number<1>>;
+    ck::wrapper::copy<DimAccessOrder, 1, 4>(input_tensor, output_tensor);
+
+    for(ck::index_t m = 0; m < M; ++m)
+    {
+        for(ck::index_t n = 0; n < N; ++n)
+        {
+            EXPECT_EQ(output(m, n), input(m, n));
+        }
+    }
+
+    // back, VectorDim 1 contiguous in the destination
+    Tensor<float> result({M, N});
+    auto result_tensor = ck::wrapper::make_host_tensor<2>(result);
+    ck::wrapper::copy<DimAccessOrder, 1, 4>(output_tensor, result_tensor);
+
+    EXPECT_TRUE(ck::utils::check_err(result.mData, input.mData));
+}
+
+TEST(TestHostCopy, OptimizedCopyNestedVectorDim)
+{
+    // VectorDim 0 is nested, (2, 2) with strides (1, 6): indices 0, 1 are adjacent in memory,
+    // index 2 is not
+    const auto shape   = ck::make_tuple(ck::make_tuple(2, 2), 3);
+    const auto strides = ck::make_tuple(ck::make_tuple(1, 6), 2);
+
+    Tensor<float> input({12});
+    Tensor<float> output({12});
+
+    input.GenerateTensorValue(GeneratorTensor_3<float>{-1.f, 1.f});
+
+    const auto input_tensor =
+        ck::wrapper::make_host_tensor(input, ck::wrapper::make_layout(shape, strides));
+    auto output_tensor = ck::wrapper::make_host_tensor(output, ck::wrapper::make_layout(shape));
+
+    using DimAccessOrder = ck::Tuple<ck::Number<1>, ck::Number<0>>;
+    ck::wrapper::copy<DimAccessOrder, 0, 4>(input_tensor, output_tensor);
+
+    for(ck::index_t i = 0; i < ck::wrapper::size(input_tensor); ++i)
+    {
+        EXPECT_EQ(output_tensor(i), input_tensor(i)) << i;
+    }
+}
+
+TEST(TestHostCopy, MakeHostTensorChecksStorage)
+{
+    Tensor<float> tensor({16});
+
+    const auto too_large = ck::wrapper::make_layout(ck::make_tuple(4, 8));
+
+    EXPECT_THROW(ck::wrapper::make_host_tensor(tensor, too_large), std::runtime_error);
+    EXPECT_THROW(ck::wrapper::make_host_tensor<2>(tensor), std::runtime_error);
+}